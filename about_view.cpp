@@ -55,7 +55,9 @@ bool about_view::process_events()
 {
   // User interaction
   sf::Event event;
-  while (m_window.pollEvent(event))
+  // Wake up every frame, as the title keeps rotating
+  if (!wait_for_event(m_window, event, sf::seconds(1.0f / 60.0f))) return false;
+  do
   {
     if (event.type == sf::Event::Resized)
     {
@@ -82,7 +84,7 @@ bool about_view::process_events()
         return true;
       }
     }
-  }
+  } while (m_window.pollEvent(event));
   return false; // Do not close the window :-)
 }
 
@@ -11,8 +11,8 @@ action_history::action_history(
 {
   assert(
     std::is_sorted(
-      std::begin(m_timed_actions),
-      std::end(m_timed_actions),
+      std::begin(get_timed_actions()),
+      std::end(get_timed_actions()),
       [](const auto& lhs, const auto& rhs)
       {
         return lhs.first < rhs.first;
@@ -23,7 +23,7 @@ action_history::action_history(
 
 void action_history::add_action(const delta_t& t, const piece_action& action) noexcept
 {
-  m_timed_actions.push_back(std::make_pair(t, action));
+  m_timed_actions.get_mutable().push_back(std::make_pair(t, action));
 }
 
 std::vector<piece_action> collect_actions_in_timespan(
@@ -1,6 +1,7 @@
 #ifndef ACTION_HISTORY_H
 #define ACTION_HISTORY_H
 
+#include "copy_on_write.h"
 #include "delta_t.h"
 #include "piece_action.h"
 
@@ -17,12 +18,13 @@ public:
   /// Add an action, when started
   void add_action(const delta_t& t, const piece_action& action) noexcept;
 
-  const auto& get_timed_actions() const noexcept { return m_timed_actions; }
+  const auto& get_timed_actions() const noexcept { return m_timed_actions.get(); }
 
 private:
 
-  /// The history of actions (i.e when they started), in chrononical order
-  std::vector<std::pair<delta_t, piece_action>> m_timed_actions;
+  /// The history of actions (i.e when they started), in chrononical order.
+  /// Shared between copies, as a history only grows
+  copy_on_write<std::vector<std::pair<delta_t, piece_action>>> m_timed_actions;
 
 };
 
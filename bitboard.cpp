@@ -0,0 +1,449 @@
+#include "bitboard.h"
+
+#include "square.h"
+
+#include <algorithm>
+#include <cassert>
+
+/// Get the index of the lowest bit set
+int get_first_index(const bitboard b) noexcept
+{
+  assert(b != 0);
+  return __builtin_ctzll(b);
+}
+
+/// Get the index of the highest bit set
+int get_last_index(const bitboard b) noexcept
+{
+  assert(b != 0);
+  return 63 - __builtin_clzll(b);
+}
+
+/// Convert an index to a square
+square index_to_square(const int i) noexcept
+{
+  assert(i >= 0);
+  assert(i < 64);
+  return square(i / 8, i % 8);
+}
+
+/// Create an attack table from the delta pairs of single steps
+std::array<bitboard, 64> create_step_attack_table(
+  const std::vector<std::pair<int, int>>& delta_pairs
+) noexcept
+{
+  std::array<bitboard, 64> table;
+  for (int i{0}; i != 64; ++i)
+  {
+    const square s{index_to_square(i)};
+    bitboard b{0};
+    for (const auto& delta_pair: delta_pairs)
+    {
+      const int x{s.get_x() + delta_pair.first};
+      const int y{s.get_y() + delta_pair.second};
+      if (is_valid_square_xy(x, y)) b |= to_bitboard(square(x, y));
+    }
+    table[i] = b;
+  }
+  return table;
+}
+
+/// The ray tables in all directions of a piece,
+/// in the same order as the delta pairs
+std::vector<std::array<bitboard, 64>> create_ray_tables(
+  const std::vector<std::pair<int, int>>& delta_pairs,
+  const int max_distance
+) noexcept
+{
+  std::vector<std::array<bitboard, 64>> tables;
+  tables.reserve(delta_pairs.size());
+  for (const auto& delta_pair: delta_pairs)
+  {
+    tables.push_back(
+      create_ray_table(delta_pair.first, delta_pair.second, max_distance)
+    );
+  }
+  return tables;
+}
+
+/// The ray tables in the eight directions of a queen,
+/// in the order of \link{collect_all_queen_delta_pairs}
+const std::vector<std::array<bitboard, 64>>& get_queen_ray_tables() noexcept
+{
+  static const std::vector<std::array<bitboard, 64>> tables{
+    create_ray_tables(collect_all_queen_delta_pairs(), 7)
+  };
+  return tables;
+}
+
+/// The ray tables in the eight directions of a knight,
+/// in the order of \link{collect_all_knight_delta_pairs}
+const std::vector<std::array<bitboard, 64>>& get_knight_ray_tables() noexcept
+{
+  static const std::vector<std::array<bitboard, 64>> tables{
+    create_ray_tables(collect_all_knight_delta_pairs(), 3)
+  };
+  return tables;
+}
+
+/// Get the squares in a direction that are not blocked,
+/// where the blocking square itself is included
+bitboard get_ray_attacks(
+  const std::array<bitboard, 64>& rays,
+  const int dx,
+  const int dy,
+  const square& s,
+  const bitboard occupied
+) noexcept
+{
+  const bitboard ray{rays[to_index(s)]};
+  const bitboard blockers{ray & occupied};
+  if (blockers == 0) return ray;
+  // Going in the direction of a higher index, the nearest blocker
+  // has the lowest index
+  const bool is_ascending{(dx * 8) + dy > 0};
+  const int blocker_index{
+    is_ascending ? get_first_index(blockers) : get_last_index(blockers)
+  };
+  return ray & ~rays[blocker_index];
+}
+
+/// Get the squares in the directions that are not blocked
+bitboard get_rays_attacks(
+  const std::vector<std::array<bitboard, 64>>& tables,
+  const std::vector<std::pair<int, int>>& delta_pairs,
+  const square& s,
+  const bitboard occupied
+) noexcept
+{
+  assert(tables.size() == delta_pairs.size());
+  bitboard b{0};
+  const int n{static_cast<int>(tables.size())};
+  for (int i{0}; i != n; ++i)
+  {
+    b |= get_ray_attacks(
+      tables[i], delta_pairs[i].first, delta_pairs[i].second, s, occupied
+    );
+  }
+  return b;
+}
+
+int count_squares(const bitboard b) noexcept
+{
+  return __builtin_popcountll(b);
+}
+
+std::array<bitboard, 64> create_king_attack_table() noexcept
+{
+  return create_step_attack_table(collect_all_queen_delta_pairs());
+}
+
+std::array<bitboard, 64> create_knight_attack_table() noexcept
+{
+  return create_step_attack_table(collect_all_knight_delta_pairs());
+}
+
+std::array<bitboard, 64> create_pawn_attack_table(const chess_color color) noexcept
+{
+  const int dx{color == chess_color::white ? 1 : -1};
+  return create_step_attack_table(
+    {
+      std::make_pair(dx, -1),
+      std::make_pair(dx,  1)
+    }
+  );
+}
+
+std::array<bitboard, 64> create_ray_table(
+  const int dx,
+  const int dy,
+  const int max_distance
+) noexcept
+{
+  assert(dx != 0 || dy != 0);
+  std::array<bitboard, 64> table;
+  for (int i{0}; i != 64; ++i)
+  {
+    const square s{index_to_square(i)};
+    bitboard b{0};
+    for (int distance{1}; distance <= max_distance; ++distance)
+    {
+      const int x{s.get_x() + (dx * distance)};
+      const int y{s.get_y() + (dy * distance)};
+      if (!is_valid_square_xy(x, y)) break;
+      b |= to_bitboard(square(x, y));
+    }
+    table[i] = b;
+  }
+  return table;
+}
+
+bitboard get_bishop_attacks(const square& s, const bitboard occupied) noexcept
+{
+  // The diagonal directions of a queen
+  const auto& tables{get_queen_ray_tables()};
+  static const std::vector<std::pair<int, int>> delta_pairs{
+    collect_all_queen_delta_pairs()
+  };
+  bitboard b{0};
+  for (int i{1}; i < 8; i += 2)
+  {
+    assert(delta_pairs[i].first != 0 && delta_pairs[i].second != 0);
+    b |= get_ray_attacks(
+      tables[i], delta_pairs[i].first, delta_pairs[i].second, s, occupied
+    );
+  }
+  return b;
+}
+
+square get_first_square(const bitboard b) noexcept
+{
+  return index_to_square(get_first_index(b));
+}
+
+bitboard get_king_attacks(const square& s) noexcept
+{
+  static const std::array<bitboard, 64> table{create_king_attack_table()};
+  return table[to_index(s)];
+}
+
+bitboard get_knight_attacks(const square& s) noexcept
+{
+  static const std::array<bitboard, 64> table{create_knight_attack_table()};
+  return table[to_index(s)];
+}
+
+bitboard get_knight_ray_attacks(const square& s, const bitboard occupied) noexcept
+{
+  static const std::vector<std::pair<int, int>> delta_pairs{
+    collect_all_knight_delta_pairs()
+  };
+  return get_rays_attacks(get_knight_ray_tables(), delta_pairs, s, occupied);
+}
+
+square get_last_square(const bitboard b) noexcept
+{
+  return index_to_square(get_last_index(b));
+}
+
+bitboard get_pawn_attacks(const square& s, const chess_color color) noexcept
+{
+  static const std::array<bitboard, 64> black_table{
+    create_pawn_attack_table(chess_color::black)
+  };
+  static const std::array<bitboard, 64> white_table{
+    create_pawn_attack_table(chess_color::white)
+  };
+  if (color == chess_color::white) return white_table[to_index(s)];
+  assert(color == chess_color::black);
+  return black_table[to_index(s)];
+}
+
+bitboard get_pawn_pushes(
+  const square& s,
+  const chess_color color,
+  const bitboard occupied
+) noexcept
+{
+  static const std::array<bitboard, 64> black_table{create_ray_table(-1, 0)};
+  static const std::array<bitboard, 64> white_table{create_ray_table(1, 0)};
+  const int dx{color == chess_color::white ? 1 : -1};
+  const auto& table{color == chess_color::white ? white_table : black_table};
+  return get_ray_attacks(table, dx, 0, s, occupied) & ~occupied;
+}
+
+bitboard get_queen_attacks(const square& s, const bitboard occupied) noexcept
+{
+  static const std::vector<std::pair<int, int>> delta_pairs{
+    collect_all_queen_delta_pairs()
+  };
+  return get_rays_attacks(get_queen_ray_tables(), delta_pairs, s, occupied);
+}
+
+std::vector<square> get_ray_squares(
+  const square& s,
+  const int dx,
+  const int dy
+)
+{
+  const auto delta_pairs{collect_all_queen_delta_pairs()};
+  const auto there{
+    std::find(
+      std::begin(delta_pairs),
+      std::end(delta_pairs),
+      std::make_pair(dx, dy)
+    )
+  };
+  assert(there != std::end(delta_pairs));
+  const auto i{std::distance(std::begin(delta_pairs), there)};
+  std::vector<square> squares{
+    to_squares(get_queen_ray_tables()[i][to_index(s)])
+  };
+  // Sort by distance
+  if ((dx * 8) + dy < 0)
+  {
+    std::reverse(std::begin(squares), std::end(squares));
+  }
+  return squares;
+}
+
+bitboard get_rook_attacks(const square& s, const bitboard occupied) noexcept
+{
+  // The horizontal and vertical directions of a queen
+  const auto& tables{get_queen_ray_tables()};
+  static const std::vector<std::pair<int, int>> delta_pairs{
+    collect_all_queen_delta_pairs()
+  };
+  bitboard b{0};
+  for (int i{0}; i < 8; i += 2)
+  {
+    assert(delta_pairs[i].first == 0 || delta_pairs[i].second == 0);
+    b |= get_ray_attacks(
+      tables[i], delta_pairs[i].first, delta_pairs[i].second, s, occupied
+    );
+  }
+  return b;
+}
+
+bool has_square(const bitboard b, const square& s) noexcept
+{
+  return (b & to_bitboard(s)) != 0;
+}
+
+bitboard remove_first_square(const bitboard b) noexcept
+{
+  assert(b != 0);
+  return b & (b - 1);
+}
+
+void test_bitboard()
+{
+#ifndef NDEBUG
+  // count_squares
+  {
+    assert(count_squares(0) == 0);
+    assert(count_squares(to_bitboard(square("e4"))) == 1);
+    assert(count_squares(~bitboard{0}) == 64);
+  }
+  // create_ray_table
+  {
+    const auto table{create_ray_table(1, 0)};
+    assert(count_squares(table[to_index(square("a1"))]) == 7);
+    assert(count_squares(table[to_index(square("a8"))]) == 0);
+  }
+  // get_bishop_attacks
+  {
+    assert(count_squares(get_bishop_attacks(square("a1"), 0)) == 7);
+    assert(count_squares(get_bishop_attacks(square("e4"), 0)) == 13);
+    // Blocked at d5, which is attacked
+    const bitboard occupied{to_bitboard(square("d5"))};
+    const bitboard b{get_bishop_attacks(square("e4"), occupied)};
+    assert(has_square(b, square("d5")));
+    assert(!has_square(b, square("c6")));
+    assert(count_squares(b) == 10);
+  }
+  // get_first_square and get_last_square
+  {
+    const bitboard b{to_bitboard({square("c3"), square("e4"), square("b7")})};
+    assert(get_first_square(b) == square("c3"));
+    assert(get_last_square(b) == square("b7"));
+  }
+  // get_king_attacks
+  {
+    assert(count_squares(get_king_attacks(square("a1"))) == 3);
+    assert(count_squares(get_king_attacks(square("e4"))) == 8);
+    assert(count_squares(get_king_attacks(square("h5"))) == 5);
+  }
+  // get_knight_attacks
+  {
+    assert(count_squares(get_knight_attacks(square("a1"))) == 2);
+    assert(count_squares(get_knight_attacks(square("e4"))) == 8);
+    assert(has_square(get_knight_attacks(square("b1")), square("c3")));
+  }
+  // get_knight_ray_attacks
+  {
+    // b1-c3-d5-e7 and b1-d2-f3-h4 and b1-a3
+    const bitboard b{get_knight_ray_attacks(square("b1"), 0)};
+    assert(has_square(b, square("e7")));
+    assert(has_square(b, square("h4")));
+    assert(count_squares(b) == 7);
+    // Blocked at c3
+    const bitboard blocked{
+      get_knight_ray_attacks(square("b1"), to_bitboard(square("c3")))
+    };
+    assert(has_square(blocked, square("c3")));
+    assert(!has_square(blocked, square("d5")));
+    assert(count_squares(blocked) == 5);
+  }
+  // get_pawn_attacks
+  {
+    const bitboard white{get_pawn_attacks(square("e4"), chess_color::white)};
+    assert(count_squares(white) == 2);
+    assert(has_square(white, square("d5")));
+    assert(has_square(white, square("f5")));
+    const bitboard black{get_pawn_attacks(square("a5"), chess_color::black)};
+    assert(count_squares(black) == 1);
+    assert(has_square(black, square("b4")));
+  }
+  // get_pawn_pushes
+  {
+    assert(count_squares(get_pawn_pushes(square("e2"), chess_color::white, 0)) == 6);
+    assert(count_squares(get_pawn_pushes(square("e7"), chess_color::black, 0)) == 6);
+    const bitboard occupied{to_bitboard(square("e5"))};
+    assert(count_squares(get_pawn_pushes(square("e2"), chess_color::white, occupied)) == 2);
+  }
+  // get_queen_attacks
+  {
+    assert(count_squares(get_queen_attacks(square("d1"), 0)) == 21);
+    assert(count_squares(get_queen_attacks(square("e4"), 0)) == 27);
+  }
+  // get_ray_squares
+  {
+    const auto squares{get_ray_squares(square("e4"), -1, 0)};
+    assert(squares.size() == 3);
+    assert(squares[0] == square("e3"));
+    assert(squares[2] == square("e1"));
+  }
+  // get_rook_attacks
+  {
+    assert(count_squares(get_rook_attacks(square("a1"), 0)) == 14);
+    const bitboard occupied{to_bitboard({square("a3"), square("c1")})};
+    assert(count_squares(get_rook_attacks(square("a1"), occupied)) == 4);
+  }
+  // remove_first_square
+  {
+    const bitboard b{to_bitboard({square("c3"), square("e4")})};
+    assert(remove_first_square(b) == to_bitboard(square("e4")));
+  }
+  // to_bitboard and to_squares
+  {
+    const std::vector<square> squares{square("a1"), square("h8")};
+    const bitboard b{to_bitboard(squares)};
+    assert(b == ((bitboard{1} << 63) | bitboard{1}));
+    assert(to_squares(b) == squares);
+  }
+#endif // NDEBUG
+}
+
+bitboard to_bitboard(const square& s) noexcept
+{
+  return bitboard{1} << to_index(s);
+}
+
+bitboard to_bitboard(const std::vector<square>& squares) noexcept
+{
+  bitboard b{0};
+  for (const auto& s: squares) b |= to_bitboard(s);
+  return b;
+}
+
+std::vector<square> to_squares(const bitboard b)
+{
+  std::vector<square> squares;
+  squares.reserve(count_squares(b));
+  for (bitboard rest{b}; rest != 0; rest = remove_first_square(rest))
+  {
+    squares.push_back(get_first_square(rest));
+  }
+  return squares;
+}
@@ -0,0 +1,113 @@
+#ifndef BITBOARD_H
+#define BITBOARD_H
+
+/// Bitboards: sets of squares stored in 64 bits,
+/// used to generate moves without allocating memory.
+///
+/// Bit 'to_index(s)' is set if square 's' is in the set,
+/// hence bit 0 is a1, bit 1 is b1, bit 8 is a2 and bit 63 is h8.
+
+#include "ccfwd.h"
+#include "chess_color.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+/// A set of squares, where each bit denotes one square
+using bitboard = std::uint64_t;
+
+/// Count the number of squares in a bitboard
+int count_squares(const bitboard b) noexcept;
+
+/// Create the attack table for a king,
+/// i.e. for each square, the adjacent squares
+std::array<bitboard, 64> create_king_attack_table() noexcept;
+
+/// Create the attack table for a knight,
+/// i.e. for each square, the squares a single knight jump away
+std::array<bitboard, 64> create_knight_attack_table() noexcept;
+
+/// Create the attack table for a pawn of a color,
+/// i.e. for each square, the squares diagonally in front
+std::array<bitboard, 64> create_pawn_attack_table(const chess_color color) noexcept;
+
+/// Create, for each square, the squares in a direction,
+/// up to a maximum distance
+std::array<bitboard, 64> create_ray_table(
+  const int dx,
+  const int dy,
+  const int max_distance = 7
+) noexcept;
+
+/// Get all the squares a bishop attacks from a square,
+/// where an occupied square blocks the squares behind it
+bitboard get_bishop_attacks(const square& s, const bitboard occupied) noexcept;
+
+/// Get the first square of a bitboard, i.e. the one with the lowest index.
+/// The bitboard must not be empty
+square get_first_square(const bitboard b) noexcept;
+
+/// Get all the squares a king attacks from a square
+bitboard get_king_attacks(const square& s) noexcept;
+
+/// Get all the squares a knight attacks from a square,
+/// i.e. the squares a single knight jump away
+bitboard get_knight_attacks(const square& s) noexcept;
+
+/// Get all the squares a knight can move to along its half-diagonals,
+/// i.e. repeated knight jumps in the same direction,
+/// where an occupied square blocks the squares behind it
+bitboard get_knight_ray_attacks(const square& s, const bitboard occupied) noexcept;
+
+/// Get the last square of a bitboard, i.e. the one with the highest index.
+/// The bitboard must not be empty
+square get_last_square(const bitboard b) noexcept;
+
+/// Get all the squares a pawn attacks from a square
+bitboard get_pawn_attacks(const square& s, const chess_color color) noexcept;
+
+/// Get all the squares in front of a pawn it can move to,
+/// where an occupied square blocks itself and the squares behind it
+bitboard get_pawn_pushes(
+  const square& s,
+  const chess_color color,
+  const bitboard occupied
+) noexcept;
+
+/// Get all the squares a queen attacks from a square,
+/// where an occupied square blocks the squares behind it
+bitboard get_queen_attacks(const square& s, const bitboard occupied) noexcept;
+
+/// Get all the squares in a direction from a square,
+/// in the order of the distance to that square,
+/// as in \link{collect_all_queen_delta_pairs}
+std::vector<square> get_ray_squares(
+  const square& s,
+  const int dx,
+  const int dy
+);
+
+/// Get all the squares a rook attacks from a square,
+/// where an occupied square blocks the squares behind it
+bitboard get_rook_attacks(const square& s, const bitboard occupied) noexcept;
+
+/// Is the square part of the bitboard?
+bool has_square(const bitboard b, const square& s) noexcept;
+
+/// Remove the first square of a bitboard, i.e. the one with the lowest index
+bitboard remove_first_square(const bitboard b) noexcept;
+
+/// Test these functions
+void test_bitboard();
+
+/// Convert a square to a bitboard with only that square
+bitboard to_bitboard(const square& s) noexcept;
+
+/// Convert squares to a bitboard
+bitboard to_bitboard(const std::vector<square>& squares) noexcept;
+
+/// Convert a bitboard to squares, sorted by index
+std::vector<square> to_squares(const bitboard b);
+
+#endif // BITBOARD_H
@@ -1,2 +1,187 @@
 #include "board.h"
 
+#include "piece.h"
+#include "pieces.h"
+#include "square.h"
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <sstream>
+
+board::board()
+  : m_occupied_by_black{0},
+    m_occupied_by_white{0}
+{
+  m_indices.fill(no_piece);
+}
+
+board::board(const std::vector<piece>& pieces)
+  : board()
+{
+  const int n_pieces{static_cast<int>(pieces.size())};
+  for (int i{0}; i != n_pieces; ++i)
+  {
+    const square& s{pieces[i].get_current_square()};
+    assert(is_empty(s));
+    set_index(s, i, pieces[i].get_color());
+  }
+}
+
+bitboard board::get_occupied() const noexcept
+{
+  return m_occupied_by_black | m_occupied_by_white;
+}
+
+bitboard board::get_occupied(const chess_color color) const noexcept
+{
+  if (color == chess_color::white) return m_occupied_by_white;
+  assert(color == chess_color::black);
+  return m_occupied_by_black;
+}
+
+int board::get_index(const square& s) const noexcept
+{
+  return m_indices[to_index(s)];
+}
+
+bool board::is_empty(const square& s) const noexcept
+{
+  return get_index(s) == no_piece;
+}
+
+void board::move(
+  const int index,
+  const chess_color color,
+  const square& from,
+  const square& to
+) noexcept
+{
+  assert(index != no_piece);
+  if (get_index(from) == index)
+  {
+    m_indices[to_index(from)] = no_piece;
+    if (color == chess_color::white) m_occupied_by_white &= ~to_bitboard(from);
+    else m_occupied_by_black &= ~to_bitboard(from);
+  }
+  set_index(to, index, color);
+}
+
+void board::set_index(
+  const square& s,
+  const int index,
+  const chess_color color
+) noexcept
+{
+  assert(index != no_piece);
+  m_indices[to_index(s)] = index;
+  // A capture overwrites a piece of the other color
+  m_occupied_by_black &= ~to_bitboard(s);
+  m_occupied_by_white &= ~to_bitboard(s);
+  if (color == chess_color::white) m_occupied_by_white |= to_bitboard(s);
+  else m_occupied_by_black |= to_bitboard(s);
+}
+
+int count_occupied_squares(const board& b) noexcept
+{
+  return std::count_if(
+    std::begin(b.get_indices()),
+    std::end(b.get_indices()),
+    [](const int i) { return i != board::no_piece; }
+  );
+}
+
+void test_board()
+{
+#ifndef NDEBUG
+  // board::board
+  {
+    const board b;
+    assert(count_occupied_squares(b) == 0);
+    assert(b.is_empty(square("e4")));
+  }
+  // board::board from pieces
+  {
+    const auto pieces{get_standard_starting_pieces()};
+    const board b(pieces);
+    assert(count_occupied_squares(b) == 32);
+    assert(!b.is_empty(square("e1")));
+    assert(b.is_empty(square("e4")));
+    const int i{b.get_index(square("e1"))};
+    assert(pieces[i].get_current_square() == square("e1"));
+    assert(pieces[i].get_type() == piece_type::king);
+    assert(count_squares(b.get_occupied()) == 32);
+    assert(count_squares(b.get_occupied(chess_color::white)) == 16);
+    assert(has_square(b.get_occupied(chess_color::black), square("e8")));
+  }
+  // board::move
+  {
+    board b;
+    b.set_index(square("e2"), 3, chess_color::white);
+    b.move(3, chess_color::white, square("e2"), square("e4"));
+    assert(b.is_empty(square("e2")));
+    assert(b.get_index(square("e4")) == 3);
+    assert(b.get_occupied(chess_color::white) == to_bitboard(square("e4")));
+  }
+  // board::move does not clear a square occupied by another piece
+  {
+    board b;
+    b.set_index(square("e2"), 3, chess_color::white);
+    b.move(4, chess_color::black, square("e2"), square("e4"));
+    assert(b.get_index(square("e2")) == 3);
+    assert(b.get_index(square("e4")) == 4);
+  }
+  // board::set_index overwrites a piece of the other color
+  {
+    board b;
+    b.set_index(square("d5"), 3, chess_color::black);
+    b.set_index(square("d5"), 4, chess_color::white);
+    assert(b.get_index(square("d5")) == 4);
+    assert(b.get_occupied(chess_color::white) == to_bitboard(square("d5")));
+    assert(b.get_occupied(chess_color::black) == 0);
+    assert(count_squares(b.get_occupied()) == 1);
+  }
+  // operator==
+  {
+    const auto pieces{get_standard_starting_pieces()};
+    const board a(pieces);
+    const board b(pieces);
+    const board c;
+    assert(a == b);
+    assert(!(a == c));
+    assert(a != c);
+  }
+  // operator<<
+  {
+    std::stringstream s;
+    s << board(get_standard_starting_pieces());
+    assert(!s.str().empty());
+  }
+#endif // NDEBUG
+}
+
+bool operator==(const board& lhs, const board& rhs) noexcept
+{
+  return lhs.get_indices() == rhs.get_indices()
+    && lhs.get_occupied(chess_color::black) == rhs.get_occupied(chess_color::black)
+    && lhs.get_occupied(chess_color::white) == rhs.get_occupied(chess_color::white)
+  ;
+}
+
+bool operator!=(const board& lhs, const board& rhs) noexcept
+{
+  return !(lhs == rhs);
+}
+
+std::ostream& operator<<(std::ostream& os, const board& b) noexcept
+{
+  for (int x{0}; x != 8; ++x)
+  {
+    for (int y{0}; y != 8; ++y)
+    {
+      os << (b.is_empty(square(x, y)) ? '.' : '#');
+    }
+    os << '\n';
+  }
+  return os;
+}
@@ -1,5 +1,90 @@
 #ifndef BOARD_H
 #define BOARD_H
 
+#include "bitboard.h"
+#include "ccfwd.h"
+#include "chess_color.h"
+
+#include <array>
+#include <iosfwd>
+#include <vector>
+
+/// The occupancy of the 64 squares of a chessboard.
+///
+/// For each square, the board stores the index of the piece
+/// (in the std::vector<piece> of a \link{game}) that occupies it,
+/// so that a piece can be found at a square in constant time.
+/// It also stores which squares are occupied by each color,
+/// as bitboards, to be used in move generation.
+///
+/// The board is owned by \link{game}, which keeps it up to date
+/// in \link{game::tick}
+class board
+{
+public:
+  /// An empty board
+  board();
+
+  /// Create a board from the pieces
+  explicit board(const std::vector<piece>& pieces);
+
+  /// Get the squares occupied by pieces of both colors
+  bitboard get_occupied() const noexcept;
+
+  /// Get the squares occupied by pieces of a color
+  bitboard get_occupied(const chess_color color) const noexcept;
+
+  /// Get the index of the piece at a square,
+  /// or \link{board::no_piece} if the square is empty
+  int get_index(const square& s) const noexcept;
+
+  /// Is the square empty?
+  bool is_empty(const square& s) const noexcept;
+
+  /// Move the piece with index 'index' from one square to another.
+  /// The 'from' square is only cleared if it was occupied
+  /// by that same piece
+  void move(
+    const int index,
+    const chess_color color,
+    const square& from,
+    const square& to
+  ) noexcept;
+
+  /// Put the piece with index 'index' and color 'color' at a square,
+  /// replacing any piece of either color that was there
+  void set_index(
+    const square& s,
+    const int index,
+    const chess_color color
+  ) noexcept;
+
+  /// The value of a square without a piece
+  static constexpr int no_piece{-1};
+
+  const auto& get_indices() const noexcept { return m_indices; }
+
+private:
+
+  /// For each square (see \link{to_index}), the index of the piece
+  std::array<int, 64> m_indices;
+
+  /// The squares occupied by black pieces
+  bitboard m_occupied_by_black;
+
+  /// The squares occupied by white pieces
+  bitboard m_occupied_by_white;
+};
+
+/// Count the number of occupied squares
+int count_occupied_squares(const board& b) noexcept;
+
+/// Test this class and its free functions
+void test_board();
+
+bool operator==(const board& lhs, const board& rhs) noexcept;
+bool operator!=(const board& lhs, const board& rhs) noexcept;
+
+std::ostream& operator<<(std::ostream& os, const board& b) noexcept;
 
 #endif // BOARD_H
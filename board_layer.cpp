@@ -0,0 +1,91 @@
+#include "board_layer.h"
+
+#ifndef LOGIC_ONLY
+
+#include "game_resources.h"
+#include "game_view_layout.h"
+#include "screen_rect.h"
+#include "sfml_helper.h"
+
+#include <stdexcept>
+
+board_layer::board_layer()
+  : m_is_rendered{false},
+    m_n_renders{0},
+    m_race{race::classic},
+    m_semi_transparent_squares{false},
+    m_show_debug{false}
+{
+
+}
+
+void board_layer::draw(
+  sf::RenderTarget& target,
+  const game_view_layout& layout,
+  game_resources& resources,
+  const race r,
+  const bool show_debug,
+  const bool semi_transparent_squares
+)
+{
+  if (!m_is_rendered
+    || !(m_window_size == layout.get_window_size())
+    || m_race != r
+    || m_show_debug != show_debug
+    || m_semi_transparent_squares != semi_transparent_squares
+  )
+  {
+    m_race = r;
+    m_show_debug = show_debug;
+    m_semi_transparent_squares = semi_transparent_squares;
+    render(layout, resources);
+  }
+  target.draw(sf::Sprite(m_canvas.getTexture()));
+}
+
+void board_layer::render(
+  const game_view_layout& layout,
+  game_resources& resources
+)
+{
+  const screen_coordinat window_size{layout.get_window_size()};
+  if (!(m_window_size == window_size) || !m_is_rendered)
+  {
+    if (!m_canvas.create(window_size.get_x(), window_size.get_y()))
+    {
+      throw std::runtime_error("Cannot create the board layer");
+    }
+    m_window_size = window_size;
+  }
+  m_canvas.clear();
+
+  // The map
+  {
+    sf::RectangleShape sprite;
+    set_rect(sprite, window_size);
+    sprite.setTexture(&get_map(resources, m_race));
+    m_canvas.draw(sprite);
+  }
+  // The panels
+  for (const auto& panel: get_panels(layout, m_show_debug))
+  {
+    sf::RectangleShape rectangle;
+    set_rect(rectangle, panel);
+    rectangle.setFillColor(sf::Color(0, 0, 0, 128));
+    rectangle.setOutlineThickness(1);
+    rectangle.setOutlineColor(sf::Color::White);
+    m_canvas.draw(rectangle);
+  }
+  // The squares
+  show_squares(
+    m_canvas,
+    layout.get_board(),
+    resources,
+    m_semi_transparent_squares
+  );
+  m_canvas.display();
+  m_is_rendered = true;
+  ++m_n_renders;
+}
+
+#endif // LOGIC_ONLY
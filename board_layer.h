@@ -0,0 +1,68 @@
+#ifndef BOARD_LAYER_H
+#define BOARD_LAYER_H
+
+#ifndef LOGIC_ONLY
+
+#include "ccfwd.h"
+#include "race.h"
+#include "screen_coordinat.h"
+
+#include <SFML/Graphics.hpp>
+
+/// The bottom layer of the game's window, that does not change
+/// during a match: the map, the panels and the squares of the board.
+///
+/// This layer is rendered to an off-screen texture only when
+/// the window size, the race or the debug panels change,
+/// and is drawn as one sprite every frame otherwise
+class board_layer
+{
+public:
+  board_layer();
+
+  /// Draw the layer, rendering it again first if it is outdated
+  void draw(
+    sf::RenderTarget& target,
+    const game_view_layout& layout,
+    game_resources& resources,
+    const race r,
+    const bool show_debug,
+    const bool semi_transparent_squares
+  );
+
+  /// Get the number of times the layer has been rendered
+  int get_n_renders() const noexcept { return m_n_renders; }
+
+private:
+
+  /// The texture the layer is rendered to
+  sf::RenderTexture m_canvas;
+
+  /// Has the layer been rendered yet?
+  bool m_is_rendered;
+
+  /// The number of times the layer has been rendered
+  int m_n_renders;
+
+  /// The race of which the map is shown
+  race m_race;
+
+  /// Are the squares semi-transparent?
+  bool m_semi_transparent_squares;
+
+  /// Are the debug panels shown?
+  bool m_show_debug;
+
+  /// The size of the window the layer is rendered for
+  screen_coordinat m_window_size;
+
+  /// Render the map, panels and squares to the off-screen texture
+  void render(
+    const game_view_layout& layout,
+    game_resources& resources
+  );
+};
+
+#endif // LOGIC_ONLY
+
+#endif // BOARD_LAYER_H
@@ -3,20 +3,32 @@
 
 /// Conquer Chess forward declarations
 class action_number;
+class board;
+class board_layer;
 class chess_move;
+class computer_player;
 class delta_t;
+class fixed_timestep;
 class game;
 class game_controller;
 class game_coordinat;
 class game_options;
 class game_rect;
 class game_resources;
+class game_snapshot;
 class game_view;
 class game_view_layout;
 class id;
+class input_recorder;
+class input_recording;
 class key_bindings;
+class keyframed_replay;
 class layout;
 class lobby_options;
+class lockstep;
+class lockstep_connection;
+class lockstep_packet;
+class mapped_file;
 class menu_view;
 class menu_view_layout;
 class message;
@@ -24,15 +36,25 @@ class options_view;
 class options_view_layout;
 class physical_controller;
 class physical_controllers;
+class pgn_reader;
 class piece;
 class piece_action;
+class piece_action_queue;
+class piece_id_table;
 class replay;
+class replay_validation;
 class replayer;
+class resimulation;
+class rollout_statistics;
 class screen_coordinat;
 class screen_rect;
+class simulation;
+class simulation_result;
 class sound_effects;
 class square;
+class texture_atlas;
 class textures;
+class unit_paths_overlay;
 class user_input;
 class user_inputs;
 class volume;
@@ -4,38 +4,130 @@
 #include <cassert>
 #include <iostream>
 #include <regex>
+#include <stdexcept>
 
 
-chess_move::chess_move(std::string s, const chess_color color)
+chess_move::chess_move(const std::string_view pgn_str, const chess_color color)
   : m_color{color},
     m_is_capture{false},
-    m_pgn_str{s}
+    m_pgn_str{pgn_str}
 {
+  if (pgn_str == "1-0")
+  {
+    m_winner = { chess_color::white };
+    return;
+  }
+  if (pgn_str == "0-1")
+  {
+    m_winner = { chess_color::black };
+    return;
+  }
+  if (pgn_str == "1/2-1/2")
+  {
+    m_winner = { chess_color::white, chess_color::black };
+    return;
+  }
+
+  // Remove the annotation, then the check or checkmate,
+  // e.g. 'O-O+' is castling that gives check
+  std::string_view s{pgn_str};
+  if (s.size() >= 2 && s.substr(s.size() - 2) == "??")
+  {
+    s.remove_suffix(2);
+  }
+  else if (!s.empty() && s.back() == '?')
+  {
+    s.remove_suffix(1);
+  }
+  if (!s.empty() && (s.back() == '+' || s.back() == '#'))
+  {
+    s.remove_suffix(1);
+  }
+  if (s == "O-O")
+  {
+    m_castling_type = castling_type::king_side;
+    return;
+  }
+  if (s == "O-O-O")
+  {
+    m_castling_type = castling_type::queen_side;
+    return;
+  }
+
+  // Parse '[BKNQR]?[a-h]?[1-8]?x?[a-h][1-8](=[BKNQR])?'
+  // by hand, as a regex is slow to build and to match
+  const auto is_piece_char{
+    [](const char c) { return c == 'B' || c == 'K' || c == 'N' || c == 'Q' || c == 'R'; }
+  };
+  const auto is_file{[](const char c) { return c >= 'a' && c <= 'h'; }};
+  const auto is_rank{[](const char c) { return c >= '1' && c <= '8'; }};
+  std::optional<piece_type> promotion_type;
+  if (s.size() >= 2 && s[s.size() - 2] == '=' && is_piece_char(s.back()))
+  {
+    promotion_type = to_piece_type(s.back());
+    s.remove_suffix(2);
+  }
+  if (s.size() < 2 || !is_file(s[s.size() - 2]) || !is_rank(s.back())) return;
+  const square to(s.back() - '1', s[s.size() - 2] - 'a');
+  s.remove_suffix(2);
 
-  // Simple 'go to there' move, no 'from'
-  if (std::regex_match(s, std::regex("^[BKNQR]?x?[a-h][1-8](=[BKNQR])?(\\?\\?|\\?|\\+|#)?$")))
+  piece_type type{piece_type::pawn};
+  if (!s.empty() && is_piece_char(s.front()))
   {
-    m_to = get_square(s);
-    m_type = get_piece_type(s);
-    m_is_capture = ::is_capture(s);
-    m_promotion_type = ::get_promotion_type(s);
+    type = to_piece_type(s.front());
+    s.remove_prefix(1);
   }
-  else if (std::regex_match(s, std::regex("^(0-1)|1-0|(1/2-1/2)$")))
+  const bool is_capture{!s.empty() && s.back() == 'x'};
+  if (is_capture) s.remove_suffix(1);
+  // What is left tells apart the pieces that can do the move
+  if (type == piece_type::pawn)
   {
-    m_winner = ::get_winner(s);
+    // Only a capture tells the file of the pawn, e.g. 'exd5'
+    if (!s.empty() && !(s.size() == 1 && is_capture && is_file(s[0]))) return;
+    if (!s.empty()) m_from_file = s[0] - 'a';
   }
-  else if (std::regex_match(s, std::regex("^O-O(-O)?$")))
+  else
   {
-    if (s == "O-O")
+    if (!s.empty() && is_file(s.front()))
+    {
+      m_from_file = s.front() - 'a';
+      s.remove_prefix(1);
+    }
+    if (!s.empty() && is_rank(s.front()))
     {
-      m_castling_type = castling_type::king_side;
+      m_from_rank = s.front() - '1';
+      s.remove_prefix(1);
     }
-    else
+    if (!s.empty())
     {
-      assert(s == "O-O-O");
-      m_castling_type = castling_type::queen_side;
+      m_from_file.reset();
+      m_from_rank.reset();
+      return;
     }
   }
+  m_to = to;
+  m_type = type;
+  m_is_capture = is_capture;
+  m_promotion_type = promotion_type;
+}
+
+ambiguous_move_error::ambiguous_move_error(
+  const chess_move& m,
+  const std::vector<square>& froms
+) : std::invalid_argument(
+      "Move '" + m.get_pgn_str() + "' can be done by the pieces at "
+      + to_str(froms)
+    ),
+    m_froms{froms}
+{
+  assert(froms.size() > 1);
+}
+
+bool can_be_from(const chess_move& m, const square& s) noexcept
+{
+  return (!m.get_from_file() || m.get_from_file().value() == s.get_y())
+    && (!m.get_from_rank() || m.get_from_rank().value() == s.get_x())
+  ;
 }
 
 bool is_capture(const std::string& s)
@@ -47,6 +139,8 @@ bool is_capture(const std::string& s)
 
 square get_from(const game& g, const chess_move& m)
 {
+  // To castle, the king is selected
+  if (is_castling(m)) return get_from_for_king(g, m);
   if (m.get_type().has_value())
   {
     const piece_type pt{m.get_type().value()};
@@ -63,38 +157,44 @@ square get_from(const game& g, const chess_move& m)
         return get_from_for_rook(g, m);
     }
   }
-  assert(!"TODO");
+  throw std::invalid_argument(
+    "Move '" + m.get_pgn_str() + "' is not done by a piece"
+  );
 }
 
 square get_from_for_bishop(const game& g, const chess_move& m)
 {
   assert(m.get_type().has_value());
   assert(m.get_type().value() == piece_type::bishop);
-  const auto pieces{
-    find_pieces(g, piece_type::bishop, m.get_color())
-  };
-  assert(!pieces.empty());
   assert(m.get_to().has_value());
-  const square target{m.get_to().value()};
-  for (const auto& piece: pieces)
-  {
-    if (are_on_same_diagonal(piece.get_current_square(), target))
-    {
-      return piece.get_current_square();
-    }
-  }
-  assert(!"Should not get here: there had to be a bishop on the diagonal");
+  // A bishop at the target square reaches the unblocked bishops
+  return get_from_for_slider(
+    g,
+    m,
+    get_bishop_attacks(m.get_to().value(), g.get_board().get_occupied()),
+    "needs a bishop on the diagonal"
+  );
 }
 
 square get_from_for_king(const game& g, const chess_move& m)
 {
-  assert(m.get_type().has_value());
-  assert(m.get_type().value() == piece_type::king);
+  assert(is_castling(m) || m.get_type().value() == piece_type::king);
   const auto pieces{
     find_pieces(g, piece_type::king, m.get_color())
   };
-  assert(!pieces.empty());
+  if (pieces.empty())
+  {
+    throw std::invalid_argument(
+      "Move '" + m.get_pgn_str() + "' needs a king"
+    );
+  }
   assert(pieces.size() == 1); // There is only 1 king
+  if (!can_be_from(m, pieces[0].get_current_square()))
+  {
+    throw std::invalid_argument(
+      "Move '" + m.get_pgn_str() + "' needs a king on another square"
+    );
+  }
   return pieces[0].get_current_square();
 }
 
@@ -105,85 +205,127 @@ square get_from_for_knight(const game& g, const chess_move& m)
   const auto pieces{
     find_pieces(g, piece_type::knight, m.get_color())
   };
-  assert(!pieces.empty());
   assert(m.get_to().has_value());
   const square target{m.get_to().value()};
 
   for (const auto& piece: pieces)
   {
-    if (are_adjacent_for_knight(piece.get_current_square(), target))
+    if (are_adjacent_for_knight(piece.get_current_square(), target)
+      && can_be_from(m, piece.get_current_square())
+    )
     {
       return piece.get_current_square();
     }
   }
-  assert(!"Should not get here: there had to be a knight a knight's jump away");
+  throw std::invalid_argument(
+    "Move '" + m.get_pgn_str() + "' needs a knight a knight's jump away"
+  );
 }
 
 square get_from_for_pawn(const game& g, const chess_move& m)
 {
   assert(m.get_type().has_value());
   assert(m.get_type().value() == piece_type::pawn);
-  assert(!m.is_capture());
-  const square one_behind{
-    get_behind(m.get_to().value(), m.get_color())
+  assert(m.get_to().has_value());
+  const square to{m.get_to().value()};
+  const int dx{m.get_color() == chess_color::white ? -1 : 1};
+  const auto is_own_pawn_at{
+    [&g, &m](const int x, const int y)
+    {
+      return is_valid_square_xy(x, y)
+        && is_piece_at(g, square(x, y))
+        && get_piece_at(g, square(x, y)).get_type() == piece_type::pawn
+        && get_piece_at(g, square(x, y)).get_color() == m.get_color()
+      ;
+    }
   };
-  if (is_piece_at(g, one_behind))
+  const int x{to.get_x() + dx};
+  if (m.is_capture())
   {
-    assert(get_piece_at(g, one_behind).get_type() == piece_type::pawn);
-    return one_behind;
+    // The file of the pawn tells which pawn captures, e.g. 'e' in 'exd5'.
+    // Without it, the capture must be possible from one side only
+    const bool from_left{
+      is_own_pawn_at(x, to.get_y() - 1)
+      && can_be_from(m, square(x, to.get_y() - 1))
+    };
+    const bool from_right{
+      is_own_pawn_at(x, to.get_y() + 1)
+      && can_be_from(m, square(x, to.get_y() + 1))
+    };
+    if (from_left != from_right)
+    {
+      return square(x, to.get_y() + (from_left ? -1 : 1));
+    }
+    throw std::invalid_argument(
+      "Move '" + m.get_pgn_str() + "' needs one pawn diagonally behind"
+    );
   }
-  const square two_behind{get_behind(one_behind, m.get_color())};
-  assert(is_piece_at(g, two_behind));
-  assert(get_piece_at(g, two_behind).get_type() == piece_type::pawn);
-  return two_behind;
+  if (is_own_pawn_at(x, to.get_y())) return square(x, to.get_y());
+  if (is_valid_square_xy(x, to.get_y())
+    && is_empty(g, square(x, to.get_y()))
+    && is_own_pawn_at(x + dx, to.get_y())
+  )
+  {
+    return square(x + dx, to.get_y());
+  }
+  throw std::invalid_argument(
+    "Move '" + m.get_pgn_str() + "' needs a pawn one or two squares behind"
+  );
 }
 
 square get_from_for_queen(const game& g, const chess_move& m)
 {
   assert(m.get_type().has_value());
   assert(m.get_type().value() == piece_type::queen);
-  const auto pieces{
-    find_pieces(g, piece_type::queen, m.get_color())
-  };
-  assert(!pieces.empty());
   assert(m.get_to().has_value());
-  const square target{m.get_to().value()};
-  for (const auto& piece: pieces)
-  {
-    if (are_on_same_diagonal(piece.get_current_square(), target)
-      || are_on_same_rank(piece.get_current_square(), target)
-      || are_on_same_file(piece.get_current_square(), target)
-    )
-    {
-      return piece.get_current_square();
-    }
-  }
-  assert(!"Should not get here: there had to be a queen on the same rank, file, or diagonal");
+  return get_from_for_slider(
+    g,
+    m,
+    get_queen_attacks(m.get_to().value(), g.get_board().get_occupied()),
+    "needs a queen on the same rank, file, or diagonal"
+  );
 }
 
 square get_from_for_rook(const game& g, const chess_move& m)
 {
   assert(m.get_type().has_value());
   assert(m.get_type().value() == piece_type::rook);
-  const auto pieces{
-    find_pieces(g, piece_type::rook, m.get_color())
-  };
-  assert(!pieces.empty());
   assert(m.get_to().has_value());
-  const square target{m.get_to().value()};
-  for (const auto& piece: pieces)
+  return get_from_for_slider(
+    g,
+    m,
+    get_rook_attacks(m.get_to().value(), g.get_board().get_occupied()),
+    "needs a rook on the same rank or file"
+  );
+}
+
+square get_from_for_slider(
+  const game& g,
+  const chess_move& m,
+  const bitboard reachable,
+  const std::string& reason
+)
+{
+  assert(m.get_type().has_value());
+  std::vector<square> froms;
+  for (const auto& piece: find_pieces(g, m.get_type().value(), m.get_color()))
   {
-    if (are_on_same_rank(piece.get_current_square(), target)
-      || are_on_same_file(piece.get_current_square(), target)
-    )
+    const square& from{piece.get_current_square()};
+    if ((reachable & to_bitboard(from)) && can_be_from(m, from))
     {
-      return piece.get_current_square();
+      froms.push_back(from);
     }
   }
-  assert(!"Should not get here: there had to be a rook on the same rank or file");
+  if (froms.empty())
+  {
+    throw std::invalid_argument(
+      "Move '" + m.get_pgn_str() + "' " + reason
+    );
+  }
+  if (froms.size() > 1) throw ambiguous_move_error(m, froms);
+  return froms[0];
 }
 
-
 piece_type get_piece_type(const std::string& s)
 {
   const std::regex e("[BKNQR]");
@@ -216,6 +358,20 @@ square get_square(const std::string& s)
   return square(m.str());
 }
 
+square get_target_square(const chess_move& m)
+{
+  if (m.get_to().has_value()) return m.get_to().value();
+  if (is_castling(m))
+  {
+    const square king_square{get_default_king_square(m.get_color())};
+    const int dy{m.get_castling_type().value() == castling_type::king_side ? 2 : -2};
+    return square(king_square.get_x(), king_square.get_y() + dy);
+  }
+  throw std::invalid_argument(
+    "Move '" + m.get_pgn_str() + "' is not done by a piece"
+  );
+}
+
 std::vector<chess_color> get_winner(const std::string& s)
 {
   assert(std::regex_match(s, std::regex("^(0-1)|1-0|(1/2-1/2)$")));
@@ -276,12 +432,147 @@ void test_chess_move()
     assert(pgn_str == m.get_pgn_str());
   }
   // Individual functions
+  // can_be_from
+  {
+    assert(can_be_from(chess_move("Nd7", chess_color::black), square("b8")));
+    assert(can_be_from(chess_move("Nbd7", chess_color::black), square("b8")));
+    assert(!can_be_from(chess_move("Nfd7", chess_color::black), square("b8")));
+    assert(can_be_from(chess_move("N8d7", chess_color::black), square("b8")));
+    assert(!can_be_from(chess_move("N6d7", chess_color::black), square("b8")));
+    assert(can_be_from(chess_move("Nb8d7", chess_color::black), square("b8")));
+    assert(!can_be_from(chess_move("Nb6d7", chess_color::black), square("b8")));
+  }
   // get_from: e2-e3
   {
     const game g;
     const chess_move m("e3", chess_color::white);
     assert(get_from(g, m) == square("e2"));
   }
+  // get_from: e2-e4
+  {
+    const game g;
+    const chess_move m("e4", chess_color::white);
+    assert(get_from(g, m) == square("e2"));
+  }
+  // get_from: a pawn capture at the edge of the board
+  {
+    const game g;
+    const chess_move m("bxa3", chess_color::white);
+    assert(get_from(g, m) == square("b2"));
+  }
+  // get_from: the file tells which of two pawns captures
+  {
+    const game g;
+    assert(get_from(g, chess_move("dxe3", chess_color::white)) == square("d2"));
+    assert(get_from(g, chess_move("fxe3", chess_color::white)) == square("f2"));
+  }
+  // get_from: the file or rank tells which of two knights moves
+  {
+    const game g;
+    assert(get_from(g, chess_move("Nb8d7", chess_color::black)) == square("b8"));
+    assert(get_from(g, chess_move("N8d7", chess_color::black)) == square("b8"));
+  }
+  // get_from: castling is done by the king
+  {
+    const game g;
+    assert(get_from(g, chess_move("O-O", chess_color::white)) == square("e1"));
+    assert(get_from(g, chess_move("O-O-O", chess_color::black)) == square("e8"));
+  }
+  // get_from: a rook blocked by another piece cannot do the move
+  {
+    game g;
+    for (const auto s: { "c1", "d1", "e1", "f1", "g1" }) g.remove_piece_at(square(s));
+    // The knight at b1 blocks the rook at a1
+    assert(get_from(g, chess_move("Rd1", chess_color::white)) == square("h1"));
+    g.remove_piece_at(square("b1"));
+    assert(get_from(g, chess_move("Rad1", chess_color::white)) == square("a1"));
+    assert(get_from(g, chess_move("Rhd1", chess_color::white)) == square("h1"));
+  }
+  // get_from: the king at e1 blocks the rook at h1
+  {
+    const game g{get_game_with_starting_position(starting_position_type::ready_to_castle)};
+    assert(get_from(g, chess_move("Rd1", chess_color::white)) == square("a1"));
+    assert(get_from(g, chess_move("Rf1", chess_color::white)) == square("h1"));
+  }
+  // get_from: a bishop or queen blocked by a pawn cannot do the move
+  {
+    game g;
+    for (const auto& m: { chess_move("Bf4", chess_color::white), chess_move("Qh5", chess_color::white) })
+    {
+      bool has_thrown{false};
+      try
+      {
+        get_from(g, m);
+      }
+      catch (const std::invalid_argument&)
+      {
+        has_thrown = true;
+      }
+      assert(has_thrown);
+    }
+    g.remove_piece_at(square("d2"));
+    g.remove_piece_at(square("e2"));
+    assert(get_from(g, chess_move("Bf4", chess_color::white)) == square("c1"));
+    assert(get_from(g, chess_move("Qh5", chess_color::white)) == square("d1"));
+  }
+  // get_from throws an ambiguous_move_error if more pieces can do the move
+  {
+    game g;
+    for (const auto s: { "b1", "c1", "d1", "e1", "f1", "g1" }) g.remove_piece_at(square(s));
+    bool has_thrown{false};
+    try
+    {
+      get_from(g, chess_move("Rd1", chess_color::white));
+    }
+    catch (const ambiguous_move_error& e)
+    {
+      assert(e.get_froms().size() == 2);
+      has_thrown = true;
+    }
+    assert(has_thrown);
+  }
+  // get_from throws if no piece can do the move
+  {
+    const game g;
+    const std::vector<chess_move> moves{
+      chess_move("cxe3", chess_color::white), // No pawn at c2 can capture at e3
+      chess_move("Ngd2", chess_color::white), // The knight at g1 cannot jump to d2
+      chess_move("N1d2", chess_color::black), // No black knight on the first rank
+      chess_move("e5", chess_color::white),
+      chess_move("Nd4", chess_color::white),
+      chess_move("Qh3", chess_color::black),
+      chess_move("1-0", chess_color::white)
+    };
+    for (const auto& m: moves)
+    {
+      bool has_thrown{false};
+      try
+      {
+        get_from(g, m);
+      }
+      catch (const std::invalid_argument&)
+      {
+        has_thrown = true;
+      }
+      assert(has_thrown);
+    }
+  }
+  // get_target_square
+  {
+    assert(get_target_square(chess_move("Nf3", chess_color::white)) == square("f3"));
+    assert(get_target_square(chess_move("O-O", chess_color::white)) == square("g1"));
+    assert(get_target_square(chess_move("O-O-O", chess_color::black)) == square("c8"));
+    bool has_thrown{false};
+    try
+    {
+      get_target_square(chess_move("1/2-1/2", chess_color::white));
+    }
+    catch (const std::invalid_argument&)
+    {
+      has_thrown = true;
+    }
+    assert(has_thrown);
+  }
   // get_winner
   {
     assert(get_winner("0-1").at(0) == chess_color::black);
@@ -295,6 +586,13 @@ void test_chess_move()
     assert(is_castling(chess_move("O-O-O", chess_color::white)));
     assert(is_castling(chess_move("O-O", chess_color::black)));
     assert(is_castling(chess_move("O-O-O", chess_color::black)));
+    // With a check, checkmate or annotation
+    assert(is_castling(chess_move("O-O+", chess_color::white)));
+    assert(is_castling(chess_move("O-O-O#", chess_color::black)));
+    assert(is_castling(chess_move("O-O+?", chess_color::white)));
+    assert(is_castling(chess_move("O-O-O??", chess_color::black)));
+    assert(chess_move("O-O+", chess_color::white).get_castling_type() == castling_type::king_side);
+    assert(chess_move("O-O-O#", chess_color::black).get_castling_type() == castling_type::queen_side);
     assert(!is_castling(chess_move("e4", chess_color::white)));
     assert(!is_castling(chess_move("1-0", chess_color::white)));
     assert(!is_castling(chess_move("1/2-1/2", chess_color::white)));
@@ -410,6 +708,55 @@ void test_chess_move()
     assert(m.get_winner().at(0) == chess_color::white);
     assert(!m.is_capture());
   }
+  // chess_move::chess_move, a promotion is done by a pawn
+  {
+    const chess_move m("e8=Q", chess_color::white);
+    assert(m.get_type().value() == piece_type::pawn);
+    assert(m.get_promotion_type().value() == piece_type::queen);
+    assert(m.get_to().value() == square("e8"));
+  }
+  // chess_move::chess_move, a pawn capture tells the pawn's file
+  {
+    const chess_move m("exd5", chess_color::white);
+    assert(m.get_type().value() == piece_type::pawn);
+    assert(m.get_to().value() == square("d5"));
+    assert(m.is_capture());
+    assert(m.get_from_file().value() == 4);
+    assert(!m.get_from_rank());
+  }
+  // chess_move::chess_move, a simple move tells no file or rank
+  {
+    const chess_move m("Nf3", chess_color::white);
+    assert(!m.get_from_file());
+    assert(!m.get_from_rank());
+  }
+  // chess_move::chess_move, a file, rank or square tells pieces apart
+  {
+    for (const std::string pgn_str: { "Nbd7", "N5d7", "Nb6d7", "Nbxd7+" })
+    {
+      const chess_move m(pgn_str, chess_color::black);
+      assert(m.get_type().value() == piece_type::knight);
+      assert(m.get_to().value() == square("d7"));
+      assert(m.get_pgn_str() == pgn_str);
+    }
+    assert(chess_move("Nbd7", chess_color::black).get_from_file().value() == 1);
+    assert(!chess_move("Nbd7", chess_color::black).get_from_rank());
+    assert(!chess_move("N5d7", chess_color::black).get_from_file());
+    assert(chess_move("N5d7", chess_color::black).get_from_rank().value() == 4);
+    assert(chess_move("Nb6d7", chess_color::black).get_from_file().value() == 1);
+    assert(chess_move("Nb6d7", chess_color::black).get_from_rank().value() == 5);
+  }
+  // chess_move::chess_move, unknown notation gives an empty move
+  {
+    for (const std::string pgn_str: { "", "e9", "i4", "Nf3!", "exd", "bed5", "Kb2c3d4", "e4++" })
+    {
+      const chess_move m(pgn_str, chess_color::white);
+      assert(!m.get_type());
+      assert(!m.get_to());
+      assert(!is_castling(m));
+      assert(m.get_winner().empty());
+    }
+  }
   // operator==
   {
     // On string
@@ -2,10 +2,13 @@
 #define CHESS_MOVE_H
 
 #include <string>
+#include <string_view>
+#include <stdexcept>
 #include <vector>
 #include <optional>
 #include <iosfwd>
 
+#include "bitboard.h"
 #include "castling_type.h"
 #include "piece_type.h"
 #include "square.h"
@@ -15,8 +18,14 @@
 class chess_move
 {
 public:
-  /// Need to now the player's color, e.g. for 'O-O-O' or '1-0'
-  explicit chess_move(std::string pgn_str, const chess_color color);
+  /// Need to now the player's color, e.g. for 'O-O-O' or '1-0'.
+  ///
+  /// Besides simple moves such as 'Nf3', 'Qxf7#' and 'e8=Q',
+  /// this accepts the standard notation that tells pieces apart,
+  /// e.g. 'Nbd7', 'R1e2' and 'exd5',
+  /// where the file and/or rank of the piece's square is stored.
+  /// Unknown notation gives a move without a type or target square
+  explicit chess_move(const std::string_view pgn_str, const chess_color color);
 
   /// Get the castling type.
   /// Will be empty if this move is not a promotion
@@ -25,6 +34,16 @@ public:
   /// Get the color of the player that did this move
   const auto& get_color() const noexcept { return m_color; };
 
+  /// Get the file of the square the piece comes from,
+  /// where 0 is the a-file, e.g. 1 for the 'b' in 'Nbd7'.
+  /// Will be empty if the move does not tell the file
+  const auto& get_from_file() const noexcept { return m_from_file; }
+
+  /// Get the rank of the square the piece comes from,
+  /// where 0 is the first rank, e.g. 4 for the '5' in 'N5d7'.
+  /// Will be empty if the move does not tell the rank
+  const auto& get_from_rank() const noexcept { return m_from_rank; }
+
   /// Get the original PGN string back
   const auto& get_pgn_str() const noexcept { return m_pgn_str; }
 
@@ -59,6 +78,12 @@ private:
 
   chess_color m_color;
 
+  /// The file of the square the piece comes from, if told
+  std::optional<int> m_from_file;
+
+  /// The rank of the square the piece comes from, if told
+  std::optional<int> m_from_rank;
+
   bool m_is_capture;
 
   /// The original PGN string
@@ -80,35 +105,92 @@ private:
 
 };
 
+/// The error that more than one piece can do a move,
+/// e.g. 'Rd1' with unblocked rooks at a1 and h1,
+/// where the move should have been 'Rad1' or 'Rhd1'
+class ambiguous_move_error : public std::invalid_argument
+{
+public:
+  explicit ambiguous_move_error(
+    const chess_move& m,
+    const std::vector<square>& froms
+  );
+
+  /// Get the squares of the pieces that can do the move
+  const auto& get_froms() const noexcept { return m_froms; }
+
+private:
+
+  /// The squares of the pieces that can do the move
+  std::vector<square> m_froms;
+};
+
+/// Can the piece at a square do the move,
+/// as far as the file and rank in the move tell?
+/// E.g. a knight at b8 can do 'Nbd7' and 'Nd7', but not 'Nfd7'
+bool can_be_from(const chess_move& m, const square& s) noexcept;
+
 /// Get the square the piece doing the move came from.
 /// Even with, e.g., castling, it is the king at e1 that
-/// needed to be selected to do that move
+/// needed to be selected to do that move.
+/// Throws a std::invalid_argument if no piece can do the move,
+/// or if the move is not done by a piece, e.g. '1-0'
 square get_from(const game& g, const chess_move& m);
 
-/// Get the square the bishop doing the move came from.
+/// Get the square the bishop doing the move came from,
+/// i.e. the one without pieces on the diagonal in between.
+/// Throws a std::invalid_argument if there is none
+/// and an \link{ambiguous_move_error} if there are more
 square get_from_for_bishop(const game& g, const chess_move& m);
 
 /// Get the square the king doing the move came from.
 /// Even with, e.g., castling for white, it is the king at e1 that
-/// needed to be selected to do that move
+/// needed to be selected to do that move.
+/// Throws a std::invalid_argument if there is none
 square get_from_for_king(const game& g, const chess_move& m);
 
 /// Get the square the knight doing the move came from.
+/// Throws a std::invalid_argument if there is none
 square get_from_for_knight(const game& g, const chess_move& m);
 
-/// Get the square the pawn doing the move came from.
+/// Get the square the pawn doing the move came from,
+/// which, for a capture, is on the file in the move, e.g. 'e' for 'exd5'.
+/// Throws a std::invalid_argument if there is none
 square get_from_for_pawn(const game& g, const chess_move& m);
 
-/// Get the square the queen doing the move came from.
+/// Get the square the queen doing the move came from,
+/// i.e. the one without pieces on the line in between.
+/// Throws a std::invalid_argument if there is none
+/// and an \link{ambiguous_move_error} if there are more
 square get_from_for_queen(const game& g, const chess_move& m);
 
-/// Get the square the rook doing the move came from.
+/// Get the square the rook doing the move came from,
+/// i.e. the one without pieces on the line in between.
+/// Throws a std::invalid_argument if there is none
+/// and an \link{ambiguous_move_error} if there are more
 square get_from_for_rook(const game& g, const chess_move& m);
 
+/// Get the square of the one piece of the move's type and color
+/// that can reach the target square, where 'reachable' are the squares
+/// a piece at the target square can reach.
+/// Throws a std::invalid_argument with the reason if there is none
+/// and an \link{ambiguous_move_error} if there are more
+square get_from_for_slider(
+  const game& g,
+  const chess_move& m,
+  const bitboard reachable,
+  const std::string& reason
+);
+
 /// Get the square from a string
 /// E.g. 'Nc3' will result in 'c3'
 square get_square(const std::string& pgn_str);
 
+/// Get the square the piece doing the move goes to,
+/// which, for castling, is the square the king goes to, e.g. 'g1' for 'O-O'.
+/// Throws a std::invalid_argument if the move is not done by a piece, e.g. '1-0'
+square get_target_square(const chess_move& m);
+
 /// Get a piece type for a string
 /// E.g. 'Nc3' will result in a knight, 'e4' will result in a pawn
 piece_type get_piece_type(const std::string& pgn_str);
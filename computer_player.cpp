@@ -0,0 +1,382 @@
+#include "computer_player.h"
+
+#include "game.h"
+#include "game_controller.h"
+#include "log_ring_buffer.h"
+#include "physical_controllers.h"
+#include "pieces.h"
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <sstream>
+
+computer_player::computer_player(
+  const chess_color color,
+  const std::chrono::microseconds& budget,
+  const delta_t& horizon,
+  const int seed
+) : m_best_score{0.0},
+    m_budget{budget},
+    m_color{color},
+    m_evaluation_time{0.0},
+    m_horizon{horizon},
+    m_n_evaluated{0},
+    m_rng(seed)
+{
+  assert(delta_t(0.0) < m_horizon);
+}
+
+void computer_player::do_move(game_controller& c, const game& g)
+{
+  const side player_side{get_player_side(g, m_color)};
+
+  if (m_selected_action)
+  {
+    // The piece has been selected in an earlier call, do the action
+    const piece_action action{m_selected_action.value()};
+    m_selected_action.reset();
+    if (!is_idle_piece_at(g, m_color, action.get_from())) return;
+    if (!get_piece_at(g, action.get_from()).is_selected()) return;
+    add_user_inputs(c, get_user_inputs_to_do_piece_action(c, action, player_side));
+    return;
+  }
+
+  if (!think(g)) return; // Continue thinking in the next call
+
+  if (!m_best_action) return;
+  const piece_action action{m_best_action.value()};
+  m_best_action.reset();
+  // The game may have changed while thinking
+  if (!is_idle_piece_at(g, m_color, action.get_from())) return;
+  log_message<log_level::debug>(
+    [&](std::ostream& os)
+    {
+      os << g.get_time() << ": computer player doing " << action;
+    }
+  );
+  m_selected_action = action;
+
+  // An already selected piece can do its action in the next call
+  if (get_piece_at(g, action.get_from()).is_selected()) return;
+
+  add_user_inputs(
+    c,
+    get_user_inputs_to_select_piece_at(c, action.get_from(), player_side)
+  );
+}
+
+bool computer_player::think(const game& g)
+{
+  if (m_candidates.empty())
+  {
+    collect_candidate_actions(g, m_color, m_candidates);
+    if (m_candidates.empty()) return true;
+    // Shuffle, so that running out of time does not favor some pieces
+    std::shuffle(std::begin(m_candidates), std::end(m_candidates), m_rng);
+    m_n_evaluated = 0;
+    m_best_action.reset();
+    m_evaluation.reset();
+    // Evaluate all candidates from the same position,
+    // so that their scores can be compared
+    m_root = g;
+  }
+  const int n_candidates{static_cast<int>(m_candidates.size())};
+  const delta_t dt{0.1};
+  const auto start{std::chrono::steady_clock::now()};
+  // Always do one tick, so that a call makes progress with any budget
+  for (int n_ticks{0}; m_n_evaluated != n_candidates; ++n_ticks)
+  {
+    if (n_ticks != 0 && std::chrono::steady_clock::now() - start >= m_budget)
+    {
+      return false;
+    }
+    const piece_action& action{m_candidates[m_n_evaluated]};
+    if (!m_evaluation)
+    {
+      if (!is_idle_piece_at(*m_root, m_color, action.get_from()))
+      {
+        ++m_n_evaluated;
+        continue;
+      }
+      m_evaluation = *m_root;
+      get_piece_at(*m_evaluation, action.get_from()).add_action(action);
+      m_evaluation_time = delta_t(0.0);
+    }
+    // Tick ahead as 'evaluate' does
+    if (m_evaluation_time < m_horizon)
+    {
+      m_evaluation->tick(dt);
+      m_evaluation_time += dt;
+    }
+    if (m_evaluation_time < m_horizon) continue;
+    const double score{evaluate(*m_evaluation, m_color)};
+    m_evaluation.reset();
+    ++m_n_evaluated;
+    if (!m_best_action || score > m_best_score)
+    {
+      m_best_action = action;
+      m_best_score = score;
+    }
+  }
+  m_candidates.clear();
+  m_root.reset();
+  return true;
+}
+
+void collect_candidate_actions(
+  const game& g,
+  const chess_color color,
+  std::vector<piece_action>& actions
+)
+{
+  const auto first{static_cast<std::ptrdiff_t>(actions.size())};
+  collect_all_piece_actions(g, color, actions);
+  const auto new_end{
+    std::remove_if(
+      std::begin(actions) + first,
+      std::end(actions),
+      [&g, color](const piece_action& action)
+      {
+        const auto type{action.get_action_type()};
+        if (type != piece_action_type::move
+          && type != piece_action_type::attack
+          && type != piece_action_type::promote_to_queen
+        )
+        {
+          return true;
+        }
+        return !is_idle_piece_at(g, color, action.get_from());
+      }
+    )
+  };
+  actions.erase(new_end, std::end(actions));
+}
+
+std::vector<computer_player> create_computer_players(const lobby_options& options)
+{
+  std::vector<computer_player> players;
+  for (const auto player_side: { side::lhs, side::rhs })
+  {
+    if (options.is_computer(player_side))
+    {
+      players.push_back(computer_player(options.get_color(player_side)));
+    }
+  }
+  return players;
+}
+
+double evaluate(const game& g, const chess_color color) noexcept
+{
+  double score{0.0};
+  for (const auto& p: g.get_pieces())
+  {
+    const double value{get_material_value(p.get_type()) * get_f_health(p)};
+    score += p.get_color() == color ? value : -value;
+  }
+  return score;
+}
+
+double evaluate(
+  const game& g,
+  const piece_action& action,
+  const delta_t& horizon,
+  const delta_t& dt
+)
+{
+  assert(delta_t(0.0) < dt);
+  game copy{g};
+  get_piece_at(copy, action.get_from()).add_action(action);
+  for (delta_t t{0.0}; t < horizon; t += dt)
+  {
+    copy.tick(dt);
+  }
+  return evaluate(copy, action.get_color());
+}
+
+std::chrono::microseconds get_default_computer_player_budget() noexcept
+{
+  // A quarter of a frame at 60 frames per second
+  return std::chrono::microseconds(4000);
+}
+
+void test_computer_player()
+{
+#ifndef NDEBUG
+  // computer_player::computer_player
+  {
+    const computer_player p(chess_color::black);
+    assert(p.get_color() == chess_color::black);
+    assert(p.get_budget() == get_default_computer_player_budget());
+    assert(!p.get_selected_action());
+    assert(!p.is_thinking());
+  }
+  // collect_candidate_actions
+  {
+    const game g;
+    std::vector<piece_action> actions;
+    collect_candidate_actions(g, chess_color::white, actions);
+    assert(!actions.empty());
+    for (const auto& action: actions)
+    {
+      assert(action.get_color() == chess_color::white);
+    }
+  }
+  // collect_candidate_actions appends
+  {
+    const game g;
+    std::vector<piece_action> actions{get_test_piece_action()};
+    collect_candidate_actions(g, chess_color::black, actions);
+    assert(actions.size() > 1);
+    assert(actions[0] == get_test_piece_action());
+  }
+  // create_computer_players
+  {
+    lobby_options options{create_default_lobby_options()};
+    assert(create_computer_players(options).empty());
+    options.set_is_computer(true, side::rhs);
+    const auto players{create_computer_players(options)};
+    assert(players.size() == 1);
+    assert(players[0].get_color() == options.get_color(side::rhs));
+    options.set_is_computer(true, side::lhs);
+    assert(create_computer_players(options).size() == 2);
+  }
+  // evaluate a game, the standard starting position is equal
+  {
+    const game g;
+    assert(evaluate(g, chess_color::white) == 0.0);
+    assert(evaluate(g, chess_color::black) == 0.0);
+  }
+  // evaluate a game, a gain for one color is a loss for the other
+  {
+    const auto g{get_game_with_starting_position(starting_position_type::queen_end_game)};
+    const double score{evaluate(g, chess_color::white)};
+    assert(score == -evaluate(g, chess_color::black));
+  }
+  // evaluate an action, capturing a pawn is better than moving away
+  {
+    const auto g{get_game_with_starting_position(starting_position_type::before_scholars_mate)};
+    const piece_action capture(
+      chess_color::white, piece_type::queen, piece_action_type::attack, "h5", "f7"
+    );
+    const piece_action retreat(
+      chess_color::white, piece_type::queen, piece_action_type::move, "h5", "h4"
+    );
+    assert(evaluate(g, capture, delta_t(2.0)) > evaluate(g, retreat, delta_t(2.0)));
+  }
+  // evaluate an action does not change the game
+  {
+    const game g;
+    const auto pieces_before{g.get_pieces()};
+    evaluate(g, get_test_piece_action(), delta_t(1.0));
+    assert(g.get_pieces() == pieces_before);
+  }
+  // computer_player::do_move selects a piece, then lets it act
+  {
+    game g;
+    game_controller c{create_two_keyboard_controllers()};
+    computer_player p(chess_color::white, std::chrono::seconds(10));
+    p.do_move(c, g);
+    assert(p.get_selected_action());
+    c.apply_user_inputs_to_game(g);
+    g.tick(delta_t(0.1));
+    assert(count_selected_units(g, chess_color::white) == 1);
+    p.do_move(c, g);
+    assert(!p.get_selected_action());
+    c.apply_user_inputs_to_game(g);
+    g.tick(delta_t(0.1));
+    assert(!is_idle(g));
+  }
+  // computer_player::do_move with no time spreads thinking over calls,
+  // where one call does not even finish one evaluation
+  {
+    const game g;
+    game_controller c{create_two_keyboard_controllers()};
+    computer_player p(chess_color::black, std::chrono::microseconds(0));
+    p.do_move(c, g);
+    assert(p.is_thinking());
+    assert(!p.get_selected_action());
+    int n_calls{1};
+    while (!p.get_selected_action())
+    {
+      p.do_move(c, g);
+      ++n_calls;
+      assert(n_calls < 1000);
+    }
+    std::vector<piece_action> candidates;
+    collect_candidate_actions(g, chess_color::black, candidates);
+    assert(n_calls > 2 * static_cast<int>(candidates.size()));
+  }
+  // computer_player::do_move captures a pawn behind a mouse controller
+  {
+    game g{get_game_with_starting_position(starting_position_type::before_scholars_mate)};
+    game_controller c{create_mouse_keyboard_controllers()};
+    assert(get_physical_controller_type(c, get_player_side(g, chess_color::white))
+      == physical_controller_type::mouse
+    );
+    computer_player p(chess_color::white, std::chrono::seconds(10));
+    p.do_move(c, g);
+    assert(p.get_selected_action());
+    const piece_action action{p.get_selected_action().value()};
+    assert(action.get_action_type() == piece_action_type::attack);
+    const id attacker_id{get_piece_at(g, action.get_from()).get_id()};
+    c.apply_user_inputs_to_game(g);
+    g.tick(delta_t(0.1));
+    p.do_move(c, g);
+    c.apply_user_inputs_to_game(g);
+    tick_until_idle(g);
+    assert(piece_with_id_is_at(g, attacker_id, action.get_to()));
+  }
+  // computer_player::do_move captures a pawn
+  {
+    game g{get_game_with_starting_position(starting_position_type::before_scholars_mate)};
+    game_controller c{create_two_keyboard_controllers()};
+    computer_player p(chess_color::white, std::chrono::seconds(10));
+    p.do_move(c, g);
+    assert(p.get_selected_action());
+    assert(p.get_selected_action()->get_action_type() == piece_action_type::attack);
+  }
+  // computer_player::do_move evaluates all candidates from the same position,
+  // even if the game changes while thinking
+  {
+    const auto g{get_game_with_starting_position(starting_position_type::before_scholars_mate)};
+    game_controller c{create_two_keyboard_controllers()};
+    computer_player expected(chess_color::white, std::chrono::seconds(10));
+    expected.do_move(c, g);
+    assert(expected.get_selected_action());
+    assert(expected.get_selected_action()->get_action_type() == piece_action_type::attack);
+    // Remove the piece the best action attacks,
+    // so that the action is worthless in the changed game
+    game changed{g};
+    changed.remove_piece_at(expected.get_selected_action()->get_to());
+    computer_player p(chess_color::white, std::chrono::microseconds(0));
+    p.do_move(c, g);
+    assert(p.is_thinking());
+    int n_calls{1};
+    while (!p.get_selected_action())
+    {
+      p.do_move(c, changed);
+      ++n_calls;
+      assert(n_calls < 1000);
+    }
+    assert(p.get_selected_action() == expected.get_selected_action());
+  }
+  // operator<<
+  {
+    const computer_player p(chess_color::white);
+    std::stringstream s;
+    s << p;
+    assert(!s.str().empty());
+  }
+#endif // NDEBUG
+}
+
+std::ostream& operator<<(std::ostream& os, const computer_player& p) noexcept
+{
+  os
+    << "Color: " << p.get_color() << '\n'
+    << "Budget: " << p.get_budget().count() << " microseconds\n"
+    << "Horizon: " << p.get_horizon()
+  ;
+  return os;
+}
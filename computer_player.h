@@ -0,0 +1,148 @@
+#ifndef COMPUTER_PLAYER_H
+#define COMPUTER_PLAYER_H
+
+#include "ccfwd.h"
+#include "chess_color.h"
+#include "delta_t.h"
+#include "game.h"
+#include "piece_action.h"
+
+#include <chrono>
+#include <iosfwd>
+#include <optional>
+#include <random>
+#include <vector>
+
+/// Get the default time one call to 'computer_player::do_move' may think,
+/// which is a fraction of the duration of a frame
+std::chrono::microseconds get_default_computer_player_budget() noexcept;
+
+/// A computer opponent, that plays one color in real-time.
+///
+/// It picks the action of one of its idle pieces,
+/// by doing each candidate action in a copy of the game
+/// and ticking that copy ahead in time (see \link{evaluate}),
+/// so that health, partially done moves
+/// and the actions the other pieces are doing are taken into account.
+///
+/// Evaluating the candidates is spread over multiple calls
+/// to \link{computer_player::do_move}, each of which takes at most
+/// the time budget (plus the time of one tick of a copy of the game),
+/// so that the frame rate does not drop.
+/// An evaluation that is not done when the time is up
+/// continues in the next call.
+/// All candidates are evaluated from a copy of the game
+/// as it was when the candidates were collected,
+/// so that their scores are compared fairly.
+/// The chosen action is fed to the \link{game_controller}
+/// as \link{user_inputs}, as if a player with a keyboard did it:
+/// one call selects the piece, the next call lets it do the action.
+class computer_player
+{
+public:
+  explicit computer_player(
+    const chess_color color,
+    const std::chrono::microseconds& budget = get_default_computer_player_budget(),
+    const delta_t& horizon = delta_t(2.0),
+    const int seed = 42
+  );
+
+  /// Think within the time budget and, if done thinking,
+  /// add the user inputs to do the next step of the chosen action
+  void do_move(game_controller& c, const game& g);
+
+  /// Get the maximum time one call to 'do_move' may think
+  const auto& get_budget() const noexcept { return m_budget; }
+
+  /// Get the color this player plays with
+  auto get_color() const noexcept { return m_color; }
+
+  /// Get the time a game is ticked ahead to evaluate an action
+  const auto& get_horizon() const noexcept { return m_horizon; }
+
+  /// Get the action that is done after its piece has been selected
+  const auto& get_selected_action() const noexcept { return m_selected_action; }
+
+  /// Is the player still evaluating the candidate actions?
+  bool is_thinking() const noexcept { return !m_candidates.empty(); }
+
+private:
+
+  /// The best candidate action evaluated so far
+  std::optional<piece_action> m_best_action;
+
+  /// The score of the best candidate action evaluated so far
+  double m_best_score;
+
+  /// The maximum time one call to 'do_move' may think
+  std::chrono::microseconds m_budget;
+
+  /// The candidate actions, in a random order
+  std::vector<piece_action> m_candidates;
+
+  /// The color this player plays with
+  chess_color m_color;
+
+  /// The copy of the game in which the current candidate action is done.
+  /// Empty if no candidate is being evaluated
+  std::optional<game> m_evaluation;
+
+  /// The time the copy of the game has been ticked ahead
+  delta_t m_evaluation_time;
+
+  /// The time a game is ticked ahead to evaluate an action
+  delta_t m_horizon;
+
+  /// The number of candidate actions evaluated
+  int m_n_evaluated;
+
+  /// The copy of the game the candidate actions were collected from,
+  /// in which each candidate is evaluated.
+  /// Empty if the player is not thinking
+  std::optional<game> m_root;
+
+  /// The random number generator, to shuffle the candidates
+  std::default_random_engine m_rng;
+
+  /// The action that is done after its piece has been selected
+  std::optional<piece_action> m_selected_action;
+
+  /// Evaluate candidates until the time budget is used,
+  /// where the time is checked before each tick of an evaluation
+  /// @return true if all candidates have been evaluated
+  bool think(const game& g);
+};
+
+/// Collect the actions the idle pieces of a color can start,
+/// that a computer player considers: moves, attacks
+/// and promoting to a queen. Castling is left out, see FIX_ISSUE_3
+void collect_candidate_actions(
+  const game& g,
+  const chess_color color,
+  std::vector<piece_action>& actions
+);
+
+/// Create a computer player for each player in the lobby
+/// that is set to be a computer, see \link{lobby_options::is_computer}
+std::vector<computer_player> create_computer_players(const lobby_options& options);
+
+/// Evaluate the game for a color: the material value of its pieces,
+/// weighted by their health, minus that of the other color
+double evaluate(const game& g, const chess_color color) noexcept;
+
+/// Evaluate an action for the color doing it,
+/// by doing it in a copy of the game,
+/// then ticking that copy ahead for 'horizon' in steps of 'dt'
+double evaluate(
+  const game& g,
+  const piece_action& action,
+  const delta_t& horizon,
+  const delta_t& dt = delta_t(0.1)
+);
+
+/// Test this class and its free functions
+void test_computer_player();
+
+std::ostream& operator<<(std::ostream& os, const computer_player& p) noexcept;
+
+#endif // COMPUTER_PLAYER_H
@@ -75,6 +75,9 @@ void controls_view::exec()
     )
   );
 
+  // Show the menu once, as it is only shown again after an event
+  show();
+
   while (m_window.isOpen())
   {
     // Process user input and play game until instructed to exit
@@ -139,7 +142,9 @@ bool controls_view::process_events()
 {
   // User interaction
   sf::Event event;
-  while (m_window.pollEvent(event))
+  // Sleep until there is an event, so that an idle menu uses no CPU
+  if (!m_window.waitEvent(event)) return false;
+  do
   {
     if (event.type == sf::Event::Resized)
     {
@@ -220,7 +225,7 @@ bool controls_view::process_events()
     {
       change_selected();
     }
-  }
+  } while (m_window.pollEvent(event));
   return false; // Do not close the window :-)
 }
 
@@ -0,0 +1,47 @@
+#include "copy_on_write.h"
+
+#include <cassert>
+#include <string>
+#include <vector>
+
+void test_copy_on_write()
+{
+#ifndef NDEBUG // no tests in release
+  // basics
+  {
+    const copy_on_write<int> x(314);
+    assert(x.get() == 314);
+    assert(!x.is_shared());
+  }
+  // default
+  {
+    const copy_on_write<std::vector<int>> v;
+    assert(v.get().empty());
+  }
+  // A copy shares the value
+  {
+    const copy_on_write<std::string> s("pi");
+    const copy_on_write<std::string> t(s);
+    assert(s.is_shared());
+    assert(t.is_shared());
+    assert(&s.get() == &t.get());
+  }
+  // Modifying a copy does not change the original
+  {
+    const copy_on_write<std::string> s("pi");
+    copy_on_write<std::string> t(s);
+    t.get_mutable() += "e";
+    assert(s.get() == "pi");
+    assert(t.get() == "pie");
+    assert(!s.is_shared());
+    assert(!t.is_shared());
+  }
+  // Modifying a value that is not shared does not copy it
+  {
+    copy_on_write<std::vector<int>> v;
+    const auto* const before{&v.get()};
+    v.get_mutable().push_back(42);
+    assert(&v.get() == before);
+  }
+#endif
+}
@@ -0,0 +1,42 @@
+#ifndef COPY_ON_WRITE_H
+#define COPY_ON_WRITE_H
+
+#include <memory>
+
+/// A value that is shared between copies,
+/// until one of the copies changes it.
+///
+/// Copying a copy_on_write only copies a pointer,
+/// so that objects with a long history can be copied cheaply.
+/// Copies may be read concurrently from different threads.
+/// A copy must only be changed, using \link{get_mutable},
+/// from one thread, while no other thread uses that same copy
+template <class T>
+class copy_on_write
+{
+public:
+  copy_on_write() : m_value{std::make_shared<T>()} {};
+  copy_on_write(const T& value) : m_value{std::make_shared<T>(value)} {};
+
+  /// Get the value, which may be shared with other copies
+  const T& get() const noexcept { return *m_value; };
+
+  /// Get the value, to modify it.
+  /// If the value is shared, it is copied first
+  T& get_mutable()
+  {
+    if (is_shared()) m_value = std::make_shared<T>(*m_value);
+    return *m_value;
+  };
+
+  /// Is the value shared with other copies?
+  bool is_shared() const noexcept { return m_value.use_count() > 1; };
+
+private:
+  std::shared_ptr<T> m_value;
+};
+
+/// Test our copy_on_write class
+void test_copy_on_write();
+
+#endif // COPY_ON_WRITE_H
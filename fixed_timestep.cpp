@@ -0,0 +1,125 @@
+#include "fixed_timestep.h"
+
+#include "game.h"
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <sstream>
+
+fixed_timestep::fixed_timestep(
+  const int ticks_per_second,
+  const int max_ticks_per_frame
+) : m_accumulated_steps{0.0},
+    m_max_ticks_per_frame{max_ticks_per_frame},
+    m_ticks_per_second{ticks_per_second}
+{
+  assert(m_ticks_per_second > 0);
+  assert(m_max_ticks_per_frame > 0);
+}
+
+void fixed_timestep::add(const double secs) noexcept
+{
+  assert(secs >= 0.0);
+  m_accumulated_steps = std::min(
+    m_accumulated_steps + (secs * m_ticks_per_second),
+    static_cast<double>(m_max_ticks_per_frame)
+  );
+}
+
+bool fixed_timestep::take_step() noexcept
+{
+  if (m_accumulated_steps < 1.0) return false;
+  m_accumulated_steps -= 1.0;
+  return true;
+}
+
+delta_t get_delta_t(const fixed_timestep& t) noexcept
+{
+  return delta_t(t.get_step_secs());
+}
+
+void test_fixed_timestep()
+{
+#ifndef NDEBUG
+  // fixed_timestep::fixed_timestep
+  {
+    const fixed_timestep t;
+    assert(t.get_ticks_per_second() == get_default_ticks_per_second());
+    assert(t.get_max_ticks_per_frame() == get_default_max_ticks_per_frame());
+    assert(t.get_accumulated_secs() == 0.0);
+    assert(t.get_alpha() == 0.0);
+  }
+  // fixed_timestep::take_step without time does nothing
+  {
+    fixed_timestep t;
+    assert(!t.take_step());
+  }
+  // fixed_timestep::take_step hands out the steps
+  {
+    fixed_timestep t(100);
+    t.add(0.025);
+    assert(t.take_step());
+    assert(t.take_step());
+    assert(!t.take_step());
+    assert(t.get_alpha() > 0.49);
+    assert(t.get_alpha() < 0.51);
+  }
+  // fixed_timestep::add caps the number of steps after a long frame
+  {
+    fixed_timestep t(100, 3);
+    t.add(10.0);
+    int n{0};
+    while (t.take_step()) ++n;
+    assert(n == 3);
+  }
+  // get_delta_t
+  {
+    const fixed_timestep t(120);
+    assert(get_delta_t(t) == delta_t(1.0 / 120.0));
+  }
+  // A game ticked in fixed steps does not depend on the frame rate
+  {
+    game a;
+    game b;
+    const piece_action action(chess_color::white, piece_type::knight, piece_action_type::move, "b1", "c3");
+    get_piece_at(a, "b1").add_action(action);
+    get_piece_at(b, "b1").add_action(action);
+    // Powers of two, so that adding up the frame durations is exact
+    fixed_timestep ta(128);
+    fixed_timestep tb(128);
+    // 0.75 second at 32 versus at 128 frames per second
+    for (int i{0}; i != 24; ++i)
+    {
+      ta.add(1.0 / 32.0);
+      while (ta.take_step()) a.tick(get_delta_t(ta));
+    }
+    for (int i{0}; i != 96; ++i)
+    {
+      tb.add(1.0 / 128.0);
+      while (tb.take_step()) b.tick(get_delta_t(tb));
+    }
+    assert(!is_idle(a));
+    assert(a.get_time() == b.get_time());
+    assert(get_hash(a) == get_hash(b));
+    assert(a.get_pieces() == b.get_pieces());
+  }
+  // operator<<
+  {
+    const fixed_timestep t;
+    std::stringstream s;
+    s << t;
+    assert(!s.str().empty());
+  }
+#endif // NDEBUG
+}
+
+std::ostream& operator<<(std::ostream& os, const fixed_timestep& t) noexcept
+{
+  os
+    << t.get_ticks_per_second() << " ticks per second, "
+    << "at most " << t.get_max_ticks_per_frame() << " per frame, "
+    << t.get_accumulated_secs() << " secs accumulated"
+  ;
+  return os;
+}
@@ -0,0 +1,79 @@
+#ifndef FIXED_TIMESTEP_H
+#define FIXED_TIMESTEP_H
+
+#include "delta_t.h"
+
+#include <algorithm>
+#include <iosfwd>
+
+/// Get the default number of fixed ticks per second
+constexpr int get_default_ticks_per_second() noexcept { return 120; }
+
+/// Get the default maximum number of fixed ticks per frame
+constexpr int get_default_max_ticks_per_frame() noexcept { return 8; }
+
+/// An accumulator of real time, that hands it out in fixed steps.
+///
+/// Each frame, the duration of that frame is added,
+/// after which the game is ticked once per step taken.
+/// The time that is left is less than one step,
+/// and is used to interpolate between the last two game states when drawing.
+///
+/// After a long frame, e.g. when dragging the window,
+/// at most 'max_ticks_per_frame' steps are done,
+/// so that catching up does not make the next frame long too
+class fixed_timestep
+{
+public:
+  explicit fixed_timestep(
+    const int ticks_per_second = get_default_ticks_per_second(),
+    const int max_ticks_per_frame = get_default_max_ticks_per_frame()
+  );
+
+  /// Add the real time that has passed, in seconds
+  void add(const double secs) noexcept;
+
+  /// Get the time accumulated and not yet taken, in seconds
+  double get_accumulated_secs() const noexcept { return m_accumulated_steps * get_step_secs(); }
+
+  /// Get the fraction of a step accumulated and not yet taken,
+  /// to interpolate between the last two game states.
+  /// Is 1.0 if another step can be taken
+  double get_alpha() const noexcept { return std::min(1.0, m_accumulated_steps); }
+
+  /// Get the duration of one step, in seconds
+  double get_step_secs() const noexcept { return 1.0 / m_ticks_per_second; }
+
+  /// Get the maximum number of steps that can be accumulated
+  int get_max_ticks_per_frame() const noexcept { return m_max_ticks_per_frame; }
+
+  /// Get the number of steps per second
+  int get_ticks_per_second() const noexcept { return m_ticks_per_second; }
+
+  /// Take one step, if enough time has accumulated
+  /// @return true if a step is taken, i.e. the game must be ticked once
+  bool take_step() noexcept;
+
+private:
+
+  /// The time accumulated and not yet taken, in steps,
+  /// so that taking a step subtracts exactly one
+  double m_accumulated_steps;
+
+  /// The maximum number of steps that can be accumulated
+  int m_max_ticks_per_frame;
+
+  /// The number of steps per second
+  int m_ticks_per_second;
+};
+
+/// Get the delta_t of one step, where one delta_t
+/// equals one second under normal game speed
+delta_t get_delta_t(const fixed_timestep& t) noexcept;
+
+/// Test this class and its free functions
+void test_fixed_timestep();
+
+std::ostream& operator<<(std::ostream& os, const fixed_timestep& t) noexcept;
+
+#endif // FIXED_TIMESTEP_H
@@ -1,6 +1,7 @@
 #include "game.h"
 
 #include "asserts.h"
+#include "bitboard.h"
 #include "game_options.h"
 #include "piece_actions.h"
 #include "game_view_layout.h"
@@ -27,9 +28,11 @@ game::game(
   const lobby_options& lo
 
 )
-  : m_game_options{go},
+  : m_game_options{std::make_shared<const game_options>(go)},
     m_lobby_options{lo},
     m_pieces{get_starting_pieces(go, lo)},
+    m_board{m_pieces},
+    m_piece_ids{std::make_shared<piece_id_table>(m_pieces)},
     m_t{0.0}
 {
 
@@ -286,31 +289,58 @@ action_history collect_action_history(const game& g)
 
 std::vector<piece_action> collect_all_piece_actions(const game& g)
 {
+  std::vector<piece_action> actions;
+  collect_all_piece_actions(g, actions);
+  return actions;
+}
+
+void collect_all_piece_actions(
+  const game& g,
+  std::vector<piece_action>& actions
+)
+{
+  // Only the actions appended here are filtered
+  const auto first{actions.size()};
+
   // 1. Collect all the simple actions,
   //    such as movement and attacks
-  std::vector<piece_action> actions;
   for (const auto& p: g.get_pieces())
   {
-    const auto piece_actions{
-      collect_all_piece_actions(g, p)
-    };
-    std::copy(
-      std::begin(piece_actions),
-      std::end(piece_actions),
-      std::back_inserter(actions)
-    );
+    collect_all_piece_actions(g, p, actions);
   }
   // 2. collect all attacked squares
-  std::vector<std::pair<square, chess_color>> attacked_squares{
-    collect_attacked_squares(actions)
+  bitboard attacked_by_black{0};
+  bitboard attacked_by_white{0};
+  for (auto i{first}; i != actions.size(); ++i)
+  {
+    const auto& action{actions[i]};
+    if (action.get_action_type() != piece_action_type::move) continue;
+    if (action.get_color() == chess_color::white)
+    {
+      attacked_by_white |= to_bitboard(action.get_to());
+    }
+    else
+    {
+      attacked_by_black |= to_bitboard(action.get_to());
+    }
+  }
+  const auto is_attacked_by = [attacked_by_black, attacked_by_white](
+    const square& s,
+    const chess_color enemy_color
+  )
+  {
+    return has_square(
+      enemy_color == chess_color::white ? attacked_by_white : attacked_by_black,
+      s
+    );
   };
 
   // 3. Prevent king moving into or through (by castling) check
   const auto new_end{
     std::remove_if(
-      std::begin(actions),
+      std::begin(actions) + first,
       std::end(actions),
-      [attacked_squares](const piece_action& action)
+      [is_attacked_by](const piece_action& action)
       {
         if (action.get_action_type() == piece_action_type::move)
         {
@@ -318,7 +348,7 @@ std::vector<piece_action> collect_all_piece_actions(const game& g)
           {
             // King cannot move into check
             const chess_color enemy_color{get_other_color(action.get_color())};
-            return is_square_attacked_by(attacked_squares, action.get_to(), enemy_color);
+            return is_attacked_by(action.get_to(), enemy_color);
           }
         }
         else if (action.get_action_type() == piece_action_type::castle_kingside)
@@ -327,8 +357,8 @@ std::vector<piece_action> collect_all_piece_actions(const game& g)
           const chess_color enemy_color{get_other_color(action.get_color())};
           const square f_pawn_square{square(king_square.get_x(), 5)};
           const square g_pawn_square{square(king_square.get_x(), 6)};
-          return is_square_attacked_by(attacked_squares, f_pawn_square, enemy_color)
-            || is_square_attacked_by(attacked_squares, g_pawn_square, enemy_color)
+          return is_attacked_by(f_pawn_square, enemy_color)
+            || is_attacked_by(g_pawn_square, enemy_color)
           ;
         }
         else if (action.get_action_type() == piece_action_type::castle_queenside)
@@ -338,9 +368,9 @@ std::vector<piece_action> collect_all_piece_actions(const game& g)
           const square b_pawn_square{square(king_square.get_x(), 1)};
           const square c_pawn_square{square(king_square.get_x(), 2)};
           const square d_pawn_square{square(king_square.get_x(), 3)};
-          return is_square_attacked_by(attacked_squares, b_pawn_square, enemy_color)
-            || is_square_attacked_by(attacked_squares, c_pawn_square, enemy_color)
-            || is_square_attacked_by(attacked_squares, d_pawn_square, enemy_color)
+          return is_attacked_by(b_pawn_square, enemy_color)
+            || is_attacked_by(c_pawn_square, enemy_color)
+            || is_attacked_by(d_pawn_square, enemy_color)
           ;
         }
         return false;
@@ -352,8 +382,6 @@ std::vector<piece_action> collect_all_piece_actions(const game& g)
   // Prevent opening up a pin
 
   // If king is attacked, only moves that break check are possible
-
-  return actions;
 }
 
 std::vector<piece_action> collect_all_piece_actions(
@@ -361,128 +389,146 @@ std::vector<piece_action> collect_all_piece_actions(
   const chess_color player_color)
 {
   std::vector<piece_action> actions;
+  collect_all_piece_actions(g, player_color, actions);
+  return actions;
+}
+
+void collect_all_piece_actions(
+  const game& g,
+  const chess_color player_color,
+  std::vector<piece_action>& actions
+)
+{
   for (const auto& p: g.get_pieces())
   {
     if (p.get_color() != player_color) continue;
-    const auto piece_actions{
-      collect_all_piece_actions(g, p)
-    };
-    std::copy(
-      std::begin(piece_actions),
-      std::end(piece_actions),
-      std::back_inserter(actions)
-    );
+    collect_all_piece_actions(g, p, actions);
   }
-  return actions;
 }
 
 std::vector<piece_action> collect_all_piece_actions(
   const game& g,
   const piece& p
 )
+{
+  std::vector<piece_action> actions;
+  collect_all_piece_actions(g, p, actions);
+  return actions;
+}
+
+void collect_all_piece_actions(
+  const game& g,
+  const piece& p,
+  std::vector<piece_action>& actions
+)
 {
   switch (p.get_type())
   {
     case piece_type::bishop:
-      return collect_all_bishop_actions(g, p);
+      return collect_all_bishop_actions(g, p, actions);
     case piece_type::king:
-      return collect_all_king_actions(g, p);
+      return collect_all_king_actions(g, p, actions);
     case piece_type::knight:
-      return collect_all_knight_actions(g, p);
+      return collect_all_knight_actions(g, p, actions);
     case piece_type::pawn:
-      return collect_all_pawn_actions(g, p);
+      return collect_all_pawn_actions(g, p, actions);
     case piece_type::queen:
-      return collect_all_queen_actions(g, p);
+      return collect_all_queen_actions(g, p, actions);
     case piece_type::rook:
     default:
       assert(p.get_type() == piece_type::rook);
-      return collect_all_rook_actions(g, p);
+      return collect_all_rook_actions(g, p, actions);
   }
 }
 
-std::vector<piece_action> collect_all_bishop_actions(
+std::vector<piece_action> collect_all_piece_actions_to(
   const game& g,
-  const piece& p
+  const piece& p,
+  const bitboard targets
 )
 {
   std::vector<piece_action> actions;
+  collect_all_piece_actions_to(g, p, targets, actions);
+  return actions;
+}
+
+void collect_all_piece_actions_to(
+  const game& g,
+  const piece& p,
+  const bitboard targets,
+  std::vector<piece_action>& actions
+)
+{
   const auto type{p.get_type()};
-  assert(type == piece_type::bishop);
   const auto color{p.get_color()};
   const auto& from{p.get_current_square()};
-  const auto enemy_color{get_other_color(color)};
-  const std::vector<std::vector<square>> targetses{
-    collect_all_bishop_target_squares(from)
-  };
-  for (const std::vector<square>& targets: targetses)
+  const bitboard enemies{g.get_board().get_occupied(get_other_color(color))};
+  const bitboard moves{targets & ~g.get_board().get_occupied()};
+  const bitboard attacks{targets & enemies};
+  for (bitboard b{moves}; b != 0; b = remove_first_square(b))
   {
-    for (const square& to: targets)
-    {
-      if (is_empty(g, to))
-      {
-        actions.push_back(
-          piece_action(
-            color, type, piece_action_type::move, from, to
-          )
-        );
-      }
-      else if (get_piece_at(g, to).get_color() == enemy_color)
-      {
-        actions.push_back(
-          piece_action(
-            color, type, piece_action_type::attack, from, to
-          )
-        );
-        // Nothing to be done behind an enemy piece
-        break;
-      }
-      else
-      {
-        // Cannot capture own piece
-        break;
-      }
-    }
+    actions.push_back(
+      piece_action(
+        color, type, piece_action_type::move, from, get_first_square(b)
+      )
+    );
   }
+  for (bitboard b{attacks}; b != 0; b = remove_first_square(b))
+  {
+    actions.push_back(
+      piece_action(
+        color, type, piece_action_type::attack, from, get_first_square(b)
+      )
+    );
+  }
+}
+
+std::vector<piece_action> collect_all_bishop_actions(
+  const game& g,
+  const piece& p
+)
+{
+  std::vector<piece_action> actions;
+  collect_all_bishop_actions(g, p, actions);
   return actions;
 }
 
+void collect_all_bishop_actions(
+  const game& g,
+  const piece& p,
+  std::vector<piece_action>& actions
+)
+{
+  assert(p.get_type() == piece_type::bishop);
+  collect_all_piece_actions_to(
+    g,
+    p,
+    get_bishop_attacks(p.get_current_square(), g.get_board().get_occupied()),
+    actions
+  );
+}
+
 std::vector<piece_action> collect_all_king_actions(
   const game& g,
   const piece& p
 )
 {
   std::vector<piece_action> actions;
+  collect_all_king_actions(g, p, actions);
+  return actions;
+}
+
+void collect_all_king_actions(
+  const game& g,
+  const piece& p,
+  std::vector<piece_action>& actions
+)
+{
   const auto type{p.get_type()};
   assert(type == piece_type::king);
   const auto color{p.get_color()};
   const auto& from{p.get_current_square()};
-  const std::vector<square> targets{
-    collect_all_king_target_squares(from)
-  };
-  for (const square& to: targets)
-  {
-    if (is_empty(g, to))
-    {
-      actions.push_back(
-        piece_action(
-          color, type, piece_action_type::move, from, to
-        )
-      );
-    }
-    else
-    {
-      const auto enemy_color{get_other_color(color)};
-      assert(is_piece_at(g, to));
-      if (get_piece_at(g, to).get_color() == enemy_color)
-      {
-        actions.push_back(
-          piece_action(
-            color, type, piece_action_type::attack, from, to
-          )
-        );
-      }
-    }
-  }
+  collect_all_piece_actions_to(g, p, get_king_attacks(from), actions);
   if (can_castle_kingside(p, g))
   {
     const square to{
@@ -507,7 +553,6 @@ std::vector<piece_action> collect_all_king_actions(
       )
     );
   }
-  return actions;
 }
 
 std::vector<piece_action> collect_all_knight_actions(
@@ -516,58 +561,45 @@ std::vector<piece_action> collect_all_knight_actions(
 )
 {
   std::vector<piece_action> actions;
-  const auto type{p.get_type()};
-  assert(type == piece_type::knight);
-  const auto color{p.get_color()};
-  const auto& from{p.get_current_square()};
-  const std::vector<square> targets{
-    collect_all_knight_target_squares(from)
-  };
-  for (const square& to: targets)
-  {
-    if (is_empty(g, to))
-    {
-      actions.push_back(
-        piece_action(
-          color, type, piece_action_type::move, from, to
-        )
-      );
-    }
-    else
-    {
-      const auto enemy_color{get_other_color(color)};
-      assert(is_piece_at(g, to));
-      if (get_piece_at(g, to).get_color() == enemy_color)
-      {
-        actions.push_back(
-          piece_action(
-            color, type, piece_action_type::attack, from, to
-          )
-        );
-      }
-    }
-  }
+  collect_all_knight_actions(g, p, actions);
   return actions;
 }
 
+void collect_all_knight_actions(
+  const game& g,
+  const piece& p,
+  std::vector<piece_action>& actions
+)
+{
+  assert(p.get_type() == piece_type::knight);
+  collect_all_piece_actions_to(
+    g,
+    p,
+    get_knight_attacks(p.get_current_square()),
+    actions
+  );
+}
+
 std::vector<piece_action> collect_all_pawn_actions(
   const game& g,
   const piece& p
 )
 {
   std::vector<piece_action> actions;
-  const auto type{p.get_type()};
-  assert(type == piece_type::pawn);
-  const auto move_actions{collect_all_pawn_move_actions(g, p)};
-  const auto attack_actions{collect_all_pawn_attack_actions(g, p)};
-  const auto en_passant_actions{collect_all_pawn_en_passant_actions(g, p)};
-  return concatenate(
-    concatenate(
-      move_actions,
-      attack_actions
-    ),
-    en_passant_actions
-  );
+  collect_all_pawn_actions(g, p, actions);
+  return actions;
+}
+
+void collect_all_pawn_actions(
+  const game& g,
+  const piece& p,
+  std::vector<piece_action>& actions
+)
+{
+  assert(p.get_type() == piece_type::pawn);
+  collect_all_pawn_move_actions(g, p, actions);
+  collect_all_pawn_attack_actions(g, p, actions);
+  collect_all_pawn_en_passant_actions(g, p, actions);
 }
 
 std::vector<piece_action> collect_all_pawn_attack_actions(
@@ -576,6 +608,16 @@ std::vector<piece_action> collect_all_pawn_attack_actions(
 )
 {
   std::vector<piece_action> actions;
+  collect_all_pawn_attack_actions(g, p, actions);
+  return actions;
+}
+
+void collect_all_pawn_attack_actions(
+  const game& g,
+  const piece& p,
+  std::vector<piece_action>& actions
+)
+{
   const auto type{p.get_type()};
   assert(type == piece_type::pawn);
   const auto& s{p.get_current_square()};
@@ -633,7 +675,6 @@ std::vector<piece_action> collect_all_pawn_attack_actions(
       }
     }
   }
-  return actions;
 }
 
 std::vector<piece_action> collect_all_pawn_en_passant_actions(
@@ -642,6 +683,16 @@ std::vector<piece_action> collect_all_pawn_en_passant_actions(
 )
 {
   std::vector<piece_action> actions;
+  collect_all_pawn_en_passant_actions(g, p, actions);
+  return actions;
+}
+
+void collect_all_pawn_en_passant_actions(
+  const game& g,
+  const piece& p,
+  std::vector<piece_action>& actions
+)
+{
   const auto type{p.get_type()};
   assert(type == piece_type::pawn);
   const auto& s{p.get_current_square()};
@@ -652,7 +703,7 @@ std::vector<piece_action> collect_all_pawn_en_passant_actions(
   const auto enemy_color{get_other_color(color)};
   if (color == chess_color::black)
   {
-    if (x != 3) return {};
+    if (x != 3) return;
     if (y > 0)
     {
       const square to_square{square(x - 1, y - 1)};
@@ -683,7 +734,7 @@ std::vector<piece_action> collect_all_pawn_en_passant_actions(
   else
   {
     assert(color == chess_color::white);
-    if (x != 4) return {};
+    if (x != 4) return;
     if (y > 0)
     {
       const square to_square{square(x + 1, y - 1)};
@@ -694,7 +745,9 @@ std::vector<piece_action> collect_all_pawn_en_passant_actions(
         && has_just_double_moved(get_piece_at(g, enemy_square), g.get_time())
       )
       {
+        #ifdef FIX_ISSUE_21
         assert(!"YAY, triggered en-passant for FIX_ISSUE_21");
+        #endif // FIX_ISSUE_21
         actions.push_back(piece_action(color, type, piece_action_type::en_passant, from, to_square));
       }
     }
@@ -708,12 +761,13 @@ std::vector<piece_action> collect_all_pawn_en_passant_actions(
         && has_just_double_moved(get_piece_at(g, enemy_square), g.get_time())
       )
       {
+        #ifdef FIX_ISSUE_21
         assert(!"YAY");
+        #endif // FIX_ISSUE_21
         actions.push_back(piece_action(color, type, piece_action_type::en_passant, from, to_square));
       }
     }
   }
-  return actions;
 }
 
 
@@ -723,6 +777,16 @@ std::vector<piece_action> collect_all_pawn_move_actions(
 )
 {
   std::vector<piece_action> actions;
+  collect_all_pawn_move_actions(g, p, actions);
+  return actions;
+}
+
+void collect_all_pawn_move_actions(
+  const game& g,
+  const piece& p,
+  std::vector<piece_action>& actions
+)
+{
   const auto type{p.get_type()};
   assert(type == piece_type::pawn);
   const auto& s{p.get_current_square()};
@@ -837,7 +901,6 @@ std::vector<piece_action> collect_all_pawn_move_actions(
       }
     }
   }
-  return actions;
 }
 
 std::vector<piece_action> collect_all_queen_actions(
@@ -846,92 +909,50 @@ std::vector<piece_action> collect_all_queen_actions(
 )
 {
   std::vector<piece_action> actions;
-  const auto type{p.get_type()};
-  assert(type == piece_type::queen);
-  const auto color{p.get_color()};
-  const auto& from{p.get_current_square()};
-  const auto enemy_color{get_other_color(color)};
-  const std::vector<std::vector<square>> targetses{
-    collect_all_queen_target_squares(from)
-  };
-  for (const std::vector<square>& targets: targetses)
-  {
-    for (const square& to: targets)
-    {
-      if (is_empty(g, to))
-      {
-        actions.push_back(
-          piece_action(
-            color, type, piece_action_type::move, from, to
-          )
-        );
-      }
-      else if (get_piece_at(g, to).get_color() == enemy_color)
-      {
-        actions.push_back(
-          piece_action(
-            color, type, piece_action_type::attack, from, to
-          )
-        );
-        // Nothing to be done behind an enemy piece
-        break;
-      }
-      else
-      {
-        // Cannot capture own piece
-        break;
-      }
-    }
-  }
+  collect_all_queen_actions(g, p, actions);
   return actions;
 }
 
+void collect_all_queen_actions(
+  const game& g,
+  const piece& p,
+  std::vector<piece_action>& actions
+)
+{
+  assert(p.get_type() == piece_type::queen);
+  collect_all_piece_actions_to(
+    g,
+    p,
+    get_queen_attacks(p.get_current_square(), g.get_board().get_occupied()),
+    actions
+  );
+}
+
 std::vector<piece_action> collect_all_rook_actions(
   const game& g,
   const piece& p
 )
 {
   std::vector<piece_action> actions;
-  const auto type{p.get_type()};
-  assert(type == piece_type::rook);
-  const auto color{p.get_color()};
-  const auto& from{p.get_current_square()};
-  const auto enemy_color{get_other_color(color)};
-  const std::vector<std::vector<square>> targetses{
-    collect_all_rook_target_squares(from)
-  };
-  for (const std::vector<square>& targets: targetses)
-  {
-    for (const square& to: targets)
-    {
-      if (is_empty(g, to))
-      {
-        actions.push_back(
-          piece_action(
-            color, type, piece_action_type::move, from, to
-          )
-        );
-      }
-      else if (get_piece_at(g, to).get_color() == enemy_color)
-      {
-        actions.push_back(
-          piece_action(
-            color, type, piece_action_type::attack, from, to
-          )
-        );
-        // Nothing to be done behind an enemy piece
-        break;
-      }
-      else
-      {
-        // Cannot capture own piece
-        break;
-      }
-    }
-  }
+  collect_all_rook_actions(g, p, actions);
   return actions;
 }
 
+void collect_all_rook_actions(
+  const game& g,
+  const piece& p,
+  std::vector<piece_action>& actions
+)
+{
+  assert(p.get_type() == piece_type::rook);
+  collect_all_piece_actions_to(
+    g,
+    p,
+    get_rook_attacks(p.get_current_square(), g.get_board().get_occupied()),
+    actions
+  );
+}
+
 int count_piece_actions(const game& g)
 {
   return count_piece_actions(g, chess_color::white)
@@ -1123,6 +1144,16 @@ game get_game_with_starting_position(starting_position_type t) noexcept
   return game(options);
 }
 
+std::uint64_t get_hash(const game& g) noexcept
+{
+  std::uint64_t hash{0};
+  for (const auto& p: g.get_pieces())
+  {
+    hash ^= get_hash(p);
+  }
+  return hash;
+}
+
 read_only<id> get_id(const game& g, const square& s)
 {
   assert(is_piece_at(g, s));
@@ -1199,12 +1230,22 @@ piece& get_piece_that_moves(game& g, const chess_move& move)
 }
 
 
-piece get_piece_with_id(
+const piece& get_piece_with_id(
   const game& g,
   const id& i
 )
 {
-  return get_piece_with_id(g.get_pieces(), i);
+  assert(has_piece_with_id(g, i));
+  return g.get_pieces()[g.get_piece_ids().get_index(i)];
+}
+
+piece& get_piece_with_id(
+  game& g,
+  const id& i
+)
+{
+  assert(has_piece_with_id(g, i));
+  return g.get_pieces()[g.get_piece_ids().get_index(i)];
 }
 
 
@@ -1280,13 +1321,14 @@ std::vector<message> collect_messages(const game& g) noexcept
 
 const piece& get_piece_at(const game& g, const square& coordinat)
 {
-  return get_piece_at(g.get_pieces(), coordinat);
+  assert(is_piece_at(g, coordinat));
+  return g.get_pieces()[g.get_board().get_index(coordinat)];
 }
 
 piece& get_piece_at(game& g, const square& coordinat)
 {
   assert(is_piece_at(g, coordinat));
-  return get_piece_at(g.get_pieces(), coordinat);
+  return g.get_pieces()[g.get_board().get_index(coordinat)];
 }
 
 piece& get_piece_at(game& g, const std::string& square_str)
@@ -1304,6 +1346,24 @@ const delta_t& get_time(const game& g) noexcept
   return g.get_time();
 }
 
+std::optional<chess_color> get_winner(const game& g) noexcept
+{
+  const auto& pieces{g.get_pieces()};
+  const bool has_black_king{
+    get_occupied_bitboard(pieces, chess_color::black, piece_type::king) != 0
+  };
+  const bool has_white_king{
+    get_occupied_bitboard(pieces, chess_color::white, piece_type::king) != 0
+  };
+  if (has_black_king == has_white_king) return {};
+  return has_white_king ? chess_color::white : chess_color::black;
+}
+
+bool has_piece_with_id(const game& g, const id& i) noexcept
+{
+  return g.get_piece_ids().has_id(i);
+}
+
 bool has_selected_pieces(const game& g, const chess_color player)
 {
   return !get_selected_pieces(g, player).empty();
@@ -1328,7 +1388,7 @@ std::vector<piece> get_starting_pieces(
 
 bool is_empty(const game& g, const square& s) noexcept
 {
-  return !is_piece_at(g, s);
+  return g.get_board().is_empty(s);
 }
 
 bool is_empty_between(
@@ -1365,6 +1425,17 @@ bool is_idle(const game& g) noexcept
   return count_piece_actions(g) == 0;
 }
 
+bool is_idle_piece_at(
+  const game& g,
+  const chess_color color,
+  const square& s
+) noexcept
+{
+  if (!is_piece_at(g, s)) return false;
+  const piece& p{get_piece_at(g, s)};
+  return p.get_color() == color && !has_actions(p);
+}
+
 bool is_piece_at(
   const game& g,
   const game_coordinat& coordinat,
@@ -1377,7 +1448,7 @@ bool is_piece_at(
   const game& g,
   const square& coordinat
 ) {
-  return is_piece_at(g.get_pieces(), coordinat);
+  return !g.get_board().is_empty(coordinat);
 }
 
 bool is_piece_at(
@@ -1388,35 +1459,77 @@ bool is_piece_at(
 }
 
 bool piece_with_id_is_at(
-  game& g,
+  const game& g,
   const id& i,
   const square& s
 )
 {
-  assert(is_piece_at(g, s));
-  return get_piece_at(g, s).get_id() == i;
+  return has_piece_with_id(g, i)
+    && get_piece_with_id(g, i).get_current_square() == s
+  ;
 }
 
 
 
 
+void game::remove_piece_at(const square& s)
+{
+  assert(is_piece_at(*this, s));
+  const int i{m_board.get_index(s)};
+  m_pieces.erase(std::begin(m_pieces) + i);
+  // The indices of the pieces have changed
+  m_board = board(m_pieces);
+  m_piece_ids = std::make_shared<piece_id_table>(m_pieces);
+}
+
 void game::tick(const delta_t& dt)
 {
   assert(count_dead_pieces(m_pieces) == 0);
+  assert(m_board == board(m_pieces));
+  assert(*m_piece_ids == piece_id_table(m_pieces));
 
   // Do those piece_actions
-  for (auto& p: m_pieces) p.tick(dt, *this);
+  const int n_pieces{static_cast<int>(m_pieces.size())};
+  bool has_kills{false};
+  for (int i{0}; i != n_pieces; ++i)
+  {
+    piece& p{m_pieces[i]};
+    if (!has_actions(p))
+    {
+      p.tick(dt, *this); // Only keeps track of the time
+      continue;
+    }
+    const square from{p.get_current_square()};
+    const int kill_count{p.get_kill_count()};
+    p.tick(dt, *this);
+    // Keep the board up to date
+    if (p.get_current_square() != from)
+    {
+      m_board.move(i, p.get_color(), from, p.get_current_square());
+    }
+    // Pieces only die by being killed
+    if (p.get_kill_count() != kill_count) has_kills = true;
+  }
 
-  // Remove dead pieces
-  m_pieces.erase(
-    std::remove_if(
-      std::begin(m_pieces),
-      std::end(m_pieces),
-      [](const auto& p) { return is_dead(p); }
-    ),
-    std::end(m_pieces)
-  );
+  // Remove dead pieces, which is only needed after a kill
+  if (has_kills)
+  {
+    const auto new_end{
+      std::remove_if(
+        std::begin(m_pieces),
+        std::end(m_pieces),
+        [](const auto& p) { return is_dead(p); }
+      )
+    };
+    assert(new_end != std::end(m_pieces));
+    m_pieces.erase(new_end, std::end(m_pieces));
+    // The indices of the pieces have changed
+    m_board = board(m_pieces);
+    m_piece_ids = std::make_shared<piece_id_table>(m_pieces);
+  }
   assert(count_dead_pieces(m_pieces) == 0);
+  assert(m_board == board(m_pieces));
+  assert(*m_piece_ids == piece_id_table(m_pieces));
 
   // Keep track of the time
   m_t += dt;
@@ -1,12 +1,16 @@
 #ifndef GAME_H
 #define GAME_H
 
+#include "board.h"
 #include "game_options.h"
+#include "piece_id_table.h"
 #include "pieces.h"
 #include "message.h"
 #include "lobby_options.h"
 
+#include <cstdint>
 #include <iosfwd>
+#include <memory>
 #include <optional>
 #include <vector>
 
@@ -25,13 +29,21 @@ public:
     const lobby_options& lo = create_default_lobby_options()
   );
 
+  /// Get the board, i.e. which piece is at which square
+  const auto& get_board() const noexcept { return m_board; }
+
   /// Get the game options
-  const auto& get_game_options() const noexcept { return m_game_options; }
+  const auto& get_game_options() const noexcept { return *m_game_options; }
 
   /// Get the game options
   const auto& get_lobby_options() const noexcept { return m_lobby_options; }
 
+  /// Get the index of each piece by its ID
+  const auto& get_piece_ids() const noexcept { return *m_piece_ids; }
+
   /// Get all the pieces
+  /// Do not change the square of a piece directly:
+  /// this is done in 'tick', which keeps the board up to date
   auto& get_pieces() noexcept { return m_pieces; }
 
   /// Get all the pieces
@@ -40,20 +52,38 @@ public:
   /// Get the in-game time
   const auto& get_time() const noexcept { return m_t; }
 
+  /// Remove the piece at a square, e.g. to set up a position in a test.
+  /// Keeps the board and the IDs of the pieces up to date,
+  /// which removing it from 'get_pieces' directly does not
+  void remove_piece_at(const square& s);
+
   /// Go to the next frame
   void tick(const delta_t& dt = delta_t(1.0));
 
 private:
 
-  /// The game options
-  const game_options m_game_options;
+  /// The game options.
+  /// Shared between copies of a game, as these can hold a whole replay
+  std::shared_ptr<const game_options> m_game_options;
 
   /// The game options
-  const lobby_options m_lobby_options;
+  lobby_options m_lobby_options;
 
   /// All pieces in the game
   std::vector<piece> m_pieces;
 
+  /// The board, i.e. the index of the piece at each square.
+  /// Updated by 'tick' whenever the pieces move or die.
+  /// Must be declared after 'm_pieces', as it is created from it
+  board m_board;
+
+  /// The index of each piece by its ID.
+  /// Rebuilt by 'tick' whenever pieces die.
+  /// Shared between copies of a game, as it only changes when pieces die,
+  /// so that copying a game, e.g. for a rollout, does not copy it.
+  /// Must be declared after 'm_pieces', as it is created from it
+  std::shared_ptr<const piece_id_table> m_piece_ids;
+
   /// The time
   delta_t m_t;
 };
@@ -146,6 +176,13 @@ action_history collect_action_history(const game& g);
 /// to get all the 'user_input's from a game
 std::vector<piece_action> collect_all_piece_actions(const game& g);
 
+/// As \link{collect_all_piece_actions}, but append the actions to 'actions',
+/// so that a buffer can be reused without allocating memory
+void collect_all_piece_actions(
+  const game& g,
+  std::vector<piece_action>& actions
+);
+
 /// Collect all valid moves and attackes at a board
 /// for all pieces of a certain color
 std::vector<piece_action> collect_all_piece_actions(
@@ -153,6 +190,13 @@ std::vector<piece_action> collect_all_piece_actions(
   const chess_color player_color
 );
 
+/// As \link{collect_all_piece_actions}, but append the actions to 'actions'
+void collect_all_piece_actions(
+  const game& g,
+  const chess_color player_color,
+  std::vector<piece_action>& actions
+);
+
 /// Collect all valid moves and attackes at a board
 /// for a focal piece
 std::vector<piece_action> collect_all_piece_actions(
@@ -160,6 +204,31 @@ std::vector<piece_action> collect_all_piece_actions(
   const piece& p
 );
 
+/// As \link{collect_all_piece_actions}, but append the actions to 'actions'
+void collect_all_piece_actions(
+  const game& g,
+  const piece& p,
+  std::vector<piece_action>& actions
+);
+
+/// Collect all valid moves and attacks at a board
+/// for a focal piece to the target squares,
+/// i.e. a move to each empty target square
+/// and an attack on each target square with an enemy piece
+std::vector<piece_action> collect_all_piece_actions_to(
+  const game& g,
+  const piece& p,
+  const bitboard targets
+);
+
+/// As \link{collect_all_piece_actions_to}, but append the actions to 'actions'
+void collect_all_piece_actions_to(
+  const game& g,
+  const piece& p,
+  const bitboard targets,
+  std::vector<piece_action>& actions
+);
+
 /// Collect all valid moves and attacks at a board
 /// for a focal bishop
 std::vector<piece_action> collect_all_bishop_actions(
@@ -167,6 +236,13 @@ std::vector<piece_action> collect_all_bishop_actions(
   const piece& p
 );
 
+/// As \link{collect_all_bishop_actions}, but append the actions to 'actions'
+void collect_all_bishop_actions(
+  const game& g,
+  const piece& p,
+  std::vector<piece_action>& actions
+);
+
 /// Collect all valid moves and attacks at a board
 /// for a focal king
 std::vector<piece_action> collect_all_king_actions(
@@ -174,6 +250,13 @@ std::vector<piece_action> collect_all_king_actions(
   const piece& p
 );
 
+/// As \link{collect_all_king_actions}, but append the actions to 'actions'
+void collect_all_king_actions(
+  const game& g,
+  const piece& p,
+  std::vector<piece_action>& actions
+);
+
 /// Collect all valid moves and attacks at a board
 /// for a focal knight
 std::vector<piece_action> collect_all_knight_actions(
@@ -181,6 +264,13 @@ std::vector<piece_action> collect_all_knight_actions(
   const piece& p
 );
 
+/// As \link{collect_all_knight_actions}, but append the actions to 'actions'
+void collect_all_knight_actions(
+  const game& g,
+  const piece& p,
+  std::vector<piece_action>& actions
+);
+
 /// Collect all valid moves and attacks at a board
 /// for a focal pawn
 std::vector<piece_action> collect_all_pawn_actions(
@@ -188,6 +278,13 @@ std::vector<piece_action> collect_all_pawn_actions(
   const piece& p
 );
 
+/// As \link{collect_all_pawn_actions}, but append the actions to 'actions'
+void collect_all_pawn_actions(
+  const game& g,
+  const piece& p,
+  std::vector<piece_action>& actions
+);
+
 /// Collect all valid attack actions at a board
 /// for a focal pawn
 std::vector<piece_action> collect_all_pawn_attack_actions(
@@ -195,6 +292,13 @@ std::vector<piece_action> collect_all_pawn_attack_actions(
   const piece& p
 );
 
+/// As \link{collect_all_pawn_attack_actions}, but append the actions to 'actions'
+void collect_all_pawn_attack_actions(
+  const game& g,
+  const piece& p,
+  std::vector<piece_action>& actions
+);
+
 /// Collect all valid attack actions at a board
 /// for a focal pawn
 std::vector<piece_action> collect_all_pawn_en_passant_actions(
@@ -202,6 +306,13 @@ std::vector<piece_action> collect_all_pawn_en_passant_actions(
   const piece& p
 );
 
+/// As \link{collect_all_pawn_en_passant_actions}, but append the actions to 'actions'
+void collect_all_pawn_en_passant_actions(
+  const game& g,
+  const piece& p,
+  std::vector<piece_action>& actions
+);
+
 /// Collect all valid move actions at a board
 /// for a focal pawn
 std::vector<piece_action> collect_all_pawn_move_actions(
@@ -209,6 +320,13 @@ std::vector<piece_action> collect_all_pawn_move_actions(
   const piece& p
 );
 
+/// As \link{collect_all_pawn_move_actions}, but append the actions to 'actions'
+void collect_all_pawn_move_actions(
+  const game& g,
+  const piece& p,
+  std::vector<piece_action>& actions
+);
+
 /// Collect all valid moves and attacks at a board
 /// for a focal queen
 std::vector<piece_action> collect_all_queen_actions(
@@ -216,6 +334,13 @@ std::vector<piece_action> collect_all_queen_actions(
   const piece& p
 );
 
+/// As \link{collect_all_queen_actions}, but append the actions to 'actions'
+void collect_all_queen_actions(
+  const game& g,
+  const piece& p,
+  std::vector<piece_action>& actions
+);
+
 /// Collect all valid moves and attacks at a board
 /// for a focal rook
 std::vector<piece_action> collect_all_rook_actions(
@@ -223,6 +348,13 @@ std::vector<piece_action> collect_all_rook_actions(
   const piece& p
 );
 
+/// As \link{collect_all_rook_actions}, but append the actions to 'actions'
+void collect_all_rook_actions(
+  const game& g,
+  const piece& p,
+  std::vector<piece_action>& actions
+);
+
 /// Get all the sound effects to be processed
 std::vector<message> collect_messages(const game& g) noexcept;
 
@@ -294,6 +426,14 @@ std::vector<piece> get_starting_pieces(
 /// and a specific starting position
 game get_game_with_starting_position(starting_position_type t) noexcept;
 
+/// Get the Zobrist hash of the state of the game,
+/// i.e. of the pieces, their health, selectedness and the actions
+/// they are doing, but not of the time.
+/// Games in the same state have the same hash,
+/// so this can be used as a key of a transposition table
+/// or as a fast check that two games differ
+std::uint64_t get_hash(const game& g) noexcept;
+
 /// Get the ID of a piece at a square
 /// Will throw if there is no piece there
 read_only<id> get_id(const game& g, const square& s);
@@ -336,13 +476,20 @@ piece& get_piece_at(game& g, const std::string& square_str);
 /// Get the piece that moves
 piece& get_piece_that_moves(game& g, const chess_move& move);
 
-/// Find a piece with a certain ID
-/// Will throw if there is no piece with that ID
-piece get_piece_with_id(
+/// Find a piece with a certain ID, in constant time.
+/// There must be a piece with that ID
+const piece& get_piece_with_id(
   const game& g,
   const id& i
 );
 
+/// Find a piece with a certain ID, in constant time.
+/// There must be a piece with that ID
+piece& get_piece_with_id(
+  game& g,
+  const id& i
+);
+
 /// Get the color of a player
 chess_color get_player_color(
   const game& g,
@@ -386,6 +533,13 @@ const std::vector<piece>& get_pieces(const game& g) noexcept;
 /// Get the time in the game
 const delta_t& get_time(const game& g) noexcept;
 
+/// Get the winner, i.e. the color of the only king left.
+/// Returns an empty optional if both (or no) kings are left
+std::optional<chess_color> get_winner(const game& g) noexcept;
+
+/// Is there a piece with the ID, in constant time?
+bool has_piece_with_id(const game& g, const id& i) noexcept;
+
 /// See if there is at least 1 piece selected
 /// @param g a game
 /// @param player the color of the player, which is white for player 1
@@ -417,6 +571,13 @@ bool is_empty_between(
 /// Are all pieces idle?
 bool is_idle(const game& g) noexcept;
 
+/// Is there an idle piece of a color at the square?
+bool is_idle_piece_at(
+  const game& g,
+  const chess_color color,
+  const square& s
+) noexcept;
+
 /// Determine if there is a piece at the coordinat
 bool is_piece_at(
   const game& g,
@@ -438,7 +599,7 @@ bool is_piece_at(
 
 /// See if there is a piece with a certain ID at a certain square
 bool piece_with_id_is_at(
-  game& g,
+  const game& g,
   const id& i,
   const square& s
 );
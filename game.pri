@@ -5,15 +5,20 @@ HEADERS += \
     $$PWD/action_history.h \
     $$PWD/action_number.h \
     $$PWD/asserts.h \
+    $$PWD/bitboard.h \
     $$PWD/board.h \
+    $$PWD/board_layer.h \
     $$PWD/board_to_text_options.h \
     $$PWD/castling_type.h \
     $$PWD/ccfwd.h \
     $$PWD/chess_color.h \
     $$PWD/chess_move.h \
+    $$PWD/computer_player.h \
     $$PWD/controls_view_item.h \
     $$PWD/controls_view_layout.h \
+    $$PWD/copy_on_write.h \
     $$PWD/delta_t.h \
+    $$PWD/fixed_timestep.h \
     $$PWD/fonts.h \
     $$PWD/fps_clock.h \
     $$PWD/game.h \
@@ -22,28 +27,41 @@ HEADERS += \
     $$PWD/game_log.h \
     $$PWD/game_options.h \
     $$PWD/game_rect.h \
+    $$PWD/game_snapshot.h \
     $$PWD/game_speed.h \
     $$PWD/game_view_layout.h \
     $$PWD/helper.h \
     $$PWD/id.h \
+    $$PWD/input_recorder.h \
+    $$PWD/input_recording.h \
     $$PWD/key_bindings.h \
+    $$PWD/keyframed_replay.h \
     $$PWD/layout.h \
+    $$PWD/lockstep.h \
+    $$PWD/lockstep_connection.h \
+    $$PWD/lockstep_packet.h \
+    $$PWD/log_level.h \
+    $$PWD/log_ring_buffer.h \
     $$PWD/lobby_options.h \
     $$PWD/lobby_view_item.h \
     $$PWD/lobby_view_layout.h \
+    $$PWD/mapped_file.h \
     $$PWD/menu_view_item.h \
     $$PWD/menu_view_layout.h \
     $$PWD/message.h \
     $$PWD/message_type.h \
     $$PWD/options_view_item.h \
     $$PWD/options_view_layout.h \
+    $$PWD/pgn_reader.h \
     $$PWD/pgn_string.h \
     $$PWD/physical_controller.h \
     $$PWD/physical_controller_type.h \
     $$PWD/physical_controllers.h \
     $$PWD/piece.h \
     $$PWD/piece_action.h \
+    $$PWD/piece_action_queue.h \
     $$PWD/piece_action_type.h \
+    $$PWD/piece_id_table.h \
     $$PWD/piece_actions.h \
     $$PWD/piece_type.h \
     $$PWD/pieces.h \
@@ -51,18 +69,31 @@ HEADERS += \
     $$PWD/race.h \
     $$PWD/read_only.h \
     $$PWD/replay.h \
+    $$PWD/replay_validation.h \
     $$PWD/replayer.h \
+    $$PWD/resimulation.h \
+    $$PWD/rollout_statistics.h \
+    $$PWD/rollouts.h \
     $$PWD/screen_coordinat.h \
     $$PWD/screen_rect.h \
     $$PWD/side.h \
+    $$PWD/simulation.h \
+    $$PWD/simulation_result.h \
+    $$PWD/simulations.h \
     $$PWD/songs.h \
+    $$PWD/spsc_queue.h \
     $$PWD/square.h \
     $$PWD/starting_position_type.h \
     $$PWD/test_game.h \
+    $$PWD/texture_atlas.h \
+    $$PWD/tick_mode.h \
+    $$PWD/triple_buffer.h \
+    $$PWD/unit_paths_overlay.h \
     $$PWD/user_input.h \
     $$PWD/user_input_type.h \
     $$PWD/user_inputs.h \
-    $$PWD/volume.h
+    $$PWD/volume.h \
+    $$PWD/zobrist.h
 
 SOURCES += \
     $$PWD/about_view_item.cpp \
@@ -70,14 +101,19 @@ SOURCES += \
     $$PWD/action_history.cpp \
     $$PWD/action_number.cpp \
     $$PWD/asserts.cpp \
+    $$PWD/bitboard.cpp \
     $$PWD/board.cpp \
+    $$PWD/board_layer.cpp \
     $$PWD/board_to_text_options.cpp \
     $$PWD/castling_type.cpp \
     $$PWD/chess_color.cpp \
     $$PWD/chess_move.cpp \
+    $$PWD/computer_player.cpp \
     $$PWD/controls_view_item.cpp \
     $$PWD/controls_view_layout.cpp \
+    $$PWD/copy_on_write.cpp \
     $$PWD/delta_t.cpp \
+    $$PWD/fixed_timestep.cpp \
     $$PWD/fonts.cpp \
     $$PWD/fps_clock.cpp \
     $$PWD/game.cpp \
@@ -86,28 +122,41 @@ SOURCES += \
     $$PWD/game_log.cpp \
     $$PWD/game_options.cpp \
     $$PWD/game_rect.cpp \
+    $$PWD/game_snapshot.cpp \
     $$PWD/game_speed.cpp \
     $$PWD/game_view_layout.cpp \
     $$PWD/helper.cpp \
     $$PWD/id.cpp \
+    $$PWD/input_recorder.cpp \
+    $$PWD/input_recording.cpp \
     $$PWD/key_bindings.cpp \
+    $$PWD/keyframed_replay.cpp \
     $$PWD/layout.cpp \
+    $$PWD/lockstep.cpp \
+    $$PWD/lockstep_connection.cpp \
+    $$PWD/lockstep_packet.cpp \
+    $$PWD/log_level.cpp \
+    $$PWD/log_ring_buffer.cpp \
     $$PWD/lobby_options.cpp \
     $$PWD/lobby_view_item.cpp \
     $$PWD/lobby_view_layout.cpp \
+    $$PWD/mapped_file.cpp \
     $$PWD/menu_view_item.cpp \
     $$PWD/menu_view_layout.cpp \
     $$PWD/message.cpp \
     $$PWD/message_type.cpp \
     $$PWD/options_view_item.cpp \
     $$PWD/options_view_layout.cpp \
+    $$PWD/pgn_reader.cpp \
     $$PWD/pgn_string.cpp \
     $$PWD/physical_controller.cpp \
     $$PWD/physical_controller_type.cpp \
     $$PWD/physical_controllers.cpp \
     $$PWD/piece.cpp \
     $$PWD/piece_action.cpp \
+    $$PWD/piece_action_queue.cpp \
     $$PWD/piece_action_type.cpp \
+    $$PWD/piece_id_table.cpp \
     $$PWD/piece_actions.cpp \
     $$PWD/piece_type.cpp \
     $$PWD/pieces.cpp \
@@ -115,17 +164,30 @@ SOURCES += \
     $$PWD/race.cpp \
     $$PWD/read_only.cpp \
     $$PWD/replay.cpp \
+    $$PWD/replay_validation.cpp \
     $$PWD/replayer.cpp \
+    $$PWD/resimulation.cpp \
+    $$PWD/rollout_statistics.cpp \
+    $$PWD/rollouts.cpp \
     $$PWD/screen_coordinat.cpp \
     $$PWD/screen_rect.cpp \
     $$PWD/side.cpp \
+    $$PWD/simulation.cpp \
+    $$PWD/simulation_result.cpp \
+    $$PWD/simulations.cpp \
     $$PWD/songs.cpp \
+    $$PWD/spsc_queue.cpp \
     $$PWD/square.cpp \
     $$PWD/starting_position_type.cpp \
     $$PWD/test_game.cpp \
     $$PWD/test_game_scenarios.cpp \
+    $$PWD/texture_atlas.cpp \
+    $$PWD/tick_mode.cpp \
+    $$PWD/triple_buffer.cpp \
+    $$PWD/unit_paths_overlay.cpp \
     $$PWD/user_input.cpp \
     $$PWD/user_input_type.cpp \
     $$PWD/user_inputs.cpp \
-    $$PWD/volume.cpp
+    $$PWD/volume.cpp \
+    $$PWD/zobrist.cpp
 
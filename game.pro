@@ -8,6 +8,9 @@
 #
 #DEFINES += LOGIC_ONLY
 
+# The level of the debug log, see log_level.h
+#DEFINES += LOG_LEVEL=3
+
 # All files are in here, the rest are just settings
 include(game.pri)
 include(game_view.pri)
@@ -41,7 +44,7 @@ CONFIG(debug, debug|release) {
 # Qt5
 QT += core gui widgets
 
-LIBS += -lsfml-graphics -lsfml-window -lsfml-system -lsfml-audio
+LIBS += -lsfml-graphics -lsfml-window -lsfml-system -lsfml-audio -lsfml-network
 
 #INCLUDEPATH += ../magic_enum
 
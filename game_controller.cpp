@@ -179,20 +179,24 @@ user_inputs convert_move_to_user_inputs(
   }
   // Move the cursor to target's square
   {
-    assert(m.get_to().has_value());
     const auto v{
       get_user_inputs_to_move_cursor_from_to(
         c,
         from,
-        m.get_to().value(),
+        get_target_square(m),
         player_side
       )
     };
     add(inputs, v);
   }
-  // Do the action
+  // Do the action, where a keyboard user attacks to capture
   {
-    const auto i{get_user_input_to_do_action_1(c, player_side)};
+    const auto i{
+      is_capture(m)
+      && get_physical_controller_type(c, player_side) == physical_controller_type::keyboard
+      ? create_press_action_2(player_side)
+      : get_user_input_to_do_action_1(c, player_side)
+    };
     inputs.add(i);
   }
   return inputs;
@@ -682,6 +686,38 @@ user_inputs get_user_inputs_to_move_cursor_to(
   }
 }
 
+user_inputs get_user_inputs_to_do_piece_action(
+  const game_controller& c,
+  const piece_action& action,
+  const side player_side
+)
+{
+  user_inputs inputs{
+    get_user_inputs_to_move_cursor_to(c, action.get_to(), player_side)
+  };
+  // The left mouse button only moves to an enemy's square,
+  // so also a mouse user attacks with action 2
+  inputs.add(
+    action.get_action_type() == piece_action_type::attack
+    ? create_press_action_2(player_side)
+    : get_user_input_to_do_action_1(c, player_side)
+  );
+  return inputs;
+}
+
+user_inputs get_user_inputs_to_select_piece_at(
+  const game_controller& c,
+  const square& s,
+  const side player_side
+)
+{
+  user_inputs inputs{
+    get_user_inputs_to_move_cursor_to(c, s, player_side)
+  };
+  inputs.add(get_user_input_to_select(c, player_side));
+  return inputs;
+}
+
 user_input get_user_input_to_select(
   const game_controller& c,
   const side player_side
@@ -990,6 +1026,24 @@ void test_game_controller() //!OCLINT tests may be many
     assert(collect_messages(g).at(1).get_message_type() == message_type::start_castling_kingside);
     #endif // FIX_ISSUE_3
   }
+  // 3: a white king that can castle moves one square to the right
+  {
+    game g = get_game_with_starting_position(starting_position_type::ready_to_castle);
+    game_controller c;
+    move_cursor_to(c, "e1", side::lhs);
+    add_user_input(c, create_press_action_1(side::lhs));
+    c.apply_user_inputs_to_game(g);
+    g.tick(delta_t(0.0));
+    move_cursor_to(c, "f1", side::lhs);
+    add_user_input(c, create_press_action_1(side::lhs));
+    c.apply_user_inputs_to_game(g);
+    g.tick(delta_t(0.0));
+    const piece& king{get_piece_at(g, square("e1"))};
+    assert(king.get_type() == piece_type::king);
+    assert(has_actions(king));
+    assert(king.get_actions()[0].get_action_type() == piece_action_type::move);
+    assert(king.get_actions()[0].get_to() == square("f1"));
+  }
   // 47: set_keyboard_player_pos for RHS player
   {
     game_controller c;
@@ -1237,6 +1291,22 @@ void test_game_controller() //!OCLINT tests may be many
     #endif // FIX_ISSUE_64_NO_ACTION
   }
   #endif // FIX_ISSUE_64
+  // get_user_inputs_to_select_piece_at, then get_user_inputs_to_do_piece_action
+  {
+    game g;
+    game_controller c;
+    add_user_inputs(c, get_user_inputs_to_select_piece_at(c, square("e2"), side::lhs));
+    c.apply_user_inputs_to_game(g);
+    g.tick();
+    assert(count_selected_units(g, chess_color::white) == 1);
+    const piece_action action(
+      chess_color::white, piece_type::pawn, piece_action_type::move, "e2", "e4"
+    );
+    add_user_inputs(c, get_user_inputs_to_do_piece_action(c, action, side::lhs));
+    c.apply_user_inputs_to_game(g);
+    tick_until_idle(g);
+    assert(is_piece_at(g, square("e4")));
+  }
   // get_cursor_pos
   {
     const game g;
@@ -95,7 +95,11 @@ std::vector<user_inputs> collect_all_user_inputses(
 );
 
 /// Convert a chess move, e.g. e4,
-/// to the right user inputs
+/// to the right user inputs.
+/// The piece is selected in a tick,
+/// so the game must be ticked before the last input is applied.
+/// Throws a std::invalid_argument if no piece can do the move,
+/// see \link{get_from}
 user_inputs convert_move_to_user_inputs(
   const game& g,
   const game_controller& c,
@@ -313,6 +317,24 @@ user_inputs get_user_inputs_to_move_cursor_to(
   const side player_side
 );
 
+/// Create the user inputs to let the selected piece do an action,
+/// i.e. move the cursor to the target square and press a key:
+/// action 2 for an attack, else action 1 for a keyboard
+/// and the left mouse button for a mouse
+user_inputs get_user_inputs_to_do_piece_action(
+  const game_controller& c,
+  const piece_action& action,
+  const side player_side
+);
+
+/// Create the user inputs to select the piece at a square,
+/// i.e. move the cursor there and select it
+user_inputs get_user_inputs_to_select_piece_at(
+  const game_controller& c,
+  const square& s,
+  const side player_side
+);
+
 /// Create the user inputs to select the square at the cursor
 user_input get_user_input_to_select(
   const game_controller& c,
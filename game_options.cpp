@@ -21,7 +21,8 @@ game_options::game_options(
     m_screen_size{screen_size},
     m_starting_position{starting_position},
     m_music_volume{10},
-    m_sound_effects_volume{20} // percent
+    m_sound_effects_volume{20}, // percent
+    m_tick_mode{get_default_tick_mode()}
 {
   assert(m_click_distance > 0.0);
   assert(m_margin_width >= 0);
@@ -64,6 +65,11 @@ starting_position_type get_starting_position(const game_options& options) noexce
   return options.get_starting_position();
 }
 
+tick_mode get_tick_mode(const game_options& options) noexcept
+{
+  return options.get_tick_mode();
+}
+
 void test_game_options()
 {
 #ifndef NDEBUG
@@ -99,6 +105,14 @@ void test_game_options()
     options.set_volume(v);
     assert(options.get_music_volume() == v);
   }
+  // game_options::set_tick_mode
+  {
+    auto options{create_default_game_options()};
+    assert(get_tick_mode(options) == get_default_tick_mode());
+    options.set_tick_mode(tick_mode::fixed);
+    assert(get_tick_mode(options) == tick_mode::fixed);
+    assert(!(options == create_default_game_options()));
+  }
   // 40: operator<<
   {
     const auto options{create_default_game_options()};
@@ -124,6 +138,7 @@ bool operator==(const game_options& lhs, const game_options& rhs) noexcept
     && lhs.get_starting_position() == rhs.get_starting_position()
     && lhs.get_music_volume() == rhs.get_music_volume()
     && lhs.get_sound_effects_volume() == rhs.get_sound_effects_volume()
+    && lhs.get_tick_mode() == rhs.get_tick_mode()
   ;
 }
 
@@ -142,7 +157,8 @@ std::ostream& operator<<(std::ostream& os, const game_options& options) noexcept
     << "Screen size: " << options.get_screen_size() << '\n'
     << "Starting position: " << options.get_starting_position() << '\n'
     << "Music volume: " << options.get_music_volume() << '\n'
-    << "Sound effects volume: " << options.get_sound_effects_volume()
+    << "Sound effects volume: " << options.get_sound_effects_volume() << '\n'
+    << "Tick mode: " << options.get_tick_mode()
   ;
   return os;
 }
@@ -11,6 +11,7 @@
 #include "volume.h"
 #include "replayer.h"
 #include "game_speed.h"
+#include "tick_mode.h"
 
 #include <iosfwd>
 #include <vector>
@@ -63,6 +64,9 @@ public:
   /// Get the sound effects volume
   const volume& get_sound_effects_volume() const noexcept { return m_sound_effects_volume; }
 
+  /// Get how the game is ticked when played in a window
+  tick_mode get_tick_mode() const noexcept { return m_tick_mode; }
+
   /// Set the game speed
   void set_game_speed(const game_speed speed) noexcept { m_game_speed = speed; }
 
@@ -75,6 +79,9 @@ public:
   /// Set the sound effects volume, as a percentage
   void set_sound_effects_volume(const volume& v) noexcept { m_sound_effects_volume = v; }
 
+  /// Set how the game is ticked when played in a window
+  void set_tick_mode(const tick_mode mode) noexcept { m_tick_mode = mode; }
+
   /// Set the volume, as a percentage
   void set_volume(const volume& v) noexcept { m_music_volume = v; }
 
@@ -105,6 +112,9 @@ private:
   /// Sound effects volume
   volume m_sound_effects_volume;
 
+  /// How the game is ticked when played in a window
+  tick_mode m_tick_mode;
+
 };
 
 /// Create the default game options
@@ -125,6 +135,9 @@ const volume& get_sound_effects_volume(const game_options& options) noexcept;
 /// Get the starting position
 starting_position_type get_starting_position(const game_options& options) noexcept;
 
+/// Get how the game is ticked when played in a window
+tick_mode get_tick_mode(const game_options& options) noexcept;
+
 /// Test this class and its free functions
 void test_game_options();
 
@@ -0,0 +1,64 @@
+#include "game_snapshot.h"
+
+#include <algorithm>
+#include <cassert>
+#include <thread>
+
+game_snapshot::game_snapshot(
+  const game& g,
+  const std::shared_ptr<const game>& previous_game,
+  const game_controller& c,
+  const game_log& log,
+  const double alpha,
+  const double step_secs
+) : m_alpha{alpha},
+    m_game{g},
+    m_game_controller{c},
+    m_log{log},
+    m_previous_game{previous_game},
+    m_step_secs{step_secs},
+    m_time{std::chrono::steady_clock::now()}
+{
+  assert(m_previous_game);
+  assert(m_alpha >= 0.0);
+  assert(m_alpha <= 1.0);
+  assert(m_step_secs > 0.0);
+}
+
+double get_alpha(const game_snapshot& s) noexcept
+{
+  const std::chrono::duration<double> elapsed{
+    std::chrono::steady_clock::now() - s.get_time()
+  };
+  return std::min(1.0, s.get_alpha() + (elapsed.count() / s.get_step_secs()));
+}
+
+void test_game_snapshot()
+{
+#ifndef NDEBUG
+  // game_snapshot::game_snapshot
+  {
+    const game g;
+    const auto previous_game{std::make_shared<const game>(g)};
+    const game_snapshot s(g, previous_game, game_controller(), game_log(1.0), 0.5, 0.25);
+    assert(s.get_alpha() == 0.5);
+    assert(s.get_step_secs() == 0.25);
+    assert(s.get_game().get_pieces().size() == g.get_pieces().size());
+    assert(s.get_time() <= std::chrono::steady_clock::now());
+    // The previous game is shared, not copied
+    assert(&s.get_previous_game() == previous_game.get());
+  }
+  // get_alpha is at least the alpha at the moment the snapshot was taken
+  {
+    const game_snapshot s(game(), std::make_shared<const game>(), game_controller(), game_log(1.0), 0.5, 1000.0);
+    assert(get_alpha(s) >= 0.5);
+    assert(get_alpha(s) < 1.0);
+  }
+  // get_alpha is 1.0 when the next snapshot is overdue
+  {
+    const game_snapshot s(game(), std::make_shared<const game>(), game_controller(), game_log(1.0), 0.0, 0.001);
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    assert(get_alpha(s) == 1.0);
+  }
+#endif // NDEBUG
+}
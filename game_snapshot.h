@@ -0,0 +1,73 @@
+#ifndef GAME_SNAPSHOT_H
+#define GAME_SNAPSHOT_H
+
+#include "ccfwd.h"
+#include "game.h"
+#include "game_controller.h"
+#include "game_log.h"
+
+#include <chrono>
+#include <memory>
+
+/// Everything needed to draw a frame of a \link{game_view},
+/// as published by the simulation thread to the render thread.
+///
+/// A snapshot is a copy, so the render thread can draw it
+/// while the simulation thread ticks on.
+/// It shares the game before the last tick as well,
+/// to interpolate between the two in the fixed tick mode,
+/// which is only copied once per step, not once per snapshot
+class game_snapshot
+{
+public:
+  /// @param alpha the fraction of a step the simulation
+  ///   had accumulated when the snapshot was taken,
+  ///   see \link{fixed_timestep::get_alpha}
+  /// @param step_secs the duration of one fixed step, in seconds
+  game_snapshot(
+    const game& g,
+    const std::shared_ptr<const game>& previous_game,
+    const game_controller& c,
+    const game_log& log,
+    const double alpha,
+    const double step_secs
+  );
+
+  /// Get the fraction of a step accumulated when the snapshot was taken
+  double get_alpha() const noexcept { return m_alpha; }
+
+  const auto& get_game() const noexcept { return m_game; }
+
+  const auto& get_game_controller() const noexcept { return m_game_controller; }
+
+  const auto& get_log() const noexcept { return m_log; }
+
+  /// Get the game before the last tick
+  const auto& get_previous_game() const noexcept { return *m_previous_game; }
+
+  /// Get the duration of one fixed step, in seconds
+  double get_step_secs() const noexcept { return m_step_secs; }
+
+  /// Get the moment the snapshot was taken
+  const auto& get_time() const noexcept { return m_time; }
+
+private:
+
+  double m_alpha;
+  game m_game;
+  game_controller m_game_controller;
+  game_log m_log;
+  std::shared_ptr<const game> m_previous_game;
+  double m_step_secs;
+  std::chrono::steady_clock::time_point m_time;
+};
+
+/// Get the fraction of a step to interpolate with at this moment,
+/// which grows from the snapshot's alpha as time passes,
+/// until it is 1.0 when the next snapshot is overdue
+double get_alpha(const game_snapshot& s) noexcept;
+
+/// Test this class and its free functions
+void test_game_snapshot();
+
+#endif // GAME_SNAPSHOT_H
@@ -8,6 +8,7 @@
 #include "game.h"
 #include "game_resources.h"
 #include "game_view_layout.h"
+#include "log_ring_buffer.h"
 #include "game_rect.h"
 #include "screen_coordinat.h"
 #include "screen_rect.h"
@@ -18,21 +19,57 @@
 
 #include <cassert>
 #include <cmath>
+#include <exception>
 #include <iostream>
 #include <numeric>
 #include <string>
 #include <sstream>
+#include <thread>
 
 game_view::game_view(
   const game& game,
-  const game_controller& c
+  const game_controller& c,
+  const std::vector<computer_player>& computer_players,
+  std::unique_ptr<lockstep_connection> connection,
+  const side local_player
 )
   :
+    m_alpha{0.0},
+    m_computer_players{computer_players},
+    m_events(1024),
     m_game{game},
     m_game_controller{c},
+    m_input_recording_file(create_input_recording_filename(), std::ios::binary),
+    m_input_recorder(m_input_recording_file, m_game, m_game_controller),
     m_log{game.get_game_options().get_message_display_time_secs()},
-    m_show_debug{false}
+    m_must_stop{false},
+    m_lockstep_connection{std::move(connection)},
+    m_previous_game{std::make_shared<const class game>(game)},
+    m_show_debug{false},
+    m_snapshots(
+      game_snapshot(
+        m_game,
+        m_previous_game,
+        m_game_controller,
+        m_log,
+        0.0,
+        m_fixed_timestep.get_step_secs()
+      )
+    )
 {
+  if (m_lockstep_connection)
+  {
+    // The computer players would add user inputs for the other player
+    assert(m_computer_players.empty());
+    m_lockstep.emplace(
+      m_game,
+      m_game_controller,
+      local_player,
+      get_default_input_delay(),
+      get_delta_t(m_fixed_timestep)
+        * to_delta_t(m_game.get_game_options().get_game_speed())
+    );
+  }
   m_game_resources.get_songs().get_wonderful_time().setVolume(
     get_music_volume_as_percentage(m_game)
   );
@@ -63,37 +100,45 @@ void game_view::exec()
     ),
     "Conquer Chess"
   );
+  // The simulation has the game to itself from here on
+  std::thread simulation([this]() { simulate(); });
   while (m_window.isOpen())
   {
     // Keep track of the FPS
     m_fps_clock.tick();
 
-    // Disard old messages
-    m_log.tick();
-
-    // Process user input and play game until instructed to exit
+    // Process user input until instructed to exit
     const bool must_quit{
-      process_events() // main game loop
+      process_events()
     };
     if (must_quit)
     {
       break;
     }
 
-    // Do a tick, so that one delta_t equals one second under normal game speed
-    m_game.tick(
-      delta_t(1.0 / m_fps_clock.get_fps())
-      * to_delta_t(m_game.get_game_options().get_game_speed())
-    );
-
-    // Read the pieces' messages and play their sounds
-    process_piece_messages();
-
-    // Show the new state
+    // Draw the latest state the simulation has published
+    m_snapshots.take();
+    m_alpha = ::get_alpha(get_snapshot());
     show();
   }
+  m_must_stop = true;
+  simulation.join();
 
-  std::clog << collect_action_history(m_game) << '\n';
+  if constexpr (is_logged(log_level::info))
+  {
+    const auto history{collect_action_history(m_game)};
+    for (const auto& timed_action: history.get_timed_actions())
+    {
+      log_message<log_level::info>(
+        [&timed_action](std::ostream& os)
+        {
+          os << timed_action.first << ": " << timed_action.second;
+        }
+      );
+    }
+  }
+  m_input_recorder.close();
+  write_log(std::clog, get_thread_log());
   m_game_resources.get_songs().get_wonderful_time().stop();
 }
 
@@ -139,6 +184,25 @@ std::string get_last_log_messages(
   );
 }
 
+double get_interpolated_action_time(const game_view& v, const piece& p) noexcept
+{
+  const double f{p.get_current_action_time().get()};
+  if (get_tick_mode(get_options(v)) != tick_mode::fixed) return f;
+  const game& previous_game{v.get_previous_game()};
+  if (!has_piece_with_id(previous_game, p.get_id())) return f;
+  const piece& previous{get_piece_with_id(previous_game, p.get_id())};
+  if (p.get_actions().empty()
+    || previous.get_actions().empty()
+    || previous.get_actions().front() != p.get_actions().front()
+  )
+  {
+    return f;
+  }
+  const double f_previous{previous.get_current_action_time().get()};
+  const double alpha{v.get_alpha()};
+  return f_previous + (alpha * (f - f_previous));
+}
+
 const game_view_layout& get_layout(const game_view& v) noexcept
 {
   return v.get_layout();
@@ -231,6 +295,13 @@ bool game_view::process_events()
         ),
         get_default_margin_width()
       );
+      // The simulation needs the new layout for the mouse events
+      if (!m_events.push(event))
+      {
+        log_message<log_level::error>(
+          [](std::ostream& os) { os << "The window event queue is full"; }
+        );
+      }
       return false;
     }
     else if (event.type == sf::Event::Closed)
@@ -247,8 +318,12 @@ bool game_view::process_events()
         return true;
       }
     }
-    process_event(m_game_controller, event, m_layout);
-    m_game_controller.apply_user_inputs_to_game(m_game);
+    if (!m_events.push(event))
+    {
+      log_message<log_level::error>(
+        [](std::ostream& os) { os << "The window event queue is full"; }
+      );
+    }
   }
   return false; // if no events proceed with tick
 }
@@ -283,18 +358,107 @@ void game_view::process_piece_messages()
   clear_piece_messages(m_game);
 }
 
+void game_view::process_queued_events()
+{
+  sf::Event event;
+  while (m_events.pop(event))
+  {
+    if (event.type == sf::Event::Resized)
+    {
+      m_simulation_layout = game_view_layout(
+        screen_coordinat(
+          static_cast<int>(event.size.width),
+          static_cast<int>(event.size.height)
+        ),
+        get_default_margin_width()
+      );
+      continue;
+    }
+    if (m_lockstep)
+    {
+      // Only the local player's user inputs are used,
+      // these are applied by the lockstep game later
+      game_controller c{m_lockstep->get_game_controller()};
+      process_event(c, event, m_simulation_layout);
+      for (const auto& input: get_user_inputs(c).get_user_inputs())
+      {
+        if (input.get_player() == m_lockstep->get_local_player())
+        {
+          m_lockstep_user_inputs.push_back(input);
+        }
+      }
+      continue;
+    }
+    process_event(m_game_controller, event, m_simulation_layout);
+    m_input_recorder.add(m_game_controller.get_user_inputs());
+    m_game_controller.apply_user_inputs_to_game(m_game);
+  }
+  if (m_lockstep) send_lockstep_user_inputs();
+}
+
+void game_view::receive_lockstep_packets()
+{
+  assert(m_lockstep);
+  if (!m_lockstep_connection) return;
+  const bool was_desynced{m_lockstep->get_desync_tick().has_value()};
+  try
+  {
+    while (const auto p{m_lockstep_connection->receive()})
+    {
+      m_lockstep->add_remote_packet(*p);
+    }
+  }
+  catch (const std::exception& e)
+  {
+    lose_lockstep_connection(e);
+  }
+  if (!was_desynced && m_lockstep->get_desync_tick())
+  {
+    log_message<log_level::error>(
+      [this](std::ostream& os)
+      {
+        os << "The games differ since tick " << *m_lockstep->get_desync_tick();
+      }
+    );
+  }
+}
+
+void game_view::send_lockstep_user_inputs()
+{
+  assert(m_lockstep);
+  if (!m_lockstep_connection) return;
+  try
+  {
+    while (m_lockstep->needs_local_user_inputs())
+    {
+      m_lockstep_connection->send(
+        m_lockstep->add_local_user_inputs(m_lockstep_user_inputs)
+      );
+      m_lockstep_user_inputs.clear();
+    }
+  }
+  catch (const std::exception& e)
+  {
+    lose_lockstep_connection(e);
+  }
+}
+
 void game_view::show()
 {
   // Start drawing the new frame, by clearing the screen
   m_window.clear();
 
-  // Show the layout of the screen: board and sidebars
-  show_map(*this);
-
-  // Show the layout of the screen: board and sidebars
-  show_layout(*this);
+  // Show the map, the panels and the squares, that rarely change
+  m_board_layer.draw(
+    m_window,
+    m_layout,
+    m_game_resources,
+    get_race_of_color(get_game().get_lobby_options(), chess_color::white),
+    m_show_debug,
+    get_show_squares_semitransparent()
+  );
 
-  // Show the board: squares, unit paths, pieces, health bars
+  // Show the board: possible moves, unit paths, pieces, health bars
   show_board(*this);
 
   // Show the sidebars: controls (with log), units, debug
@@ -310,7 +474,6 @@ void game_view::show()
 
 void show_board(game_view& view)
 {
-  show_squares(view);
   if (get_options(view).do_show_occupied())
   {
     show_occupied_squares(view);
@@ -380,6 +543,9 @@ void show_controls(
     key_descriptions[3] = to_one_char_str(get_physical_controller(view, player).get_key_bindings().get_key_for_action(action_number(4)));
   }
 
+  // The icons are drawn in one go, after the tiles they are on
+  const auto& action_textures{view.get_resources().get_piece_action_textures()};
+  sf::VertexArray icons(sf::Triangles);
   for (const auto& number: get_all_action_numbers())
   {
     const int key{number.get_number()};
@@ -398,15 +564,21 @@ void show_controls(
     const bool show_icon{true};
     if (show_icon)
     {
-      sf::RectangleShape sprite;
-      set_rect(sprite, layout.get_controls_key_icon(player, number));
       if (maybe_action)
       {
-        const piece_action_type action{maybe_action.value()};
-        sprite.setTexture(
-          &get_action_icon(view.get_resources(), action)
+        const screen_rect icon_rect{
+          layout.get_controls_key_icon(player, number)
+        };
+        add_quad(
+          icons,
+          sf::FloatRect(
+            icon_rect.get_tl().get_x(),
+            icon_rect.get_tl().get_y(),
+            get_width(icon_rect),
+            get_height(icon_rect)
+          ),
+          action_textures.get_rect(maybe_action.value())
         );
-        view.get_window().draw(sprite);
       }
     }
     const bool show_input{true};
@@ -470,6 +642,7 @@ void show_controls(
       view.get_window().draw(text);
     }
   }
+  view.get_window().draw(icons, &action_textures.get_atlas().get_texture());
   // 46: for the mouse player, draw the selected active action
   if (is_mouse_user)
   {
@@ -545,7 +718,7 @@ void game_view::show_mouse_cursor()
   cursor.setOrigin(16.0, 16.0);
   const screen_coordinat cursor_pos{
     convert_to_screen_coordinat(
-      get_cursor_pos(m_game_controller, side::rhs),
+      get_cursor_pos(get_game_controller(), side::rhs),
       layout
     )
   };
@@ -556,20 +729,6 @@ void game_view::show_mouse_cursor()
   m_window.draw(cursor);
 }
 
-void show_layout(game_view& view)
-{
-  const auto& layout{view.get_layout()};
-  for (const auto& panel: get_panels(layout, view.get_show_debug()))
-  {
-    sf::RectangleShape rectangle;
-    set_rect(rectangle, panel);
-    rectangle.setFillColor(sf::Color(0, 0, 0, 128));
-    rectangle.setOutlineThickness(1);
-    rectangle.setOutlineColor(sf::Color::White);
-    view.get_window().draw(rectangle);
-  }
-}
-
 void show_log(game_view& view, const side player)
 {
   const auto& layout = view.get_layout();
@@ -586,19 +745,6 @@ void show_log(game_view& view, const side player)
   view.get_window().draw(text);
 }
 
-void show_map(game_view& view)
-{
-  const auto& game{view.get_game()};
-  const auto& layout{view.get_layout()};
-  sf::RectangleShape sprite;
-  set_rect(sprite, layout.get_window_size());
-  const race r{get_race_of_color(game.get_lobby_options(), chess_color::white)};
-  sprite.setTexture(
-    &get_map(view.get_resources(), r)
-  );
-  view.get_window().draw(sprite);
-}
-
 
 void show_occupied_squares(game_view& view)
 {
@@ -631,24 +777,18 @@ void show_pieces(game_view& view)
   const auto& layout = view.get_layout();
   const double square_width{get_square_width(layout)};
   const double square_height{get_square_height(layout)};
+  const auto& textures{view.get_resources().get_piece_textures()};
+  sf::VertexArray sprites(sf::Triangles);
+  sf::VertexArray outlines(sf::Triangles);
   for (const auto& piece: game.get_pieces())
   {
-    sf::RectangleShape sprite;
-    sprite.setSize(sf::Vector2f(0.9 * square_width, 0.9 * square_height));
-    sprite.setTexture(
-      &get_piece(
-        view.get_resources(),
-        piece.get_race(),
-        piece.get_color(),
-        piece.get_type()
-      )
-    );
+    sf::Color color{sf::Color::White};
     // Transparency effect when moving
     if (!piece.get_actions().empty()
       && piece.get_actions()[0].get_action_type() == piece_action_type::move
     )
     {
-      const double f{piece.get_current_action_time().get()};
+      const double f{get_interpolated_action_time(view, piece)};
       int alpha{0};
       if (f < 0.5)
       {
@@ -658,35 +798,40 @@ void show_pieces(game_view& view)
       {
         alpha = static_cast<int>(f * 255.0);
       }
-      sprite.setFillColor(sf::Color(255, 255, 255, alpha));
+      color.a = alpha;
     }
-    else
-    {
-      //sprite.setFillColor(sf::Color(0, 0, 0, 255));
-    }
-    if (do_show_selected(view) && piece.is_selected())
-    {
-      sprite.setOutlineColor(sf::Color(255, 0, 0));
-      sprite.setOutlineThickness(2);
-    }
-    sprite.setOrigin(sf::Vector2f(0.45 * square_width, 0.45 * square_height));
     const auto screen_position = convert_to_screen_coordinat(
       to_coordinat(piece.get_current_square()) + game_coordinat(0.0, 0.1),
       layout
     );
-    sprite.setPosition(
-      screen_position.get_x(),
-      screen_position.get_y()
+    const sf::FloatRect sprite_rect(
+      screen_position.get_x() - (0.45 * square_width),
+      screen_position.get_y() - (0.45 * square_height),
+      0.9 * square_width,
+      0.9 * square_height
+    );
+    add_quad(
+      sprites,
+      sprite_rect,
+      textures.get_rect(piece.get_race(), piece.get_color(), piece.get_type()),
+      color
     );
-    view.get_window().draw(sprite);
+    if (do_show_selected(view) && piece.is_selected())
+    {
+      add_outline(outlines, sprite_rect, 2.0f, sf::Color(255, 0, 0));
+    }
   }
+  view.get_window().draw(sprites, &textures.get_atlas().get_texture());
+  view.get_window().draw(outlines);
 }
 
 void show_possible_moves(game_view& view)
 {
   const auto& g{view.get_game()};
   const auto& layout{view.get_layout()};
-  const auto actions{collect_all_piece_actions(g)};
+  auto& actions{view.get_piece_actions()};
+  actions.clear();
+  collect_all_piece_actions(g, actions);
   for (const auto& action: actions)
   {
     if (!get_piece_at(g, action.get_from()).is_selected()) continue;
@@ -717,16 +862,6 @@ void show_sidebar(game_view& view, const side player_side)
   if (view.get_show_debug()) show_debug(view, player_side);
 }
 
-void show_squares(game_view& view)
-{
-  show_squares(
-    view.get_window(),
-    view.get_layout().get_board(),
-    view.get_resources(),
-    view.get_show_squares_semitransparent()
-  );
-}
-
 void show_square_under_cursor(
   game_view& view,
   const side player
@@ -782,174 +917,89 @@ void show_unit_health_bars(game_view& view)
 {
   const auto& game{view.get_game()};
   const auto& layout{view.get_layout()};
+  const double square_width{get_square_width(layout)};
+  const double max_width{square_width - 8.0}; // with full health
+  sf::VertexArray bars(sf::Triangles);
   for (const auto& piece: game.get_pieces())
   {
-    // Black box around it
-    sf::RectangleShape black_box;
-
-    black_box.setSize(sf::Vector2f(get_square_width(layout) - 4.0, 16.0 - 4.0));
-    //black_box.setScale(1.0, 1.0);
-    black_box.setFillColor(sf::Color(0, 0, 0));
-    black_box.setOrigin(0.0, 0.0);
-    const auto black_box_pos = convert_to_screen_coordinat(
+    const auto top_left = convert_to_screen_coordinat(
       to_coordinat(piece.get_current_square()) + game_coordinat(-0.5, -0.5),
       layout
     );
-    black_box.setPosition(
-      2.0 + black_box_pos.get_x(),
-      2.0 + black_box_pos.get_y()
+    // Black box around it
+    add_quad(
+      bars,
+      sf::FloatRect(
+        2.0 + top_left.get_x(),
+        2.0 + top_left.get_y(),
+        square_width - 4.0,
+        16.0 - 4.0
+      ),
+      sf::Color(0, 0, 0)
     );
-    view.get_window().draw(black_box);
-
     // Health
-    sf::RectangleShape health_bar;
-    const double max_width{get_square_width(layout) - 8.0}; // with full health
-    health_bar.setSize(
-      sf::Vector2f(
-      max_width * get_f_health(piece),
-      16.0 - 8.0)
+    add_quad(
+      bars,
+      sf::FloatRect(
+        4.0 + top_left.get_x(),
+        4.0 + top_left.get_y(),
+        max_width * get_f_health(piece),
+        16.0 - 8.0
+      ),
+      f_health_to_color(get_f_health(piece))
     );
-
-    health_bar.setFillColor(f_health_to_color(get_f_health(piece)));
-    health_bar.setOrigin(0.0, 0.0);
-    const auto health_bar_pos = convert_to_screen_coordinat(
-      to_coordinat(piece.get_current_square()) + game_coordinat(-0.5, -0.5),
-      layout
-    );
-    health_bar.setPosition(
-      4.0 + health_bar_pos.get_x(),
-      4.0 + health_bar_pos.get_y()
-    );
-    view.get_window().draw(health_bar);
   }
+  view.get_window().draw(bars);
 }
 
 void show_unit_paths(game_view& view)
 {
   const auto& game{view.get_game()};
   const auto& layout{view.get_layout()};
+  view.get_unit_paths_overlay().draw(
+    view.get_window(),
+    get_pieces(game),
+    layout
+  );
+
+  // Draw a circle at each in-progress movement, which changes every frame
+  const double full_diameter{get_square_width(layout)};
+  const double diameter{0.25 * full_diameter};
+  const double radius{diameter / 2.0};
+  const double outline_thickness{std::max(2.0, radius / 10.0)};
+  sf::VertexArray circles(sf::Triangles);
   for (const auto& piece: get_pieces(game))
   {
     if (is_idle(piece)) continue;
-    const auto& actions{piece.get_actions()};
-    for (const auto& action: actions)
-    {
-      const auto from_pixel{
-        convert_to_screen_coordinat(
-          to_coordinat(action.get_from()),
-          layout
-        )
-      };
-      const auto to_pixel{
-        convert_to_screen_coordinat(
-          to_coordinat(action.get_to()),
-          layout
-        )
-      };
-      const auto center_pixel{(to_pixel + from_pixel) / 2.0};
-      const double length{calc_distance(from_pixel, to_pixel)};
-      const double angle_degrees{calc_angle_degrees(center_pixel, to_pixel)};
-      sf::RectangleShape rect;
-      const double max_square_height{get_square_width(layout)};
-      const double height{std::max(2.0, max_square_height * 0.05)};
-      rect.setSize(sf::Vector2f(length, height));
-      rect.setOrigin(length / 2, height / 2);
-      rect.setPosition(
-        center_pixel.get_x(),
-        center_pixel.get_y()
-      );
-      rect.rotate(-angle_degrees);
-      rect.setOutlineColor(to_sfml_color(get_other_color(piece.get_color())));
-      rect.setOutlineThickness(2);
-      rect.setFillColor(to_sfml_color(piece.get_color()));
-      view.get_window().draw(rect);
-    }
-
-
-
-    // Collect all the coordinats for the path
-    std::vector<screen_coordinat> coordinats;
-    coordinats.reserve(piece.get_actions().size() + 1); // +1 for current position
-    coordinats.push_back(
+    const auto& first_action{piece.get_actions()[0]};
+    if (first_action.get_action_type() != piece_action_type::move) continue;
+    const auto from_pixel{
       convert_to_screen_coordinat(
-        to_coordinat(piece.get_current_square()),
+        to_coordinat(first_action.get_from()),
         layout
       )
+    };
+    const auto to_pixel{
+      convert_to_screen_coordinat(
+        to_coordinat(first_action.get_to()),
+        layout
+      )
+    };
+    const auto f{get_interpolated_action_time(view, piece)};
+    assert(f >= 0.0);
+    assert(f <= 1.0);
+    const auto delta_pixel{to_pixel - from_pixel};
+    const auto now_pixel{from_pixel + (delta_pixel * f)};
+    const sf::Vector2f center(now_pixel.get_x(), now_pixel.get_y());
+    add_circle(
+      circles,
+      center,
+      radius + outline_thickness,
+      to_sfml_color(get_other_color(piece.get_color()))
     );
-    std::transform(
-      std::begin(actions),
-      std::end(actions),
-      std::back_inserter(coordinats),
-      [layout](const auto& user_input)
-      {
-        return convert_to_screen_coordinat(
-          to_coordinat(user_input.get_to()),
-          layout
-        );
-      }
-    );
-
-    // Draw circles at the subgoals
-    sf::CircleShape circle;
-    for (const auto coordinat: coordinats)
-    {
-      const double full_diameter{get_square_width(layout)};
-      const double diameter{0.25 * full_diameter};
-      const double radius{diameter / 2.0};
-      const double half_radius{radius/ 2.0};
-      circle.setPosition(
-        sf::Vector2f(
-          coordinat.get_x() - half_radius,
-          coordinat.get_y() - half_radius
-        )
-      );
-      circle.setFillColor(to_sfml_color(piece.get_color()));
-      circle.setRadius(radius);
-      circle.setOrigin(half_radius, half_radius);
-      view.get_window().draw(circle);
-    }
-
-    // Draw circle at current in-progress movement
-    assert(!actions.empty());
-    const auto& first_action{actions[0]};
-    if (first_action.get_action_type() == piece_action_type::move)
-    {
-      const auto from_pixel{
-        convert_to_screen_coordinat(
-          to_coordinat(first_action.get_from()),
-          layout
-        )
-      };
-      const auto to_pixel{
-        convert_to_screen_coordinat(
-          to_coordinat(first_action.get_to()),
-          layout
-        )
-      };
-      const auto f{piece.get_current_action_time().get()};
-      assert(f >= 0.0);
-      assert(f <= 1.0);
-      const auto delta_pixel{to_pixel - from_pixel};
-      const auto now_pixel{from_pixel + (delta_pixel * f)};
-
-      const double full_diameter{get_square_width(layout)};
-      const double diameter{0.25 * full_diameter};
-      const double radius{diameter / 2.0};
-      const double half_radius{radius/ 2.0};
-      circle.setPosition(
-        sf::Vector2f(
-          now_pixel.get_x() - half_radius,
-          now_pixel.get_y() - half_radius
-        )
-      );
-      circle.setOutlineColor(to_sfml_color(get_other_color(piece.get_color())));
-      circle.setOutlineThickness(std::max(2.0, radius / 10.0));
-      circle.setFillColor(to_sfml_color(piece.get_color()));
-      circle.setRadius(radius);
-      circle.setOrigin(half_radius, half_radius);
-      view.get_window().draw(circle);
-    }
+    add_circle(circles, center, radius, to_sfml_color(piece.get_color()));
   }
+  view.get_window().draw(circles);
 }
 
 void show_unit_sprites(game_view& view, const side player_side)
@@ -964,25 +1014,21 @@ void show_unit_sprites(game_view& view, const side player_side)
     + screen_coordinat(10, 0) // margin
   };
 
+  const auto& portraits{view.get_resources().get_piece_portrait_textures()};
+  sf::VertexArray sprites(sf::Triangles);
   for (const auto& piece: get_selected_pieces(view.get_game(), player_color))
   {
     // sprite of the piece
-    sf::RectangleShape sprite;
-    sprite.setSize(sf::Vector2f(square_width, square_height));
-    sprite.setTexture(
-      &get_piece_portrait(
-        view.get_resources(),
-        piece.get_race(),
-        piece.get_color(),
-        piece.get_type()
-      )
+    add_quad(
+      sprites,
+      sf::FloatRect(
+        screen_position.get_x(),
+        screen_position.get_y(),
+        square_width,
+        square_height
+      ),
+      portraits.get_rect(piece.get_race(), piece.get_color(), piece.get_type())
     );
-    sprite.setOrigin(0.0, 0.0);
-    sprite.setPosition(
-      screen_position.get_x(),
-      screen_position.get_y()
-    );
-    view.get_window().draw(sprite);
     // text
     sf::Text text;
     text.setFont(view.get_resources().get_fonts().get_arial_font());
@@ -1006,6 +1052,129 @@ void show_unit_sprites(game_view& view, const side player_side)
     view.get_window().draw(text);
     screen_position += screen_coordinat(0, square_height);
   }
+  view.get_window().draw(sprites, &portraits.get_atlas().get_texture());
+}
+
+void game_view::simulate()
+{
+  m_frame_clock.restart();
+  while (!m_must_stop)
+  {
+    // Disard old messages
+    m_log.tick();
+
+    // Apply the user input
+    process_queued_events();
+
+    // One delta_t equals one second under normal game speed
+    const delta_t speed{to_delta_t(m_game.get_game_options().get_game_speed())};
+    bool is_waiting{false};
+    if (m_lockstep)
+    {
+      // A lockstep game is always ticked in fixed steps.
+      // While waiting for the other player, the steps accumulate,
+      // up to the maximum number of steps per frame
+      m_fixed_timestep.add(m_frame_clock.restart().asSeconds());
+      while (m_fixed_timestep.get_alpha() == 1.0)
+      {
+        if (!tick_lockstep())
+        {
+          is_waiting = true;
+          break;
+        }
+        m_fixed_timestep.take_step();
+      }
+    }
+    else if (get_tick_mode(m_game.get_game_options()) == tick_mode::fixed)
+    {
+      // Tick in fixed steps, so that the frame rate does not change the game
+      m_fixed_timestep.add(m_frame_clock.restart().asSeconds());
+      int n_steps{0};
+      while (m_fixed_timestep.take_step()) ++n_steps;
+      for (int i{0}; i != n_steps; ++i)
+      {
+        // Only the game before the last step is drawn
+        if (i == n_steps - 1) m_previous_game = std::make_shared<const game>(m_game);
+        tick(get_delta_t(m_fixed_timestep) * speed);
+      }
+    }
+    else
+    {
+      // Do a tick, by the time passed since the previous one
+      tick(delta_t(m_frame_clock.restart().asSeconds()) * speed);
+    }
+
+    // Read the pieces' messages and play their sounds
+    process_piece_messages();
+
+    // Publish the new state, to be drawn
+    m_snapshots.get_back() = game_snapshot(
+      m_game,
+      m_previous_game,
+      m_game_controller,
+      m_log,
+      m_fixed_timestep.get_alpha(),
+      m_fixed_timestep.get_step_secs()
+    );
+    m_snapshots.publish();
+
+    // Sleep until the next step is due.
+    // In the variable tick mode, the fixed timestep is not used,
+    // so tick at the same rate, by the time passed since the tick
+    const double step_secs{m_fixed_timestep.get_step_secs()};
+    const double secs_left{
+      is_waiting
+      ? step_secs
+      : !m_lockstep && get_tick_mode(m_game.get_game_options()) == tick_mode::variable
+      ? step_secs - m_frame_clock.getElapsedTime().asSeconds()
+      : (1.0 - m_fixed_timestep.get_alpha()) * step_secs
+    };
+    if (secs_left > 0.0) sf::sleep(sf::seconds(secs_left));
+  }
+  // The actions of the pieces are logged by this thread
+  write_log(std::clog, get_thread_log());
+}
+
+void game_view::tick(const delta_t& dt)
+{
+  // Let the computer players think within their time budget and act
+  for (auto& p: m_computer_players)
+  {
+    p.do_move(m_game_controller, m_game);
+  }
+  m_input_recorder.add(m_game_controller.get_user_inputs());
+  m_game_controller.apply_user_inputs_to_game(m_game);
+  m_input_recorder.tick(dt);
+  m_game.tick(dt);
+}
+
+bool game_view::tick_lockstep()
+{
+  assert(m_lockstep);
+  send_lockstep_user_inputs();
+  receive_lockstep_packets();
+  if (!m_lockstep->can_tick()) return false;
+
+  m_previous_game = std::make_shared<const game>(m_game);
+  m_input_recorder.add(m_lockstep->tick());
+  m_input_recorder.tick(m_lockstep->get_dt());
+
+  // The messages are read from the copy of the game
+  m_game = m_lockstep->get_game();
+  m_game_controller = m_lockstep->get_game_controller();
+  m_lockstep->clear_piece_messages();
+  return true;
+}
+
+void game_view::lose_lockstep_connection(const std::exception& e)
+{
+  log_message<log_level::error>(
+    [&e](std::ostream& os)
+    {
+      os << "The connection to the other player is lost: " << e.what();
+    }
+  );
+  m_lockstep_connection.reset();
 }
 
 void test_game_view() //!OCLINT tests may be many
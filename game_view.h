@@ -4,44 +4,96 @@
 #ifndef LOGIC_ONLY
 
 #include "ccfwd.h"
+#include "board_layer.h"
+#include "computer_player.h"
 #include "physical_controller.h"
 #include "game.h"
+#include "fixed_timestep.h"
 #include "fps_clock.h"
 #include "game_log.h"
 #include "game_controller.h"
 #include "game_resources.h"
+#include "game_snapshot.h"
 #include "game_view_layout.h"
+#include "input_recorder.h"
+#include "lockstep.h"
+#include "lockstep_connection.h"
+#include "spsc_queue.h"
+#include "triple_buffer.h"
+#include "unit_paths_overlay.h"
 
 #include <SFML/Graphics.hpp>
 
+#include <atomic>
+#include <exception>
+#include <fstream>
+#include <memory>
 #include <optional>
+#include <vector>
 
 /// The game's main window
-/// Displays the game class
+/// Displays the game class.
+///
+/// The game is simulated on a thread of its own, at a fixed rate,
+/// that publishes a \link{game_snapshot} each time it has ticked.
+/// The thread that created the window processes its events
+/// and draws the latest snapshot, so a slow frame or a wait
+/// for the vertical sync does not change the simulation's timing.
+/// The window events are passed to the simulation thread,
+/// which owns the game and the game controller
+///
+/// With a connection to another player, the game is played
+/// in \link{lockstep}: only the user inputs of the local player
+/// are used, which are sent to the other player,
+/// and the game is only ticked when the user inputs of both players
+/// for that tick are known
 class game_view
 {
 public:
+  /// @param computer_players the computer players,
+  ///   each of which plays at a side with a keyboard controller
+  /// @param connection the connection to the other player,
+  ///   to play a \link{lockstep} game with, if any
+  /// @param local_player the player at this side,
+  ///   only used in a \link{lockstep} game
   explicit game_view(
     const game& game = get_default_game(),
-    const game_controller& c = game_controller()
+    const game_controller& c = game_controller(),
+    const std::vector<computer_player>& computer_players = {},
+    std::unique_ptr<lockstep_connection> connection = {},
+    const side local_player = side::lhs
   );
 
   /// Run the game, until the user quits
   void exec();
 
+  /// Get the fraction of a fixed step to interpolate with
+  /// in the frame being drawn, see \link{get_alpha}
+  double get_alpha() const noexcept { return m_alpha; }
+
   /// The the elapsed time in seconds
   double get_elapsed_time_secs() const noexcept;
 
   int get_fps() const noexcept { return m_fps_clock.get_fps(); }
 
-  auto& get_game() noexcept { return m_game; }
+  /// Get the buffer to collect the piece actions in, reused every frame
+  auto& get_piece_actions() noexcept { return m_piece_actions; }
 
-  const auto& get_game() const noexcept { return m_game; }
+  /// Get the game as drawn, i.e. the latest snapshot of the simulation
+  const auto& get_game() const noexcept { return get_snapshot().get_game(); }
 
-  const auto& get_game_controller() const noexcept { return m_game_controller; }
+  /// Get the game controller as drawn
+  const auto& get_game_controller() const noexcept { return get_snapshot().get_game_controller(); }
 
   const auto& get_layout() const noexcept { return m_layout; }
 
+  /// Get the planned paths of the pieces, as drawn
+  auto& get_unit_paths_overlay() noexcept { return m_unit_paths_overlay; }
+
+  /// Get the game as it was one fixed step ago,
+  /// to interpolate between in the fixed tick mode
+  const auto& get_previous_game() const noexcept { return get_snapshot().get_previous_game(); }
+
   auto& get_resources() noexcept { return m_game_resources; }
 
   auto get_show_debug() const noexcept { return m_show_debug; }
@@ -49,24 +101,54 @@ public:
   bool get_show_squares_semitransparent() const noexcept { return true; }
 
   /// Get the text log, i.e. things pieces have to say
-  const auto& get_log() const noexcept { return m_log; }
+  const auto& get_log() const noexcept { return get_snapshot().get_log(); }
+
+  /// Is the game played in lockstep with another player?
+  bool is_lockstep() const noexcept { return m_lockstep.has_value(); }
+
+  /// Get the latest snapshot of the simulation, which is drawn
+  const game_snapshot& get_snapshot() const noexcept { return m_snapshots.get_front(); }
 
   auto& get_window() noexcept { return m_window; }
 
 private:
 
+  /// The fraction of a fixed step to interpolate with in this frame
+  double m_alpha;
+
+  /// The map, panels and squares, rendered once
+  board_layer m_board_layer;
+
   /// The game clock, to measure the elapsed time
   sf::Clock m_clock;
 
+  /// The computer players
+  std::vector<computer_player> m_computer_players;
+
+  /// The window events, from the render thread to the simulation thread
+  spsc_queue<sf::Event> m_events;
+
+  /// Hands out the real time in fixed steps, in the fixed tick mode
+  fixed_timestep m_fixed_timestep;
+
   /// The FPS clock
   fps_clock m_fps_clock;
 
+  /// Measures the time between two simulation steps
+  sf::Clock m_frame_clock;
+
   /// The game logic
   game m_game;
 
   /// The game controller, interacts with game
   game_controller m_game_controller;
 
+  /// The file the match is recorded to
+  std::ofstream m_input_recording_file;
+
+  /// Records all user inputs, so that the match can be replayed exactly
+  input_recorder m_input_recorder;
+
   /// The game logic
   game_view_layout m_layout;
 
@@ -76,27 +158,89 @@ private:
   /// The text log
   game_log m_log;
 
+  /// Must the simulation thread stop?
+  std::atomic<bool> m_must_stop;
+
+  /// The buffer to collect the piece actions in,
+  /// so that this is done without allocating memory every frame
+  std::vector<piece_action> m_piece_actions;
+
+  /// The connection to the other player, in a lockstep game.
+  /// Empty if the connection is lost
+  std::unique_ptr<lockstep_connection> m_lockstep_connection;
+
+  /// The lockstep game, which owns the game that is ticked.
+  /// 'm_game' and 'm_game_controller' are copies of its game
+  /// and game controller, to be drawn.
+  /// Empty if the game is not played in lockstep
+  std::optional<lockstep> m_lockstep;
+
+  /// The user inputs of the local player in a lockstep game,
+  /// that have not been sent yet
+  std::vector<user_input> m_lockstep_user_inputs;
+
+  /// The game one fixed step ago, in the fixed tick mode.
+  /// Shared with the snapshots, so that it is copied once per step.
+  /// Not updated in the variable tick mode, where it is not used
+  std::shared_ptr<const game> m_previous_game;
+
   /// Show the debug info
   bool m_show_debug;
 
+  /// The layout, as known by the simulation thread,
+  /// to convert the mouse events with
+  game_view_layout m_simulation_layout;
+
+  /// The snapshots the simulation thread publishes
+  /// and the render thread draws
+  triple_buffer<game_snapshot> m_snapshots;
+
+  /// The planned paths of the pieces, rebuilt only when these change
+  unit_paths_overlay m_unit_paths_overlay;
+
   /// The window to draw to
   sf::RenderWindow m_window;
 
   /// Play the new sound effects
   void play_pieces_sound_effects();
 
-  /// Process all events
+  /// Process all events, passing these to the simulation thread
   /// @return if the user wants to quit
   bool process_events();
 
   /// Read the pieces' messages and play their sounds
   void process_piece_messages();
 
+  /// Apply the window events passed by the render thread
+  void process_queued_events();
+
+  /// Log that the connection to the other player is lost,
+  /// after which the lockstep game is no longer ticked
+  void lose_lockstep_connection(const std::exception& e);
+
+  /// Receive the packets of the other player in a lockstep game
+  void receive_lockstep_packets();
+
+  /// Send the user inputs of the local player in a lockstep game,
+  /// if these are needed for the next tick
+  void send_lockstep_user_inputs();
+
+  /// Run the simulation, until the render thread stops it
+  void simulate();
+
   /// Show the game on-screen
   void show();
 
   /// Show the mouse cursor on-screen
   void show_mouse_cursor();
+
+  /// Let the computer players act, apply the user inputs,
+  /// then tick the game
+  void tick(const delta_t& dt);
+
+  /// Tick the lockstep game, if the user inputs of both players are known
+  /// @return true if the game is ticked
+  bool tick_lockstep();
 };
 
 /// Convert 'true' to 'true' and 'false' to 'false'
@@ -133,6 +277,12 @@ std::string get_last_log_messages(
   const side player
 ) noexcept;
 
+/// Get the time the current action of a piece has taken, as drawn.
+/// In the fixed tick mode, this is interpolated between the previous
+/// and the current game state, so that pieces move smoothly
+/// when there are more frames than ticks
+double get_interpolated_action_time(const game_view& v, const piece& p) noexcept;
+
 /// Get the layout
 const game_view_layout& get_layout(const game_view& v) noexcept;
 
@@ -176,7 +326,8 @@ void process_event(
   const game_view_layout& layout
 );
 
-/// Show the board: squares, unit paths, pieces, health bars
+/// Show the board: unit paths, pieces, health bars.
+/// The squares are part of the board layer
 void show_board(game_view& view);
 
 /// Show the controls (e.g. for a unit) on-screen for a player
@@ -185,15 +336,9 @@ void show_controls(game_view& view, const side player);
 /// Show debug info on-screen for a player
 void show_debug(game_view& view, const side player_side);
 
-/// Show the layout of the window: board and panels
-void show_layout(game_view& view);
-
 /// Show the log on-screen, i.e. things the pieces say
 void show_log(game_view& view, const side player);
 
-/// Show the map of the window
-void show_map(game_view& view);
-
 /// Show the squares that are occupied on-screen
 /// Throws if this option is turned off
 void show_occupied_squares(game_view& view);
@@ -209,9 +354,6 @@ void show_possible_moves(game_view& view);
 /// Show the info on the side-bar on-screen for a player
 void show_sidebar(game_view& view, const side player_side);
 
-/// Show the squares of the board on-screen
-void show_squares(game_view& view);
-
 /// Show the highlighted square under the cursor on-screen for a player
 void show_square_under_cursor(
   game_view& view,
@@ -1,13 +1,16 @@
 #include "id.h"
 
+#include <algorithm>
 #include <cassert>
 #include <iostream>
 #include <sstream>
+#include <thread>
+#include <vector>
 
-int id::sm_next_value{0};
+std::atomic<int> id::sm_next_value{0};
 
 id::id()
-  : m_value{sm_next_value++}
+  : m_value{sm_next_value.fetch_add(1, std::memory_order_relaxed)}
 {
 
 }
@@ -27,6 +30,35 @@ void test_id()
     assert(!(a == b));
     assert(a != b);
   }
+  // create_new_id is unique when called from multiple threads
+  {
+    const int n_ids_per_thread{1000};
+    std::vector<std::vector<int>> values(4);
+    std::vector<std::thread> threads;
+    for (auto& v: values)
+    {
+      threads.emplace_back(
+        [&v]()
+        {
+          for (int i{0}; i != n_ids_per_thread; ++i)
+          {
+            v.push_back(create_new_id().get());
+          }
+        }
+      );
+    }
+    for (auto& t: threads) t.join();
+    std::vector<int> all_values;
+    for (const auto& v: values)
+    {
+      all_values.insert(std::end(all_values), std::begin(v), std::end(v));
+    }
+    std::sort(std::begin(all_values), std::end(all_values));
+    assert(
+      std::adjacent_find(std::begin(all_values), std::end(all_values))
+      == std::end(all_values)
+    );
+  }
   // operator<<
   {
     const id i = create_new_id();
@@ -0,0 +1,261 @@
+#include "input_recorder.h"
+
+#include "game.h"
+#include "game_controller.h"
+#include "physical_controller.h"
+#include "physical_controllers.h"
+#include "resimulation.h"
+#include "user_input_type.h"
+#include "user_inputs.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <ctime>
+#include <iostream>
+#include <random>
+#include <sstream>
+
+input_recorder::input_recorder(
+  std::ostream& os,
+  const game& g,
+  const game_controller& c
+) : m_is_closed{false},
+    m_n_ticks{0},
+    m_os{os},
+    m_record_tick{0}
+{
+  // Write the index of an enum value
+  const auto write_index{
+    [this](const auto value, const auto& all_values)
+    {
+      const auto there{std::find(std::begin(all_values), std::end(all_values), value)};
+      assert(there != std::end(all_values));
+      write_varint(m_os, std::distance(std::begin(all_values), there));
+    }
+  };
+  const auto& go{g.get_game_options()};
+  const auto& lo{g.get_lobby_options()};
+  write_fixed(m_os, get_input_recording_magic(), 4);
+  write_fixed(m_os, get_input_recording_version(), 1);
+  write_index(go.get_starting_position(), get_all_starting_position_types());
+  write_index(go.get_game_speed(), get_all_game_speeds());
+  write_index(go.get_tick_mode(), get_all_tick_modes());
+  write_index(lo.get_color(side::lhs), get_all_chess_colors());
+  write_index(lo.get_race(side::lhs), get_all_races());
+  write_index(lo.get_race(side::rhs), get_all_races());
+  for (const side player: { side::lhs, side::rhs })
+  {
+    write_varint(m_os, static_cast<std::uint64_t>(c.get_physical_controller(player).get_type()));
+  }
+}
+
+void input_recorder::add(const user_inputs& inputs)
+{
+  assert(!m_is_closed);
+  for (const auto& input: inputs.get_user_inputs())
+  {
+    write_record_start(input_record_kind::user_input);
+    const auto type_index{static_cast<std::uint64_t>(input.get_user_input_type())};
+    assert(type_index < 0b10000);
+    const std::uint64_t player_flag{input.get_player() == side::lhs ? 0u : 0b10000u};
+    const auto& coordinat{input.get_coordinat()};
+    if (!coordinat)
+    {
+      write_fixed(m_os, type_index | player_flag, 1);
+      continue;
+    }
+    // Mouse positions often are a whole number of pixels
+    // on a board with a power-of-two size, which a float holds exactly
+    const float x{static_cast<float>(coordinat->get_x())};
+    const float y{static_cast<float>(coordinat->get_y())};
+    if (static_cast<double>(x) == coordinat->get_x()
+      && static_cast<double>(y) == coordinat->get_y()
+    )
+    {
+      std::uint32_t x_bits{0};
+      std::uint32_t y_bits{0};
+      std::memcpy(&x_bits, &x, sizeof(x));
+      std::memcpy(&y_bits, &y, sizeof(y));
+      write_fixed(m_os, type_index | player_flag | 0b100000, 1);
+      write_fixed(m_os, x_bits, 4);
+      write_fixed(m_os, y_bits, 4);
+    }
+    else
+    {
+      const double dx{coordinat->get_x()};
+      const double dy{coordinat->get_y()};
+      std::uint64_t x_bits{0};
+      std::uint64_t y_bits{0};
+      std::memcpy(&x_bits, &dx, sizeof(dx));
+      std::memcpy(&y_bits, &dy, sizeof(dy));
+      write_fixed(m_os, type_index | player_flag, 1);
+      write_fixed(m_os, x_bits, 8);
+      write_fixed(m_os, y_bits, 8);
+    }
+  }
+}
+
+void input_recorder::close()
+{
+  assert(!m_is_closed);
+  write_record_start(input_record_kind::end);
+  m_os.flush();
+  m_is_closed = true;
+}
+
+std::string create_input_recording_filename()
+{
+  const std::time_t now{std::time(nullptr)};
+  char s[32];
+  std::strftime(s, sizeof(s), "%Y%m%d_%H%M%S", std::localtime(&now));
+  return "conquer_chess_" + std::string(s) + ".ccir";
+}
+
+void input_recorder::tick(const delta_t& dt)
+{
+  assert(!m_is_closed);
+  if (!m_last_delta_t || !(*m_last_delta_t == dt))
+  {
+    write_record_start(input_record_kind::delta_t);
+    const double d{dt.get()};
+    std::uint64_t bits{0};
+    std::memcpy(&bits, &d, sizeof(d));
+    write_fixed(m_os, bits, 8);
+    m_last_delta_t = dt;
+  }
+  ++m_n_ticks;
+}
+
+void input_recorder::write_record_start(const input_record_kind kind)
+{
+  assert(m_n_ticks >= m_record_tick);
+  const auto n_ticks_since{static_cast<std::uint64_t>(m_n_ticks - m_record_tick)};
+  write_varint(m_os, (n_ticks_since << 2) | static_cast<std::uint64_t>(kind));
+  m_record_tick = m_n_ticks;
+}
+
+void test_input_recorder()
+{
+#ifndef NDEBUG
+  // input_recorder::input_recorder writes the header
+  {
+    std::stringstream s;
+    const input_recorder r(s, game(), game_controller());
+    assert(s.str().size() == 4 + 1 + 8);
+    assert(r.get_n_ticks() == 0);
+    assert(!r.is_closed());
+  }
+  // input_recorder::add, a key press takes 2 bytes
+  {
+    std::stringstream s;
+    input_recorder r(s, game(), game_controller());
+    const auto header_size{s.str().size()};
+    r.add(user_inputs({create_press_up_action(side::lhs)}));
+    assert(s.str().size() == header_size + 2);
+  }
+  // input_recorder::add, a mouse move on whole pixels takes 10 bytes
+  {
+    std::stringstream s;
+    input_recorder r(s, game(), game_controller());
+    const auto header_size{s.str().size()};
+    r.add(user_inputs({create_mouse_move_action(game_coordinat(2.5, 3.125), side::rhs)}));
+    assert(s.str().size() == header_size + 10);
+  }
+  // input_recorder::tick, in fixed steps the time per tick is written once
+  {
+    std::stringstream s;
+    input_recorder r(s, game(), game_controller());
+    const auto header_size{s.str().size()};
+    for (int i{0}; i != 1000; ++i) r.tick(delta_t(1.0 / 120.0));
+    assert(r.get_n_ticks() == 1000);
+    assert(s.str().size() == header_size + 1 + 8);
+    r.close();
+    assert(r.is_closed());
+    assert(s.str().size() == header_size + 1 + 8 + 2);
+  }
+  // read_input_recording reads what the input recorder wrote
+  {
+    game_options go{create_default_game_options()};
+    go.set_starting_position(starting_position_type::kings_only);
+    go.set_tick_mode(tick_mode::fixed);
+    const lobby_options lo(chess_color::black, race::protoss, race::zerg);
+    std::stringstream s;
+    input_recorder r(s, game(go, lo), game_controller(create_keyboard_mouse_controllers()));
+    r.add(user_inputs({create_press_up_action(side::lhs)}));
+    r.tick(delta_t(0.1));
+    r.tick(delta_t(0.1));
+    r.add(user_inputs({create_mouse_move_action(game_coordinat(1.0 / 3.0, 0.5), side::rhs)}));
+    r.tick(delta_t(0.2));
+    r.close();
+    const input_recording expected(
+      go,
+      lo,
+      physical_controller_type::keyboard,
+      physical_controller_type::mouse,
+      {
+        std::make_pair(0, create_press_up_action(side::lhs)),
+        std::make_pair(2, create_mouse_move_action(game_coordinat(1.0 / 3.0, 0.5), side::rhs))
+      },
+      {
+        std::make_pair(0, delta_t(0.1)),
+        std::make_pair(2, delta_t(0.2))
+      },
+      3
+    );
+    assert(read_input_recording(s) == expected);
+  }
+  // read_input_recording reads a recording that was not closed
+  {
+    std::stringstream s;
+    input_recorder r(s, game(), game_controller());
+    r.tick(delta_t(0.1));
+    r.add(user_inputs({create_press_up_action(side::lhs)}));
+    r.tick(delta_t(0.1));
+    const auto recording{read_input_recording(s)};
+    assert(recording.get_n_ticks() == 1);
+    assert(recording.get_timed_user_inputs().size() == 1);
+  }
+  // resimulate gives the recorded game
+  {
+    game g;
+    game_controller c(create_two_keyboard_controllers());
+    std::stringstream s;
+    input_recorder r(s, g, c);
+    const std::vector<user_input_type> types{
+      user_input_type::press_action_1,
+      user_input_type::press_action_2,
+      user_input_type::press_down,
+      user_input_type::press_left,
+      user_input_type::press_right,
+      user_input_type::press_up
+    };
+    std::default_random_engine rng(42);
+    std::uniform_int_distribution<int> type_distribution(0, static_cast<int>(types.size()) - 1);
+    std::uniform_real_distribution<double> dt_distribution(0.005, 0.02);
+    for (int i{0}; i != 1000; ++i)
+    {
+      if (i % 3 == 0)
+      {
+        const side player{i % 2 == 0 ? side::lhs : side::rhs};
+        c.add_user_input(user_input(types[type_distribution(rng)], player));
+      }
+      r.add(c.get_user_inputs());
+      c.apply_user_inputs_to_game(g);
+      const delta_t dt(dt_distribution(rng));
+      r.tick(dt);
+      g.tick(dt);
+    }
+    r.close();
+    const game resimulated{resimulate(read_input_recording(s))};
+    assert(resimulated.get_pieces() == g.get_pieces());
+    assert(resimulated.get_time() == g.get_time());
+    assert(get_hash(resimulated) == get_hash(g));
+  }
+  // create_input_recording_filename
+  {
+    const auto filename{create_input_recording_filename()};
+    assert(filename.substr(filename.size() - 5) == ".ccir");
+  }
+#endif // NDEBUG
+}
@@ -0,0 +1,104 @@
+#ifndef INPUT_RECORDER_H
+#define INPUT_RECORDER_H
+
+#include "ccfwd.h"
+#include "delta_t.h"
+#include "input_recording.h"
+
+#include <iosfwd>
+#include <optional>
+#include <string>
+
+/// Writes an \link{input_recording} while the game is played,
+/// so that nothing is kept in memory and a crash loses at most
+/// what the stream has not flushed yet.
+///
+/// Call \link{input_recorder::add} with the user inputs
+/// just before these are applied to the game,
+/// \link{input_recorder::tick} just before the game is ticked
+/// and \link{input_recorder::close} when the game is over.
+///
+/// All fixed-width values are little-endian, varints are unsigned LEB128,
+/// see \link{write_varint}. The stream starts with a header:
+///
+/// Bytes  | Value
+/// -------|-----------------------------------------
+/// 4      | magic, 'CCIR'
+/// 1      | format version, 1
+/// varint | starting position
+/// varint | game speed
+/// varint | tick mode
+/// varint | color of the LHS player
+/// varint | race of the LHS player
+/// varint | race of the RHS player
+/// varint | physical controller type of the LHS player
+/// varint | physical controller type of the RHS player
+///
+/// followed by records. Each record starts with a varint
+/// that holds the number of ticks since the previous record,
+/// shifted left by 2 bits, and the \link{input_record_kind} in the lower 2 bits.
+///
+/// Kind       | Bytes    | Value
+/// -----------|----------|-----------------------------------------
+/// user_input | 1        | bits 0-3: user input type, bit 4: 1 if RHS player, bit 5: 1 if the coordinat is stored as floats
+/// user_input | 8 or 16  | only for a mouse move: x and y, as floats or doubles
+/// delta_t    | 8        | the time per tick from this tick on, as a double
+/// end        | 0        | the number of ticks done
+///
+/// A key press takes 2 bytes, a mouse move 10 or 18 bytes.
+/// In \link{tick_mode::fixed} each tick takes equally long,
+/// so there is only one delta_t record.
+class input_recorder
+{
+public:
+  /// Writes the header to the stream right away
+  explicit input_recorder(
+    std::ostream& os,
+    const game& g,
+    const game_controller& c
+  );
+
+  /// Record the user inputs that are applied before the next tick
+  void add(const user_inputs& inputs);
+
+  /// Write the end record. Nothing can be recorded after this
+  void close();
+
+  /// Get the number of ticks recorded
+  int get_n_ticks() const noexcept { return m_n_ticks; }
+
+  /// Has the recording been closed?
+  bool is_closed() const noexcept { return m_is_closed; }
+
+  /// Record that the game is ticked
+  void tick(const delta_t& dt);
+
+private:
+
+  /// Has the recording been closed?
+  bool m_is_closed;
+
+  /// The time per tick of the previous tick, if any
+  std::optional<delta_t> m_last_delta_t;
+
+  /// The number of ticks recorded
+  int m_n_ticks;
+
+  /// The stream written to
+  std::ostream& m_os;
+
+  /// The tick of the record written last
+  int m_record_tick;
+
+  /// Write the start of a record
+  void write_record_start(const input_record_kind kind);
+};
+
+/// Create a filename for a recording of a match started now,
+/// e.g. 'conquer_chess_20240131_235959.ccir'
+std::string create_input_recording_filename();
+
+/// Test this class and its free functions
+void test_input_recorder();
+
+#endif // INPUT_RECORDER_H
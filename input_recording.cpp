@@ -0,0 +1,357 @@
+#include "input_recording.h"
+
+#include "physical_controller.h"
+#include "physical_controllers.h"
+#include "user_input_type.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+
+input_recording::input_recording(
+  const game_options& go,
+  const lobby_options& lo,
+  const physical_controller_type lhs_controller_type,
+  const physical_controller_type rhs_controller_type,
+  const std::vector<std::pair<int, user_input>>& timed_user_inputs,
+  const std::vector<std::pair<int, delta_t>>& timed_delta_ts,
+  const int n_ticks
+) : m_game_options{go},
+    m_lhs_controller_type{lhs_controller_type},
+    m_lobby_options{lo},
+    m_n_ticks{n_ticks},
+    m_rhs_controller_type{rhs_controller_type},
+    m_timed_delta_ts{timed_delta_ts},
+    m_timed_user_inputs{timed_user_inputs}
+{
+  assert(m_n_ticks >= 0);
+  assert(
+    std::is_sorted(
+      std::begin(m_timed_user_inputs),
+      std::end(m_timed_user_inputs),
+      [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; }
+    )
+  );
+  assert(m_timed_user_inputs.empty() || m_timed_user_inputs.back().first <= m_n_ticks);
+  assert(m_timed_delta_ts.empty() || m_timed_delta_ts.back().first < m_n_ticks);
+}
+
+physical_controller_type input_recording::get_controller_type(const side player) const noexcept
+{
+  return player == side::lhs ? m_lhs_controller_type : m_rhs_controller_type;
+}
+
+physical_controllers get_physical_controllers(const input_recording& r)
+{
+  return physical_controllers(
+    {
+      r.get_controller_type(side::lhs) == physical_controller_type::keyboard
+        ? create_left_keyboard_controller()
+        : create_default_mouse_controller(),
+      r.get_controller_type(side::rhs) == physical_controller_type::keyboard
+        ? create_right_keyboard_controller()
+        : create_default_mouse_controller()
+    }
+  );
+}
+
+std::uint64_t read_fixed(std::istream& is, const int n_bytes)
+{
+  assert(n_bytes <= 8);
+  std::uint64_t value{0};
+  for (int i{0}; i != n_bytes; ++i)
+  {
+    const int c{is.get()};
+    if (c == std::char_traits<char>::eof())
+    {
+      throw std::invalid_argument("Input recording ends within a value");
+    }
+    value |= static_cast<std::uint64_t>(c) << (8 * i);
+  }
+  return value;
+}
+
+input_recording read_input_recording(std::istream& is)
+{
+  if (read_fixed(is, 4) != get_input_recording_magic())
+  {
+    throw std::invalid_argument("Not an input recording");
+  }
+  if (read_fixed(is, 1) != get_input_recording_version())
+  {
+    throw std::invalid_argument("Unknown input recording version");
+  }
+  // Read the index of an enum value
+  const auto read_index{
+    [&is](const std::size_t n_values) -> std::size_t
+    {
+      const std::uint64_t index{read_varint(is)};
+      if (index >= n_values)
+      {
+        throw std::invalid_argument("Invalid enum value in input recording");
+      }
+      return index;
+    }
+  };
+  const auto read_double{
+    [&is]()
+    {
+      const std::uint64_t bits{read_fixed(is, 8)};
+      double d{0.0};
+      std::memcpy(&d, &bits, sizeof(d));
+      return d;
+    }
+  };
+  game_options go{create_default_game_options()};
+  go.set_starting_position(get_all_starting_position_types()[read_index(get_all_starting_position_types().size())]);
+  go.set_game_speed(get_all_game_speeds()[read_index(get_all_game_speeds().size())]);
+  go.set_tick_mode(get_all_tick_modes()[read_index(get_all_tick_modes().size())]);
+  const chess_color lhs_color{get_all_chess_colors()[read_index(get_all_chess_colors().size())]};
+  const race lhs_race{get_all_races()[read_index(get_all_races().size())]};
+  const race rhs_race{get_all_races()[read_index(get_all_races().size())]};
+  const lobby_options lo(lhs_color, lhs_race, rhs_race);
+  const std::vector<physical_controller_type> controller_types{
+    physical_controller_type::keyboard,
+    physical_controller_type::mouse
+  };
+  const physical_controller_type lhs_controller_type{controller_types[read_index(controller_types.size())]};
+  const physical_controller_type rhs_controller_type{controller_types[read_index(controller_types.size())]};
+
+  const auto user_input_types{get_all_user_input_types()};
+  std::vector<std::pair<int, user_input>> timed_user_inputs;
+  std::vector<std::pair<int, delta_t>> timed_delta_ts;
+  std::uint64_t tick{0};
+  while (is.peek() != std::char_traits<char>::eof())
+  {
+    const std::uint64_t record{read_varint(is)};
+    tick += record >> 2;
+    if (tick > static_cast<std::uint64_t>(std::numeric_limits<int>::max()))
+    {
+      throw std::invalid_argument("Too many ticks in input recording");
+    }
+    const auto kind{record & 0b11};
+    if (kind == static_cast<std::uint64_t>(input_record_kind::user_input))
+    {
+      const auto flags{read_fixed(is, 1)};
+      const auto type_index{flags & 0b1111};
+      if (type_index >= user_input_types.size())
+      {
+        throw std::invalid_argument("Invalid user input type in input recording");
+      }
+      const user_input_type type{user_input_types[type_index]};
+      const side player{(flags & 0b10000) == 0 ? side::lhs : side::rhs};
+      std::optional<game_coordinat> coordinat;
+      if (does_input_type_need_coordinat(type))
+      {
+        if ((flags & 0b100000) != 0)
+        {
+          const auto x_bits{static_cast<std::uint32_t>(read_fixed(is, 4))};
+          const auto y_bits{static_cast<std::uint32_t>(read_fixed(is, 4))};
+          float x{0.0f};
+          float y{0.0f};
+          std::memcpy(&x, &x_bits, sizeof(x));
+          std::memcpy(&y, &y_bits, sizeof(y));
+          coordinat = game_coordinat(x, y);
+        }
+        else
+        {
+          const double x{read_double()};
+          const double y{read_double()};
+          coordinat = game_coordinat(x, y);
+        }
+      }
+      timed_user_inputs.push_back(
+        std::make_pair(static_cast<int>(tick), user_input(type, player, coordinat))
+      );
+    }
+    else if (kind == static_cast<std::uint64_t>(input_record_kind::delta_t))
+    {
+      timed_delta_ts.push_back(
+        std::make_pair(static_cast<int>(tick), delta_t(read_double()))
+      );
+    }
+    else if (kind == static_cast<std::uint64_t>(input_record_kind::end))
+    {
+      break;
+    }
+    else
+    {
+      throw std::invalid_argument("Invalid record in input recording");
+    }
+  }
+  // Without an end record, the last time per tick has not been used yet
+  if (!timed_delta_ts.empty() && timed_delta_ts.back().first == static_cast<int>(tick))
+  {
+    timed_delta_ts.pop_back();
+  }
+  return input_recording(
+    go,
+    lo,
+    lhs_controller_type,
+    rhs_controller_type,
+    timed_user_inputs,
+    timed_delta_ts,
+    static_cast<int>(tick)
+  );
+}
+
+std::uint64_t read_varint(std::istream& is)
+{
+  std::uint64_t value{0};
+  for (int shift{0}; shift < 64; shift += 7)
+  {
+    const auto byte{read_fixed(is, 1)};
+    value |= (byte & 0x7f) << shift;
+    if ((byte & 0x80) == 0) return value;
+  }
+  throw std::invalid_argument("Varint too long in input recording");
+}
+
+void test_input_recording()
+{
+#ifndef NDEBUG
+  // write_varint and read_varint are symmetric
+  {
+    for (const std::uint64_t value: { 0ull, 1ull, 127ull, 128ull, 300ull, 0xffffffffffffffffull })
+    {
+      std::stringstream s;
+      write_varint(s, value);
+      assert(read_varint(s) == value);
+    }
+  }
+  // write_varint, values below 128 take 1 byte
+  {
+    std::stringstream s;
+    write_varint(s, 127);
+    assert(s.str().size() == 1);
+  }
+  // write_varint, 2^14 takes 3 bytes
+  {
+    std::stringstream s;
+    write_varint(s, 1 << 14);
+    assert(s.str().size() == 3);
+  }
+  // write_fixed and read_fixed are symmetric
+  {
+    std::stringstream s;
+    write_fixed(s, 0x0123456789abcdefull, 8);
+    write_fixed(s, 0xabc, 2);
+    assert(s.str().size() == 10);
+    assert(read_fixed(s, 8) == 0x0123456789abcdefull);
+    assert(read_fixed(s, 2) == 0xabc);
+  }
+  // read_varint throws on a stream that ends within the varint
+  {
+    std::stringstream s;
+    s.put(static_cast<char>(0x80));
+    bool has_thrown{false};
+    try
+    {
+      read_varint(s);
+    }
+    catch (const std::invalid_argument&)
+    {
+      has_thrown = true;
+    }
+    assert(has_thrown);
+  }
+  // read_input_recording throws on something that is not an input recording
+  {
+    std::stringstream s;
+    s << "1. e4 e5 2. Nc3";
+    bool has_thrown{false};
+    try
+    {
+      read_input_recording(s);
+    }
+    catch (const std::invalid_argument&)
+    {
+      has_thrown = true;
+    }
+    assert(has_thrown);
+  }
+  // get_physical_controllers
+  {
+    const input_recording r(
+      create_default_game_options(),
+      create_default_lobby_options(),
+      physical_controller_type::keyboard,
+      physical_controller_type::mouse,
+      {},
+      {},
+      0
+    );
+    const auto controllers{get_physical_controllers(r)};
+    assert(controllers.get_controller(side::lhs).get_type() == physical_controller_type::keyboard);
+    assert(controllers.get_controller(side::rhs).get_type() == physical_controller_type::mouse);
+  }
+  // operator<<
+  {
+    const input_recording r(
+      create_default_game_options(),
+      create_default_lobby_options(),
+      physical_controller_type::keyboard,
+      physical_controller_type::mouse,
+      { std::make_pair(3, create_press_up_action(side::lhs)) },
+      {},
+      5
+    );
+    std::stringstream s;
+    s << r;
+    assert(!s.str().empty());
+  }
+#endif // NDEBUG
+}
+
+void write_fixed(std::ostream& os, const std::uint64_t value, const int n_bytes)
+{
+  assert(n_bytes <= 8);
+  for (int i{0}; i != n_bytes; ++i)
+  {
+    os.put(static_cast<char>(value >> (8 * i)));
+  }
+}
+
+void write_varint(std::ostream& os, std::uint64_t value)
+{
+  while (value >= 0x80)
+  {
+    os.put(static_cast<char>((value & 0x7f) | 0x80));
+    value >>= 7;
+  }
+  os.put(static_cast<char>(value));
+}
+
+bool operator==(const input_recording& lhs, const input_recording& rhs) noexcept
+{
+  return lhs.get_game_options() == rhs.get_game_options()
+    && lhs.get_lobby_options().get_color(side::lhs) == rhs.get_lobby_options().get_color(side::lhs)
+    && lhs.get_lobby_options().get_race(side::lhs) == rhs.get_lobby_options().get_race(side::lhs)
+    && lhs.get_lobby_options().get_race(side::rhs) == rhs.get_lobby_options().get_race(side::rhs)
+    && lhs.get_controller_type(side::lhs) == rhs.get_controller_type(side::lhs)
+    && lhs.get_controller_type(side::rhs) == rhs.get_controller_type(side::rhs)
+    && lhs.get_timed_user_inputs() == rhs.get_timed_user_inputs()
+    && lhs.get_timed_delta_ts() == rhs.get_timed_delta_ts()
+    && lhs.get_n_ticks() == rhs.get_n_ticks()
+  ;
+}
+
+std::ostream& operator<<(std::ostream& os, const input_recording& r) noexcept
+{
+  os
+    << "Starting position: " << r.get_game_options().get_starting_position() << '\n'
+    << "LHS: " << r.get_lobby_options().get_color(side::lhs)
+    << " " << r.get_lobby_options().get_race(side::lhs)
+    << " with " << r.get_controller_type(side::lhs) << '\n'
+    << "RHS: " << r.get_lobby_options().get_color(side::rhs)
+    << " " << r.get_lobby_options().get_race(side::rhs)
+    << " with " << r.get_controller_type(side::rhs) << '\n'
+    << "Number of ticks: " << r.get_n_ticks() << '\n'
+    << "Number of user inputs: " << r.get_timed_user_inputs().size() << '\n'
+  ;
+  return os;
+}
@@ -0,0 +1,121 @@
+#ifndef INPUT_RECORDING_H
+#define INPUT_RECORDING_H
+
+#include "ccfwd.h"
+#include "delta_t.h"
+#include "game_options.h"
+#include "lobby_options.h"
+#include "physical_controller_type.h"
+#include "user_input.h"
+
+#include <cstdint>
+#include <iosfwd>
+#include <utility>
+#include <vector>
+
+/// A recorded match: the settings it started with
+/// and all user inputs, each with the tick they were applied at.
+///
+/// Unlike a \link{replay}, which only knows chess moves,
+/// this can be re-simulated exactly, see \link{resimulate}.
+///
+/// It is written by an \link{input_recorder}
+/// and read by \link{read_input_recording}
+class input_recording
+{
+public:
+  explicit input_recording(
+    const game_options& go,
+    const lobby_options& lo,
+    const physical_controller_type lhs_controller_type,
+    const physical_controller_type rhs_controller_type,
+    const std::vector<std::pair<int, user_input>>& timed_user_inputs,
+    const std::vector<std::pair<int, delta_t>>& timed_delta_ts,
+    const int n_ticks
+  );
+
+  /// Get the type of the physical controller of a player
+  physical_controller_type get_controller_type(const side player) const noexcept;
+
+  const auto& get_game_options() const noexcept { return m_game_options; }
+
+  const auto& get_lobby_options() const noexcept { return m_lobby_options; }
+
+  /// Get the number of ticks done
+  int get_n_ticks() const noexcept { return m_n_ticks; }
+
+  /// Get the time per tick, each with the first tick it is used at
+  const auto& get_timed_delta_ts() const noexcept { return m_timed_delta_ts; }
+
+  /// Get the user inputs, each with the tick it was applied at,
+  /// in the order they were applied
+  const auto& get_timed_user_inputs() const noexcept { return m_timed_user_inputs; }
+
+private:
+
+  game_options m_game_options;
+
+  physical_controller_type m_lhs_controller_type;
+
+  lobby_options m_lobby_options;
+
+  int m_n_ticks;
+
+  physical_controller_type m_rhs_controller_type;
+
+  std::vector<std::pair<int, delta_t>> m_timed_delta_ts;
+
+  std::vector<std::pair<int, user_input>> m_timed_user_inputs;
+};
+
+/// The kind of a record in an input recording,
+/// see \link{input_recorder} for the format
+enum class input_record_kind
+{
+  user_input,
+  delta_t,
+  end
+};
+
+/// Get the magic bytes that an input recording starts with
+constexpr std::uint32_t get_input_recording_magic() noexcept { return 0x52494343; } // 'CCIR'
+
+/// Get the version of the input recording format
+constexpr int get_input_recording_version() noexcept { return 1; }
+
+/// Get the physical controllers used in a recording,
+/// with the default key bindings, as these are not recorded
+physical_controllers get_physical_controllers(const input_recording& r);
+
+/// Read a little-endian integer of 'n_bytes' bytes.
+/// Throws a std::invalid_argument if the stream ends before
+std::uint64_t read_fixed(std::istream& is, const int n_bytes);
+
+/// Read an input recording.
+///
+/// A recording that stops without an end record,
+/// e.g. because the game crashed, is read up to its last record.
+/// Throws a std::invalid_argument if the stream is not an input recording
+input_recording read_input_recording(std::istream& is);
+
+/// Read an unsigned LEB128 varint.
+/// Throws a std::invalid_argument if the stream ends before
+/// or the value does not fit in 64 bits
+std::uint64_t read_varint(std::istream& is);
+
+/// Test this class and its free functions
+void test_input_recording();
+
+/// Write a little-endian integer of 'n_bytes' bytes
+void write_fixed(std::ostream& os, const std::uint64_t value, const int n_bytes);
+
+/// Write an unsigned LEB128 varint: 7 bits per byte,
+/// with the highest bit set on all bytes but the last,
+/// so that values below 128 take 1 byte
+void write_varint(std::ostream& os, std::uint64_t value);
+
+bool operator==(const input_recording& lhs, const input_recording& rhs) noexcept;
+
+std::ostream& operator<<(std::ostream& os, const input_recording& r) noexcept;
+
+#endif // INPUT_RECORDING_H
@@ -0,0 +1,178 @@
+#include "keyframed_replay.h"
+
+#include "input_recording.h"
+#include "physical_controllers.h"
+#include "user_input.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+keyframed_replay::keyframed_replay(
+  const input_recording& r,
+  const int keyframe_interval
+) : m_current(r),
+    m_keyframe_interval{keyframe_interval},
+    m_keyframes{m_current},
+    m_n_ticks_simulated{0}
+{
+  assert(m_keyframe_interval > 0);
+  // Play the whole match once, so that every seek
+  // needs at most 'm_keyframe_interval' ticks
+  resimulation s{m_current};
+  const int n_ticks{get_n_ticks(s)};
+  while (s.get_tick() < n_ticks)
+  {
+    s.tick();
+    ++m_n_ticks_simulated;
+    if (s.get_tick() % m_keyframe_interval == 0) m_keyframes.push_back(s);
+  }
+}
+
+int get_n_ticks(const keyframed_replay& r) noexcept
+{
+  return r.get_recording().get_n_ticks();
+}
+
+int get_tick_at_fraction(const keyframed_replay& r, const double f) noexcept
+{
+  const double g{std::clamp(f, 0.0, 1.0)};
+  return static_cast<int>(std::round(g * get_n_ticks(r)));
+}
+
+void keyframed_replay::seek(const int tick)
+{
+  assert(tick >= 0);
+  assert(tick <= get_n_ticks(m_current));
+  const int n_keyframes{static_cast<int>(m_keyframes.size())};
+  const int keyframe_index{std::min(tick / m_keyframe_interval, n_keyframes - 1)};
+  const int keyframe_tick{keyframe_index * m_keyframe_interval};
+  // Only go to a keyframe if that is closer than the current tick
+  if (tick < get_tick() || keyframe_tick > get_tick())
+  {
+    m_current = m_keyframes[keyframe_index];
+  }
+  while (get_tick() < tick)
+  {
+    this->tick();
+  }
+  assert(get_tick() == tick);
+}
+
+void step_backward(keyframed_replay& r)
+{
+  if (r.get_tick() > 0) r.seek(r.get_tick() - 1);
+}
+
+void step_forward(keyframed_replay& r)
+{
+  if (r.get_tick() < get_n_ticks(r)) r.seek(r.get_tick() + 1);
+}
+
+void keyframed_replay::tick()
+{
+  m_current.tick();
+  ++m_n_ticks_simulated;
+}
+
+void test_keyframed_replay()
+{
+#ifndef NDEBUG
+  // A recording of 1000 ticks, in which both players
+  // move their cursors up and press the first action key now and then
+  const auto create_test_recording{
+    []()
+    {
+      std::vector<std::pair<int, user_input>> timed_user_inputs;
+      for (int tick{0}; tick < 1000; tick += 7)
+      {
+        const side player{tick % 2 == 0 ? side::lhs : side::rhs};
+        timed_user_inputs.push_back(
+          std::make_pair(tick, tick % 3 == 0 ? create_press_action_1(player) : create_press_up_action(player))
+        );
+      }
+      return input_recording(
+        create_default_game_options(),
+        create_default_lobby_options(),
+        physical_controller_type::keyboard,
+        physical_controller_type::keyboard,
+        timed_user_inputs,
+        { std::make_pair(0, delta_t(0.05)) },
+        1000
+      );
+    }
+  };
+  const input_recording recording{create_test_recording()};
+  // keyframed_replay::keyframed_replay stores all keyframes
+  {
+    const keyframed_replay r(recording, 100);
+    assert(r.get_tick() == 0);
+    assert(r.get_n_keyframes() == 11);
+    assert(r.get_n_ticks_simulated() == 1000);
+    assert(get_n_ticks(r) == 1000);
+    assert(r.get_keyframe_interval() == 100);
+  }
+  // keyframed_replay::seek to the end starts from the last keyframe
+  {
+    keyframed_replay r(recording, 100);
+    r.seek(1000);
+    assert(r.get_n_ticks_simulated() == 1000);
+    assert(get_hash(r.get_game()) == get_hash(resimulate(recording)));
+  }
+  // keyframed_replay::seek to an unplayed tick starts from the nearest keyframe
+  {
+    keyframed_replay r(recording, 100);
+    r.seek(950);
+    assert(r.get_n_ticks_simulated() == 1000 + 50);
+  }
+  // keyframed_replay::seek backward starts from the nearest keyframe
+  {
+    keyframed_replay r(recording, 100);
+    r.seek(1000);
+    r.seek(450);
+    assert(r.get_tick() == 450);
+    assert(r.get_n_ticks_simulated() == 1000 + 50);
+    resimulation s(recording);
+    while (s.get_tick() != 450) s.tick();
+    assert(get_hash(r.get_game()) == get_hash(s.get_game()));
+    assert(r.get_game().get_pieces() == s.get_game().get_pieces());
+  }
+  // keyframed_replay::seek forward continues from the current tick
+  // if that is closer than a keyframe
+  {
+    keyframed_replay r(recording, 100);
+    r.seek(150);
+    r.seek(180);
+    assert(r.get_n_ticks_simulated() == 1000 + 50 + 30);
+  }
+  // keyframed_replay::seek forward goes to a keyframe if that is closer
+  {
+    keyframed_replay r(recording, 100);
+    r.seek(10);
+    r.seek(820);
+    assert(r.get_n_ticks_simulated() == 1000 + 10 + 20);
+  }
+  // step_backward and step_forward
+  {
+    keyframed_replay r(recording, 100);
+    step_backward(r);
+    assert(r.get_tick() == 0);
+    step_forward(r);
+    step_forward(r);
+    assert(r.get_tick() == 2);
+    step_backward(r);
+    assert(r.get_tick() == 1);
+    r.seek(1000);
+    step_forward(r);
+    assert(r.get_tick() == 1000);
+  }
+  // get_tick_at_fraction
+  {
+    const keyframed_replay r(recording, 100);
+    assert(get_tick_at_fraction(r, 0.0) == 0);
+    assert(get_tick_at_fraction(r, 0.5) == 500);
+    assert(get_tick_at_fraction(r, 1.0) == 1000);
+    assert(get_tick_at_fraction(r, 2.0) == 1000);
+  }
+#endif // NDEBUG
+}
@@ -0,0 +1,82 @@
+#ifndef KEYFRAMED_REPLAY_H
+#define KEYFRAMED_REPLAY_H
+
+#include "ccfwd.h"
+#include "resimulation.h"
+
+#include <vector>
+
+/// Get the default number of ticks between two keyframes,
+/// which is 2 seconds at 120 ticks per second
+constexpr int get_default_keyframe_interval() noexcept { return 240; }
+
+/// Replays an \link{input_recording}, with seeking to any tick.
+///
+/// On construction, the match is played once,
+/// storing the full state every 'keyframe_interval' ticks.
+/// A seek starts from the nearest keyframe before the tick sought,
+/// or from the current tick if that is closer,
+/// so it needs at most 'keyframe_interval' ticks
+class keyframed_replay
+{
+public:
+  /// Play the whole recording once, to store the keyframes
+  explicit keyframed_replay(
+    const input_recording& r,
+    const int keyframe_interval = get_default_keyframe_interval()
+  );
+
+  const auto& get_game() const noexcept { return m_current.get_game(); }
+
+  /// Get the number of ticks between two keyframes
+  int get_keyframe_interval() const noexcept { return m_keyframe_interval; }
+
+  /// Get the number of keyframes stored
+  int get_n_keyframes() const noexcept { return static_cast<int>(m_keyframes.size()); }
+
+  const auto& get_recording() const noexcept { return m_current.get_recording(); }
+
+  /// Get the number of ticks simulated since construction, for profiling
+  int get_n_ticks_simulated() const noexcept { return m_n_ticks_simulated; }
+
+  /// Get the tick currently shown
+  int get_tick() const noexcept { return m_current.get_tick(); }
+
+  /// Go to a tick, which can be before the current one
+  void seek(const int tick);
+
+private:
+
+  /// The state at the current tick
+  resimulation m_current;
+
+  /// The number of ticks between two keyframes
+  int m_keyframe_interval;
+
+  /// The keyframes, the one at index i is at tick i * m_keyframe_interval
+  std::vector<resimulation> m_keyframes;
+
+  /// The number of ticks simulated since construction
+  int m_n_ticks_simulated;
+
+  /// Do one tick
+  void tick();
+};
+
+/// Get the number of ticks in the recording
+int get_n_ticks(const keyframed_replay& r) noexcept;
+
+/// Get the tick at a fraction of the recording,
+/// e.g. 0.5 for the middle
+int get_tick_at_fraction(const keyframed_replay& r, const double f) noexcept;
+
+/// Go one tick back, if possible
+void step_backward(keyframed_replay& r);
+
+/// Go one tick forward, if possible
+void step_forward(keyframed_replay& r);
+
+/// Test this class and its free functions
+void test_keyframed_replay();
+
+#endif // KEYFRAMED_REPLAY_H
@@ -10,6 +10,8 @@ lobby_options::lobby_options(
   const race rhs_race
 )
   : m_lhs_color{lhs_color},
+    m_is_lhs_computer{false},
+    m_is_rhs_computer{false},
     m_lhs_race{lhs_race},
     m_rhs_race{rhs_race}
 {
@@ -53,6 +55,16 @@ race get_race_of_color(const lobby_options& options, const chess_color c) noexce
   return options.get_race(side::rhs);
 }
 
+bool lobby_options::is_computer(const side player_side) const noexcept
+{
+  if (player_side == side::lhs)
+  {
+    return m_is_lhs_computer;
+  }
+  assert(player_side == side::rhs);
+  return m_is_rhs_computer;
+}
+
 void lobby_options::set_color(const chess_color color, const side player_side) noexcept
 {
   if (player_side == side::lhs)
@@ -79,6 +91,22 @@ void lobby_options::set_race(const race r, const side player_side) noexcept
   }
 }
 
+void lobby_options::set_is_computer(
+  const bool is_computer,
+  const side player_side
+) noexcept
+{
+  if (player_side == side::lhs)
+  {
+    m_is_lhs_computer = is_computer;
+  }
+  else
+  {
+    assert(player_side == side::rhs);
+    m_is_rhs_computer = is_computer;
+  }
+}
+
 void test_lobby_options()
 {
   #ifndef NDEBUG
@@ -106,6 +134,19 @@ void test_lobby_options()
     options.set_race(race::zerg, side::rhs);
     assert(options.get_race(side::rhs) == race::zerg);
   }
+  // is_computer and set_is_computer
+  {
+    lobby_options options{create_default_lobby_options()};
+    assert(!options.is_computer(side::lhs));
+    assert(!options.is_computer(side::rhs));
+    options.set_is_computer(true, side::rhs);
+    assert(!options.is_computer(side::lhs));
+    assert(options.is_computer(side::rhs));
+    options.set_is_computer(true, side::lhs);
+    options.set_is_computer(false, side::rhs);
+    assert(options.is_computer(side::lhs));
+    assert(!options.is_computer(side::rhs));
+  }
   // 76: set_color ensures the other player has the other color
   {
     lobby_options options{create_default_lobby_options()};
@@ -152,7 +193,9 @@ std::ostream& operator<<(std::ostream& os, const lobby_options& options) noexcep
     << "LHS color: " << options.get_color(side::lhs) << '\n'
     << "RHS color: " << options.get_color(side::rhs) << '\n'
     << "LHS race: " << options.get_race(side::lhs) << '\n'
-    << "RHS race: " << options.get_race(side::rhs)
+    << "RHS race: " << options.get_race(side::rhs) << '\n'
+    << "LHS is computer: " << options.is_computer(side::lhs) << '\n'
+    << "RHS is computer: " << options.is_computer(side::rhs)
   ;
   return os;
 }
@@ -23,18 +23,28 @@ public:
   /// Get the chess color of a player
   race get_race(const side player_side) const noexcept;
 
+  /// Is the player a \link{computer_player}?
+  bool is_computer(const side player_side) const noexcept;
+
   /// Get the chess color of a player
   void set_color(const chess_color color, const side player_side) noexcept;
 
   /// Get the chess color of a player
   void set_race(const race r, const side player_side) noexcept;
 
+  /// Set if the player is a \link{computer_player}
+  void set_is_computer(const bool is_computer, const side player_side) noexcept;
+
 private:
 
   /// The selected color for the LHS.
   /// RHS has the other color
   chess_color m_lhs_color;
 
+  /// Is the player a computer?
+  bool m_is_lhs_computer;
+  bool m_is_rhs_computer;
+
   /// The selected race
   race m_lhs_race;
   race m_rhs_race;
@@ -3,6 +3,7 @@
 #ifndef LOGIC_ONLY
 
 #include "about_view.h"
+#include "computer_player.h"
 #include "screen_coordinat.h"
 #include "game_view.h"
 #include "played_game_view.h"
@@ -56,6 +57,9 @@ void lobby_view::exec()
     )
   );
 
+  // Show the lobby once, as it is only shown again after an event
+  show();
+
   while (m_window.isOpen())
   {
     // Process user input and play game until instructed to exit
@@ -73,6 +77,7 @@ void lobby_view::exec()
         exec_game();
         m_lhs_start = false;
         m_rhs_start = false;
+        show();
       }
     }
 
@@ -86,7 +91,8 @@ void lobby_view::exec_game()
   m_window.setVisible(false);
   game_view view{
     game(m_game_options, m_lobby_options),
-    game_controller(m_physical_controllers)
+    game_controller(m_physical_controllers),
+    create_computer_players(m_lobby_options)
   };
   view.exec();
   m_window.setVisible(true);
@@ -119,7 +125,15 @@ bool lobby_view::process_events()
 {
   // User interaction
   sf::Event event;
-  while (m_window.pollEvent(event))
+  // Sleep until there is an event, so that an idle lobby uses no CPU,
+  // except during the countdown, which is shown every second
+  const bool has_event{
+    m_clock
+    ? wait_for_event(m_window, event, sf::milliseconds(100))
+    : m_window.waitEvent(event)
+  };
+  if (!has_event) return false;
+  do
   {
     if (event.type == sf::Event::Resized)
     {
@@ -165,6 +179,14 @@ bool lobby_view::process_events()
             m_lhs_start = false;
             m_rhs_start = false;
             break;
+          case lobby_view_item::player:
+            m_lobby_options.set_is_computer(
+              !m_lobby_options.is_computer(side::lhs),
+              side::lhs
+            );
+            m_lhs_start = false;
+            m_rhs_start = false;
+            break;
           default:
           case lobby_view_item::start:
             assert(m_lhs_cursor == lobby_view_item::start);
@@ -213,6 +235,14 @@ bool lobby_view::process_events()
             m_lhs_start = false;
             m_rhs_start = false;
             break;
+          case lobby_view_item::player:
+            m_lobby_options.set_is_computer(
+              !m_lobby_options.is_computer(side::rhs),
+              side::rhs
+            );
+            m_lhs_start = false;
+            m_rhs_start = false;
+            break;
           default:
           case lobby_view_item::start:
             assert(m_rhs_cursor == lobby_view_item::start);
@@ -227,7 +257,7 @@ bool lobby_view::process_events()
         return true;
       }
     }
-  }
+  } while (m_window.pollEvent(event));
   if (m_lhs_start && m_rhs_start && !m_clock.has_value())
   {
     m_clock = sf::Clock();
@@ -260,9 +290,11 @@ void lobby_view::show()
   show_image_panel(*this);
   show_color_panel(*this, side::lhs);
   show_race_panel(*this, side::lhs);
+  show_player_panel(*this, side::lhs);
   show_start_panel(*this, side::lhs);
   show_color_panel(*this, side::rhs);
   show_race_panel(*this, side::rhs);
+  show_player_panel(*this, side::rhs);
   show_start_panel(*this, side::rhs);
   show_selected_panel(*this, side::lhs);
   show_selected_panel(*this, side::rhs);
@@ -336,6 +368,31 @@ void show_countdown(lobby_view& v, const int n_left_secs)
 
 }
 
+void show_player_panel(lobby_view& v, const side player_side)
+{
+  const auto screen_rect{v.get_layout().get_player(player_side)};
+
+  // Text
+  sf::Text text;
+  if (v.get_options().is_computer(player_side))
+  {
+    text.setString("Computer");
+  }
+  else
+  {
+    text.setString("Human");
+  }
+  v.set_text_style(text);
+  set_text_position(text, screen_rect);
+  v.get_window().draw(text);
+
+  // Smaller
+  text.setCharacterSize(text.getCharacterSize() - 2);
+  set_text_position(text, screen_rect);
+  text.setFillColor(sf::Color::White);
+  v.get_window().draw(text);
+}
+
 void show_race_panel(lobby_view& v, const side player_side)
 {
   const auto screen_rect{v.get_layout().get_race(player_side)};
@@ -108,6 +108,9 @@ void show_layout_panels(lobby_view& v);
 /// Draw the cursor on the selected panel
 void show_selected_panel(lobby_view& v, const side player_side);
 void show_race_panel(lobby_view& v, const side player_side);
+
+/// Show if a player is a human or a computer
+void show_player_panel(lobby_view& v, const side player_side);
 void show_start_panel(lobby_view& v, const side player_side);
 
 #endif // LOGIC_ONLY
@@ -49,7 +49,8 @@ void test_lobby_view_item()
   // Get next
   {
     assert(get_next(lobby_view_item::color) == lobby_view_item::race);
-    assert(get_next(lobby_view_item::race) == lobby_view_item::start);
+    assert(get_next(lobby_view_item::race) == lobby_view_item::player);
+    assert(get_next(lobby_view_item::player) == lobby_view_item::start);
     assert(get_next(lobby_view_item::start) == lobby_view_item::color);
   }
   // Get previous
@@ -6,7 +6,7 @@
 /// The items in the lobby view
 enum class lobby_view_item
 {
-  color, race, start
+  color, race, player, start
 };
 
 std::vector<lobby_view_item> get_all_lobby_view_items() noexcept;
@@ -9,7 +9,7 @@ lobby_view_layout::lobby_view_layout(
 ) : m_font_size{64},
     m_window_size{window_size}
 {
-  const int n_vertical_units{5};
+  const int n_vertical_units{6};
   const int n_vertical_margins{n_vertical_units + 1}; // margins are above, below and between panels
   const int panel_height{
     static_cast<int>(
@@ -41,6 +41,8 @@ lobby_view_layout::lobby_view_layout(
   const int y6{y5 + panel_height};
   const int y7{y6 + margin_width};
   const int y8{y7 + panel_height};
+  const int y9{y8 + margin_width};
+  const int y10{y9 + panel_height};
 
   m_image = screen_rect(
     screen_coordinat(x1, y1),
@@ -55,10 +57,14 @@ lobby_view_layout::lobby_view_layout(
     screen_coordinat(x1, y5),
     screen_coordinat(x2, y6)
   );
-  m_lhs_start = screen_rect(
+  m_lhs_player = screen_rect(
     screen_coordinat(x1, y7),
     screen_coordinat(x2, y8)
   );
+  m_lhs_start = screen_rect(
+    screen_coordinat(x1, y9),
+    screen_coordinat(x2, y10)
+  );
   m_rhs_color = screen_rect(
     screen_coordinat(x3, y3),
     screen_coordinat(x4, y4)
@@ -67,10 +73,14 @@ lobby_view_layout::lobby_view_layout(
     screen_coordinat(x3, y5),
     screen_coordinat(x4, y6)
   );
-  m_rhs_start = screen_rect(
+  m_rhs_player = screen_rect(
     screen_coordinat(x3, y7),
     screen_coordinat(x4, y8)
   );
+  m_rhs_start = screen_rect(
+    screen_coordinat(x3, y9),
+    screen_coordinat(x4, y10)
+  );
   m_font_size = std::min(
     panel_height / 2,
     panel_width / 6
@@ -95,13 +105,25 @@ std::vector<screen_rect> get_panels(const lobby_view_layout& layout)
     layout.get_image(),
     layout.get_color(side::lhs),
     layout.get_race(side::lhs),
+    layout.get_player(side::lhs),
     layout.get_start(side::lhs),
     layout.get_color(side::rhs),
     layout.get_race(side::rhs),
+    layout.get_player(side::rhs),
     layout.get_start(side::rhs),
   };
 }
 
+const screen_rect& lobby_view_layout::get_player(const side player_side) const noexcept
+{
+  if (player_side == side::lhs)
+  {
+    return m_lhs_player;
+  }
+  assert(player_side == side::rhs);
+  return m_rhs_player;
+}
+
 const screen_rect& lobby_view_layout::get_race(const side player_side) const noexcept
 {
   if (player_side == side::lhs)
@@ -132,6 +154,7 @@ const screen_rect& get_cursor_rect(
   {
     case lobby_view_item::color: return layout.get_color(player_side);
     case lobby_view_item::race: return layout.get_race(player_side);
+    case lobby_view_item::player: return layout.get_player(player_side);
     default:
     case lobby_view_item::start:
       assert(item == lobby_view_item::start);
@@ -147,5 +170,17 @@ void test_lobby_view_layout()
     const lobby_view_layout layout;
     assert(!get_panels(layout).empty());
   }
+  // get_cursor_rect
+  {
+    const lobby_view_layout layout;
+    assert(
+      get_cursor_rect(layout, lobby_view_item::player, side::lhs)
+      == layout.get_player(side::lhs)
+    );
+    assert(
+      get_cursor_rect(layout, lobby_view_item::player, side::rhs)
+      == layout.get_player(side::rhs)
+    );
+  }
   #endif
 }
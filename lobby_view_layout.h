@@ -38,11 +38,17 @@
 /// | |          | |          | |
 /// | +----------+ +----------+ | y6
 /// |                           |
-/// | +----------+ +----------+ | y7 <-+
-/// | |          | |          | |      |
-/// | | ready    | | read     | |      +- panel_height
-/// | |          | |          | |      |
-/// | +----------+ +----------+ | y8 <-+
+/// | +----------+ +----------+ | y7
+/// | |          | |          | |
+/// | | player   | | player   | |
+/// | |          | |          | |
+/// | +----------+ +----------+ | y8
+/// |                           |
+/// | +----------+ +----------+ | y9  <-+
+/// | |          | |          | |       |
+/// | | ready    | | read     | |       +- panel_height
+/// | |          | |          | |       |
+/// | +----------+ +----------+ | y10 <-+
 /// |                           |
 /// +---------------------------+
 ///
@@ -62,6 +68,10 @@ public:
   const auto& get_image() const noexcept { return m_image; }
   const screen_rect& get_color(const side player_side) const noexcept;
   const screen_rect& get_race(const side player_side) const noexcept;
+
+  /// Get the panel that shows if the player is a human or a computer
+  const screen_rect& get_player(const side player_side) const noexcept;
+
   const screen_rect& get_start(const side player_side) const noexcept;
 
   /// Get the size of the font that would fit nicely
@@ -73,9 +83,11 @@ private:
 
   screen_rect m_image;
   screen_rect m_lhs_color;
+  screen_rect m_lhs_player;
   screen_rect m_lhs_race;
   screen_rect m_lhs_start;
   screen_rect m_rhs_color;
+  screen_rect m_rhs_player;
   screen_rect m_rhs_race;
   screen_rect m_rhs_start;
 
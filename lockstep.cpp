@@ -0,0 +1,331 @@
+#include "lockstep.h"
+
+#include "physical_controllers.h"
+#include "user_input_type.h"
+
+#include <algorithm>
+#include <cassert>
+#include <deque>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+
+lockstep::lockstep(
+  const game& g,
+  const game_controller& c,
+  const side local_player,
+  const int input_delay,
+  const delta_t& dt
+) : m_dt{dt},
+    m_game{g},
+    m_game_controller{c},
+    m_input_delay{input_delay},
+    m_local_player{local_player},
+    m_n_ticks{0},
+    m_next_local_tick{input_delay},
+    m_next_remote_tick{input_delay}
+{
+  assert(m_input_delay >= 1);
+  assert(delta_t(0.0) < m_dt);
+}
+
+lockstep_packet lockstep::add_local_user_inputs(const std::vector<user_input>& inputs)
+{
+  assert(needs_local_user_inputs());
+  assert(
+    std::all_of(
+      std::begin(inputs),
+      std::end(inputs),
+      [this](const user_input& input) { return input.get_player() == m_local_player; }
+    )
+  );
+  const std::uint64_t hash{get_hash(m_game)};
+  m_local_hashes[m_n_ticks] = hash;
+  m_local_user_inputs[m_next_local_tick] = inputs;
+  const lockstep_packet p(m_next_local_tick, m_local_player, inputs, m_n_ticks, hash);
+  ++m_next_local_tick;
+  compare_hashes();
+  return p;
+}
+
+void lockstep::add_remote_packet(const lockstep_packet& p)
+{
+  if (p.get_player() == m_local_player)
+  {
+    throw std::invalid_argument("Lockstep packet is from the local player");
+  }
+  if (p.get_tick() != m_next_remote_tick)
+  {
+    throw std::invalid_argument("Lockstep packet is not the next one");
+  }
+  m_remote_user_inputs[p.get_tick()] = p.get_user_inputs();
+  m_remote_hashes[p.get_hash_tick()] = p.get_hash();
+  ++m_next_remote_tick;
+  compare_hashes();
+}
+
+bool lockstep::can_tick() const noexcept
+{
+  // There are no user inputs before the first delay has passed
+  if (m_n_ticks < m_input_delay) return true;
+  return m_next_local_tick > m_n_ticks && m_next_remote_tick > m_n_ticks;
+}
+
+void lockstep::clear_piece_messages()
+{
+  ::clear_piece_messages(m_game);
+}
+
+void lockstep::compare_hashes()
+{
+  for (auto i{std::begin(m_remote_hashes)}; i != std::end(m_remote_hashes); )
+  {
+    const auto local{m_local_hashes.find(i->first)};
+    if (local == std::end(m_local_hashes))
+    {
+      ++i;
+      continue;
+    }
+    if (local->second != i->second && !m_desync_tick)
+    {
+      m_desync_tick = i->first;
+    }
+    m_local_hashes.erase(local);
+    i = m_remote_hashes.erase(i);
+  }
+}
+
+bool lockstep::has_pending_local_user_inputs() const noexcept
+{
+  return std::any_of(
+    std::begin(m_local_user_inputs),
+    std::end(m_local_user_inputs),
+    [](const auto& p) { return !p.second.empty(); }
+  );
+}
+
+bool lockstep::needs_local_user_inputs() const noexcept
+{
+  return m_next_local_tick <= m_n_ticks + m_input_delay;
+}
+
+user_inputs lockstep::tick()
+{
+  assert(can_tick());
+  if (m_n_ticks >= m_input_delay)
+  {
+    // Both players apply the user inputs in the same order
+    for (const auto player: get_all_sides())
+    {
+      auto& inputs{
+        player == m_local_player
+        ? m_local_user_inputs
+        : m_remote_user_inputs
+      };
+      const auto there{inputs.find(m_n_ticks)};
+      assert(there != std::end(inputs));
+      for (const auto& input: there->second)
+      {
+        add_user_input(m_game_controller, input);
+      }
+      inputs.erase(there);
+    }
+  }
+  const user_inputs inputs{m_game_controller.get_user_inputs()};
+  m_game_controller.apply_user_inputs_to_game(m_game);
+  m_game.tick(m_dt);
+  ++m_n_ticks;
+  return inputs;
+}
+
+void test_lockstep()
+{
+#ifndef NDEBUG
+  // lockstep::lockstep
+  {
+    const lockstep l(game(), game_controller(create_two_keyboard_controllers()), side::lhs);
+    assert(l.get_local_player() == side::lhs);
+    assert(l.get_input_delay() == get_default_input_delay());
+    assert(l.get_n_ticks() == 0);
+    assert(!l.get_desync_tick());
+    assert(l.can_tick());
+    assert(l.needs_local_user_inputs());
+    assert(!l.has_pending_local_user_inputs());
+  }
+  // lockstep::add_local_user_inputs schedules the user inputs after the delay
+  {
+    lockstep l(game(), game_controller(create_two_keyboard_controllers()), side::lhs, 2);
+    assert(l.get_next_local_tick() == 2);
+    const auto p{l.add_local_user_inputs({create_press_up_action(side::lhs)})};
+    assert(p.get_tick() == 2);
+    assert(l.get_next_local_tick() == 3);
+    assert(p.get_hash_tick() == 0);
+    assert(p.get_hash() == get_hash(l.get_game()));
+    assert(!l.needs_local_user_inputs());
+    assert(l.has_pending_local_user_inputs());
+  }
+  // lockstep::can_tick is false without the user inputs of the other player
+  {
+    lockstep l(game(), game_controller(create_two_keyboard_controllers()), side::lhs, 1);
+    l.add_local_user_inputs({});
+    assert(l.can_tick());
+    l.tick();
+    l.add_local_user_inputs({});
+    assert(!l.can_tick());
+    l.add_remote_packet(lockstep_packet(1, side::rhs, {}, 0, get_hash(game())));
+    assert(l.can_tick());
+    l.tick();
+    assert(l.get_n_ticks() == 2);
+  }
+  // lockstep::tick returns the user inputs of both players it applied
+  {
+    lockstep l(game(), game_controller(create_two_keyboard_controllers()), side::lhs, 1);
+    l.add_local_user_inputs({create_press_up_action(side::lhs)});
+    assert(is_empty(l.tick()));
+    l.add_local_user_inputs({});
+    l.add_remote_packet(
+      lockstep_packet(1, side::rhs, {create_press_down_action(side::rhs)}, 0, get_hash(game()))
+    );
+    const auto inputs{l.tick()};
+    assert(inputs.get_user_inputs().size() == 2);
+    assert(inputs.get_user_inputs()[0] == create_press_up_action(side::lhs));
+    assert(inputs.get_user_inputs()[1] == create_press_down_action(side::rhs));
+  }
+  // lockstep::clear_piece_messages does not change the hash
+  {
+    game g;
+    select(get_piece_at(g, square("e2")));
+    lockstep l(g, game_controller(create_two_keyboard_controllers()), side::lhs);
+    assert(!collect_messages(l.get_game()).empty());
+    const auto hash{get_hash(l.get_game())};
+    l.clear_piece_messages();
+    assert(collect_messages(l.get_game()).empty());
+    assert(get_hash(l.get_game()) == hash);
+  }
+  // lockstep::add_remote_packet throws on a packet out of order
+  {
+    lockstep l(game(), game_controller(create_two_keyboard_controllers()), side::lhs, 1);
+    bool has_thrown{false};
+    try
+    {
+      l.add_remote_packet(lockstep_packet(2, side::rhs, {}, 0, 0));
+    }
+    catch (const std::invalid_argument&)
+    {
+      has_thrown = true;
+    }
+    assert(has_thrown);
+  }
+  // lockstep::get_desync_tick detects a different hash
+  {
+    const game g;
+    const game_controller c(create_two_keyboard_controllers());
+    lockstep a(g, c, side::lhs);
+    lockstep b(g, c, side::rhs);
+    const auto p{a.add_local_user_inputs({})};
+    b.add_local_user_inputs({});
+    b.add_remote_packet(
+      lockstep_packet(p.get_tick(), p.get_player(), p.get_user_inputs(), p.get_hash_tick(), p.get_hash() + 1)
+    );
+    assert(b.get_desync_tick());
+    assert(*b.get_desync_tick() == 0);
+  }
+  // Two players with random user inputs and a slow connection stay in sync
+  {
+    const game g{get_kings_only_game()};
+    const game_controller c(create_two_keyboard_controllers());
+    lockstep a(g, c, side::lhs, 3);
+    lockstep b(g, c, side::rhs, 3);
+    const std::vector<user_input_type> types{
+      user_input_type::press_action_1,
+      user_input_type::press_down,
+      user_input_type::press_left,
+      user_input_type::press_right,
+      user_input_type::press_up
+    };
+    std::default_random_engine rng(42);
+    std::uniform_int_distribution<int> distribution(0, static_cast<int>(types.size()) - 1);
+    // The packets in flight, each arrives after a few iterations
+    std::deque<lockstep_packet> a_to_b;
+    std::deque<lockstep_packet> b_to_a;
+    for (int i{0}; i != 300; ++i)
+    {
+      for (lockstep* l: { &a, &b })
+      {
+        if (!l->needs_local_user_inputs()) continue;
+        std::vector<user_input> inputs;
+        if (i % 2 == 0)
+        {
+          inputs.push_back(user_input(types[distribution(rng)], l->get_local_player()));
+        }
+        (l == &a ? a_to_b : b_to_a).push_back(l->add_local_user_inputs(inputs));
+      }
+      if (i % 3 == 0 && !a_to_b.empty())
+      {
+        b.add_remote_packet(a_to_b.front());
+        a_to_b.pop_front();
+      }
+      if (i % 2 == 0 && !b_to_a.empty())
+      {
+        a.add_remote_packet(b_to_a.front());
+        b_to_a.pop_front();
+      }
+      if (a.can_tick()) a.tick();
+      if (b.can_tick()) b.tick();
+    }
+    assert(a.get_n_ticks() > 50);
+    assert(!a.get_desync_tick());
+    assert(!b.get_desync_tick());
+    // Tick the one that is behind
+    while (b.get_n_ticks() < a.get_n_ticks())
+    {
+      while (!a_to_b.empty())
+      {
+        b.add_remote_packet(a_to_b.front());
+        a_to_b.pop_front();
+      }
+      if (b.needs_local_user_inputs()) b_to_a.push_back(b.add_local_user_inputs({}));
+      b.tick();
+    }
+    while (a.get_n_ticks() < b.get_n_ticks())
+    {
+      while (!b_to_a.empty())
+      {
+        a.add_remote_packet(b_to_a.front());
+        b_to_a.pop_front();
+      }
+      if (a.needs_local_user_inputs()) a_to_b.push_back(a.add_local_user_inputs({}));
+      a.tick();
+    }
+    assert(a.get_n_ticks() == b.get_n_ticks());
+    assert(get_hash(a.get_game()) == get_hash(b.get_game()));
+    assert(a.get_game().get_pieces() == b.get_game().get_pieces());
+    assert(
+      a.get_game_controller().get_cursor_pos(side::lhs)
+      == b.get_game_controller().get_cursor_pos(side::lhs)
+    );
+  }
+  // operator<<
+  {
+    const lockstep l(game(), game_controller(create_two_keyboard_controllers()), side::rhs);
+    std::stringstream s;
+    s << l;
+    assert(!s.str().empty());
+  }
+#endif // NDEBUG
+}
+
+std::ostream& operator<<(std::ostream& os, const lockstep& l) noexcept
+{
+  os
+    << "Lockstep of " << l.get_local_player()
+    << " at tick " << l.get_n_ticks()
+    << ", input delay " << l.get_input_delay() << " ticks"
+  ;
+  if (l.get_desync_tick())
+  {
+    os << ", desynced at tick " << *l.get_desync_tick();
+  }
+  return os;
+}
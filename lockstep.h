@@ -0,0 +1,160 @@
+#ifndef LOCKSTEP_H
+#define LOCKSTEP_H
+
+#include "ccfwd.h"
+#include "delta_t.h"
+#include "fixed_timestep.h"
+#include "game.h"
+#include "game_controller.h"
+#include "lockstep_packet.h"
+#include "side.h"
+
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <optional>
+#include <vector>
+
+/// Get the default number of ticks between adding local user inputs
+/// and applying them, which is 50 milliseconds at 120 ticks per second.
+/// This is the time the packet has to reach the other player
+/// without the game having to wait
+constexpr int get_default_input_delay() noexcept { return 6; }
+
+/// One player's side of a deterministic lockstep game.
+///
+/// Each player runs its own \link{game} and \link{game_controller}
+/// and only the user inputs are exchanged, as \link{lockstep_packet}s.
+/// The user inputs a player adds now are applied
+/// 'input_delay' ticks later, by both players,
+/// so the game is ticked only when the user inputs of both players
+/// for that tick are known.
+/// The games are ticked in fixed steps and the user inputs are applied
+/// in the same order, so both games stay the same.
+///
+/// Each packet has the hash of the sender's game,
+/// so that a difference between the games is detected,
+/// see \link{lockstep::get_desync_tick}
+///
+/// \link{game_view} uses this class to let two humans play
+/// over a network, the headless 'conquer_chess_lockstep'
+/// (see lockstep_main.cpp) to let two computer players play
+class lockstep
+{
+public:
+  explicit lockstep(
+    const game& g,
+    const game_controller& c,
+    const side local_player,
+    const int input_delay = get_default_input_delay(),
+    const delta_t& dt = get_delta_t(fixed_timestep())
+  );
+
+  /// Add the user inputs of the local player, which are applied
+  /// 'input_delay' ticks after the current tick.
+  /// Must be called once per tick, also without user inputs,
+  /// see \link{lockstep::needs_local_user_inputs}
+  /// @return the packet to send to the other player
+  lockstep_packet add_local_user_inputs(const std::vector<user_input>& inputs);
+
+  /// Add a packet received from the other player.
+  /// Throws a std::invalid_argument if the packet is not the next one
+  void add_remote_packet(const lockstep_packet& p);
+
+  /// Can the game be ticked, i.e. are the user inputs
+  /// of both players known for the current tick?
+  bool can_tick() const noexcept;
+
+  /// Clear the messages of the pieces, after these have been read.
+  /// The messages are not part of the hash of the game,
+  /// so this does not make the games differ
+  void clear_piece_messages();
+
+  /// Get the first tick at which the games differed, if any
+  const auto& get_desync_tick() const noexcept { return m_desync_tick; }
+
+  /// Get the time one tick takes
+  const auto& get_dt() const noexcept { return m_dt; }
+
+  /// Get the game
+  const auto& get_game() const noexcept { return m_game; }
+
+  /// Get the game controller
+  const auto& get_game_controller() const noexcept { return m_game_controller; }
+
+  /// Get the number of ticks between adding and applying user inputs
+  int get_input_delay() const noexcept { return m_input_delay; }
+
+  /// Get the player at this side
+  auto get_local_player() const noexcept { return m_local_player; }
+
+  /// Get the number of ticks done
+  int get_n_ticks() const noexcept { return m_n_ticks; }
+
+  /// Get the tick the next local user inputs are applied at
+  int get_next_local_tick() const noexcept { return m_next_local_tick; }
+
+  /// Are there local user inputs added, that have not been applied yet?
+  bool has_pending_local_user_inputs() const noexcept;
+
+  /// Must the local user inputs be added before the game can be ticked?
+  bool needs_local_user_inputs() const noexcept;
+
+  /// Apply the user inputs of both players, then tick the game.
+  /// Can only be done if 'can_tick' is true
+  /// @return the user inputs applied, e.g. to be recorded
+  user_inputs tick();
+
+private:
+
+  /// The first tick at which the games differed, if any
+  std::optional<int> m_desync_tick;
+
+  /// The time one tick takes
+  delta_t m_dt;
+
+  /// The game
+  game m_game;
+
+  /// The game controller
+  game_controller m_game_controller;
+
+  /// The number of ticks between adding and applying user inputs
+  int m_input_delay;
+
+  /// The hashes of the local game, by tick,
+  /// until compared to those of the other player
+  std::map<int, std::uint64_t> m_local_hashes;
+
+  /// The player at this side
+  side m_local_player;
+
+  /// The local user inputs, by the tick they are applied at
+  std::map<int, std::vector<user_input>> m_local_user_inputs;
+
+  /// The number of ticks done
+  int m_n_ticks;
+
+  /// The tick the next local user inputs are applied at
+  int m_next_local_tick;
+
+  /// The tick the next remote user inputs are applied at
+  int m_next_remote_tick;
+
+  /// The hashes of the remote game, by tick,
+  /// until compared to those of the local game
+  std::map<int, std::uint64_t> m_remote_hashes;
+
+  /// The remote user inputs, by the tick they are applied at
+  std::map<int, std::vector<user_input>> m_remote_user_inputs;
+
+  /// Compare the hashes of the ticks that both players sent
+  void compare_hashes();
+};
+
+/// Test this class and its free functions
+void test_lockstep();
+
+std::ostream& operator<<(std::ostream& os, const lockstep& l) noexcept;
+
+#endif // LOCKSTEP_H
@@ -0,0 +1,42 @@
+# Project file to play a lockstep game between two processes,
+# to test that both games stay the same when only user inputs are exchanged.
+#
+# Usage:
+#
+#   ./conquer_chess_lockstep host [port] [n_ticks]
+#   ./conquer_chess_lockstep join [address] [port] [n_ticks]
+
+DEFINES += LOGIC_ONLY
+
+# All files are in here, the rest are just settings
+include(game.pri)
+
+SOURCES += lockstep_main.cpp
+
+TARGET = conquer_chess_lockstep
+
+CONFIG += console thread
+CONFIG -= app_bundle
+
+# Use the C++ version that all team members can use
+CONFIG += c++17
+QMAKE_CXXFLAGS += -std=c++17
+
+# High warning levels
+QMAKE_CXXFLAGS += -Wall -Wextra -Wshadow -Wnon-virtual-dtor -pedantic
+
+# Debug and release settings
+CONFIG += debug_and_release
+CONFIG(release, debug|release) {
+  DEFINES += NDEBUG
+  QMAKE_CXXFLAGS += -O3
+}
+CONFIG(debug, debug|release) {
+  # A warning is an error
+  QMAKE_CXXFLAGS += -Werror
+}
+
+# Qt5, for the resources
+QT += core
+
+LIBS += -lsfml-graphics -lsfml-window -lsfml-system -lsfml-audio -lsfml-network
@@ -0,0 +1,199 @@
+#include "lockstep_connection.h"
+
+#include "game.h"
+#include "game_controller.h"
+#include "lockstep.h"
+#include "physical_controllers.h"
+
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+lockstep_connection::lockstep_connection(const unsigned short port)
+  : m_n_bytes_received{0},
+    m_n_bytes_sent{0}
+{
+  sf::TcpListener listener;
+  if (listener.listen(port) != sf::Socket::Done)
+  {
+    throw std::runtime_error("Cannot listen at port " + std::to_string(port));
+  }
+  if (listener.accept(m_socket) != sf::Socket::Done)
+  {
+    throw std::runtime_error("Cannot accept the other player");
+  }
+  m_socket.setBlocking(false);
+}
+
+lockstep_connection::lockstep_connection(
+  const std::string& address,
+  const unsigned short port
+) : m_n_bytes_received{0},
+    m_n_bytes_sent{0}
+{
+  if (m_socket.connect(sf::IpAddress(address), port, sf::seconds(10.0f)) != sf::Socket::Done)
+  {
+    throw std::runtime_error(
+      "Cannot connect to " + address + " at port " + std::to_string(port)
+    );
+  }
+  m_socket.setBlocking(false);
+}
+
+std::optional<lockstep_packet> lockstep_connection::receive()
+{
+  sf::Packet packet;
+  const sf::Socket::Status status{m_socket.receive(packet)};
+  if (status == sf::Socket::NotReady || status == sf::Socket::Partial)
+  {
+    return {};
+  }
+  if (status != sf::Socket::Done)
+  {
+    throw std::runtime_error("Lost the connection to the other player");
+  }
+  const auto data{static_cast<const std::uint8_t*>(packet.getData())};
+  const std::vector<std::uint8_t> bytes(data, data + packet.getDataSize());
+  m_n_bytes_received += sizeof(std::uint32_t) + bytes.size();
+  return to_lockstep_packet(bytes);
+}
+
+void lockstep_connection::send(const lockstep_packet& p)
+{
+  const auto bytes{to_bytes(p)};
+  sf::Packet packet;
+  packet.append(bytes.data(), bytes.size());
+  sf::Socket::Status status{m_socket.send(packet)};
+  // A non-blocking socket may send a packet in parts
+  while (status == sf::Socket::Partial || status == sf::Socket::NotReady)
+  {
+    status = m_socket.send(packet);
+  }
+  if (status != sf::Socket::Done)
+  {
+    throw std::runtime_error("Lost the connection to the other player");
+  }
+  m_n_bytes_sent += sizeof(std::uint32_t) + bytes.size();
+}
+
+std::pair<std::unique_ptr<lockstep_connection>, std::unique_ptr<lockstep_connection>>
+  create_loopback_connections(const unsigned short port)
+{
+  std::unique_ptr<lockstep_connection> host;
+  std::thread hosting(
+    [&host, port]()
+    {
+      try
+      {
+        host = std::make_unique<lockstep_connection>(port);
+      }
+      catch (const std::runtime_error&)
+      {
+        // The guest cannot connect then
+      }
+    }
+  );
+  std::unique_ptr<lockstep_connection> guest;
+  // The host may not be listening yet
+  for (int i{0}; !guest; ++i)
+  {
+    try
+    {
+      guest = std::make_unique<lockstep_connection>("127.0.0.1", port);
+    }
+    catch (const std::runtime_error&)
+    {
+      if (i == 100) break;
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+  }
+  hosting.join();
+  if (!host || !guest)
+  {
+    throw std::runtime_error(
+      "Cannot connect over the loopback at port " + std::to_string(port)
+    );
+  }
+  return { std::move(host), std::move(guest) };
+}
+
+lockstep_packet wait_for_packet(lockstep_connection& c)
+{
+  const auto start{std::chrono::steady_clock::now()};
+  while (true)
+  {
+    if (const auto p{c.receive()}) return *p;
+    if (std::chrono::steady_clock::now() - start > std::chrono::seconds(10))
+    {
+      throw std::runtime_error("No packet received within 10 seconds");
+    }
+    std::this_thread::yield();
+  }
+}
+
+void test_lockstep_connection()
+{
+#ifndef NDEBUG
+  // Joining a host that is not there throws
+  {
+    bool has_thrown{false};
+    try
+    {
+      // Port 1 is reserved for TCPMUX, which is not used anymore
+      const lockstep_connection c("127.0.0.1", 1);
+    }
+    catch (const std::runtime_error&)
+    {
+      has_thrown = true;
+    }
+    assert(has_thrown);
+  }
+  // Host and guest exchange packets over the loopback
+  {
+    auto [host, guest]{create_loopback_connections(get_default_lockstep_port())};
+    const lockstep_packet a(1, side::lhs, {create_press_up_action(side::lhs)}, 0, 123);
+    const lockstep_packet b(1, side::rhs, {}, 0, 123);
+    host->send(a);
+    guest->send(b);
+    assert(wait_for_packet(*guest) == a);
+    assert(wait_for_packet(*host) == b);
+    assert(!host->receive());
+    assert(host->get_n_bytes_sent() == guest->get_n_bytes_received());
+    assert(guest->get_n_bytes_sent() == host->get_n_bytes_received());
+  }
+  // Two lockstep players stay in sync over the loopback
+  {
+    // Another port, as the previous one may not be free yet
+    auto [host, guest]{create_loopback_connections(get_default_lockstep_port() + 1)};
+    const game g{get_kings_only_game()};
+    const game_controller c(create_two_keyboard_controllers());
+    lockstep a(g, c, side::lhs, 2);
+    lockstep b(g, c, side::rhs, 2);
+    for (int i{0}; i != 20; ++i)
+    {
+      host->send(a.add_local_user_inputs({create_press_right_action(side::lhs)}));
+      guest->send(b.add_local_user_inputs({create_press_left_action(side::rhs)}));
+      if (!a.can_tick()) a.add_remote_packet(wait_for_packet(*host));
+      if (!b.can_tick()) b.add_remote_packet(wait_for_packet(*guest));
+      a.tick();
+      b.tick();
+    }
+    assert(a.get_n_ticks() == 20);
+    assert(!a.get_desync_tick());
+    assert(!b.get_desync_tick());
+    assert(get_hash(a.get_game()) == get_hash(b.get_game()));
+    assert(
+      a.get_game_controller().get_cursor_pos(side::lhs)
+      == b.get_game_controller().get_cursor_pos(side::lhs)
+    );
+    assert(
+      a.get_game_controller().get_cursor_pos(side::lhs)
+      != c.get_cursor_pos(side::lhs)
+    );
+  }
+#endif // NDEBUG
+}
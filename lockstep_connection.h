@@ -0,0 +1,84 @@
+#ifndef LOCKSTEP_CONNECTION_H
+#define LOCKSTEP_CONNECTION_H
+
+#include "ccfwd.h"
+#include "lockstep_packet.h"
+
+#include <SFML/Network.hpp>
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+
+/// Get the default port to play a \link{lockstep} game over
+constexpr unsigned short get_default_lockstep_port() noexcept { return 48620; }
+
+/// The TCP connection between the two players of a \link{lockstep} game,
+/// over which the \link{lockstep_packet}s are sent.
+///
+/// SFML disables Nagle's algorithm on TCP sockets,
+/// so that each small packet is sent right away.
+/// Receiving does not block, so that the game can keep drawing
+/// while waiting for the other player
+class lockstep_connection
+{
+public:
+  /// Host a game: wait for the other player to connect at the port.
+  /// Throws a std::runtime_error if that fails
+  explicit lockstep_connection(const unsigned short port);
+
+  /// Join a game: connect to the host at the address and port.
+  /// Throws a std::runtime_error if that fails
+  explicit lockstep_connection(
+    const std::string& address,
+    const unsigned short port
+  );
+
+  lockstep_connection(const lockstep_connection&) = delete;
+  lockstep_connection& operator=(const lockstep_connection&) = delete;
+
+  /// Get the number of bytes received,
+  /// including the four bytes SFML puts before each packet
+  long long get_n_bytes_received() const noexcept { return m_n_bytes_received; }
+
+  /// Get the number of bytes sent,
+  /// including the four bytes SFML puts before each packet
+  long long get_n_bytes_sent() const noexcept { return m_n_bytes_sent; }
+
+  /// Receive the next packet, if one has arrived.
+  /// Throws a std::runtime_error if the connection is lost
+  std::optional<lockstep_packet> receive();
+
+  /// Send a packet.
+  /// Throws a std::runtime_error if the connection is lost
+  void send(const lockstep_packet& p);
+
+private:
+
+  /// The number of bytes received
+  long long m_n_bytes_received;
+
+  /// The number of bytes sent
+  long long m_n_bytes_sent;
+
+  /// The socket connected to the other player
+  sf::TcpSocket m_socket;
+};
+
+/// Connect a host and a guest over the loopback, within one process,
+/// e.g. to test a \link{lockstep} game.
+/// Throws a std::runtime_error if that fails
+/// @return the host and the guest
+std::pair<std::unique_ptr<lockstep_connection>, std::unique_ptr<lockstep_connection>>
+  create_loopback_connections(const unsigned short port);
+
+/// Test this class and its free functions
+void test_lockstep_connection();
+
+/// Wait until a packet has arrived.
+/// Throws a std::runtime_error if none arrives within 10 seconds,
+/// or if the connection is lost
+lockstep_packet wait_for_packet(lockstep_connection& c);
+
+#endif // LOCKSTEP_CONNECTION_H
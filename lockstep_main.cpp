@@ -0,0 +1,124 @@
+/// Play a lockstep game between two processes,
+/// each with a computer player, to test that both games stay the same
+/// while only the user inputs are exchanged.
+///
+/// Usage:
+///
+///   conquer_chess_lockstep host [port] [n_ticks]
+///   conquer_chess_lockstep join [address] [port] [n_ticks]
+///
+/// The host plays the left-hand side, the one that joins the right-hand side.
+/// Both processes must use the same number of ticks.
+/// By default, 'address' is '127.0.0.1', i.e. the loopback,
+/// and 'n_ticks' is 1200, i.e. 10 seconds at 120 ticks per second
+
+#include "computer_player.h"
+#include "game.h"
+#include "game_controller.h"
+#include "lockstep.h"
+#include "lockstep_connection.h"
+#include "physical_controllers.h"
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+int main(int argc, char **argv)
+{
+  const std::vector<std::string> args(argv, argv + argc);
+  if (args.size() < 2 || (args[1] != "host" && args[1] != "join"))
+  {
+    std::cerr
+      << "Usage:\n"
+      << "  " << args[0] << " host [port] [n_ticks]\n"
+      << "  " << args[0] << " join [address] [port] [n_ticks]\n"
+    ;
+    return 1;
+  }
+  const bool is_host{args[1] == "host"};
+  const std::size_t first_arg{is_host ? 2u : 3u};
+  const std::string address{!is_host && args.size() > 2 ? args[2] : "127.0.0.1"};
+  const unsigned short port{
+    args.size() > first_arg
+    ? static_cast<unsigned short>(std::stoi(args[first_arg]))
+    : get_default_lockstep_port()
+  };
+  const int n_ticks{args.size() > first_arg + 1 ? std::stoi(args[first_arg + 1]) : 1200};
+
+  const auto connection{
+    is_host
+    ? std::make_unique<lockstep_connection>(port)
+    : std::make_unique<lockstep_connection>(address, port)
+  };
+
+  const side player{is_host ? side::lhs : side::rhs};
+  lockstep l(
+    game(),
+    game_controller(create_two_keyboard_controllers()),
+    player
+  );
+  computer_player p(
+    get_player_color(l.get_game(), player),
+    std::chrono::microseconds(1000)
+  );
+
+  const auto start{std::chrono::steady_clock::now()};
+  long long n_waits{0};
+  while (l.get_n_ticks() != n_ticks)
+  {
+    // The other player stops at the same tick,
+    // so it needs no user inputs applied at or beyond it
+    if (l.needs_local_user_inputs() && l.get_next_local_tick() < n_ticks)
+    {
+      // The computer player only acts on the game as it will be
+      // when its user inputs are applied,
+      // hence when there are no user inputs on their way
+      std::vector<user_input> inputs;
+      if (!l.has_pending_local_user_inputs())
+      {
+        game_controller c{l.get_game_controller()};
+        p.do_move(c, l.get_game());
+        inputs = c.get_user_inputs().get_user_inputs();
+      }
+      connection->send(l.add_local_user_inputs(inputs));
+    }
+    if (l.can_tick())
+    {
+      l.tick();
+      continue;
+    }
+    // Only read when waiting, as the other player may already have
+    // done its last tick and closed the connection
+    if (const auto packet{connection->receive()})
+    {
+      l.add_remote_packet(*packet);
+    }
+    else
+    {
+      ++n_waits;
+      std::this_thread::yield();
+    }
+  }
+  const std::chrono::duration<double> duration{
+    std::chrono::steady_clock::now() - start
+  };
+  const double n_secs{duration.count()};
+
+  std::cout
+    << "Player: " << player << '\n'
+    << "Number of ticks: " << l.get_n_ticks() << '\n'
+    << "Hash: " << get_hash(l.get_game()) << '\n'
+    << "Desync: "
+    << (l.get_desync_tick() ? "at tick " + std::to_string(*l.get_desync_tick()) : "none") << '\n'
+    << "Bytes sent: " << connection->get_n_bytes_sent() << '\n'
+    << "Bytes received: " << connection->get_n_bytes_received() << '\n'
+    << "Waits for the other player: " << n_waits << '\n'
+    << "Duration (secs): " << n_secs << '\n'
+    << "Ticks per second: " << (l.get_n_ticks() / n_secs) << '\n'
+  ;
+  return l.get_desync_tick() ? 1 : 0;
+}
@@ -0,0 +1,236 @@
+#include "lockstep_packet.h"
+
+#include "game_coordinat.h"
+#include "user_input_type.h"
+
+#include <cassert>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+lockstep_packet::lockstep_packet(
+  const int tick,
+  const side player,
+  const std::vector<user_input>& user_inputs,
+  const int hash_tick,
+  const std::uint64_t hash
+) : m_hash{hash},
+    m_hash_tick{hash_tick},
+    m_player{player},
+    m_tick{tick},
+    m_user_inputs{user_inputs}
+{
+  assert(m_tick >= 0);
+  assert(m_hash_tick >= 0);
+  assert(m_hash_tick <= m_tick);
+}
+
+lockstep_packet get_test_lockstep_packet()
+{
+  return lockstep_packet(
+    12,
+    side::rhs,
+    {
+      create_press_up_action(side::rhs),
+      create_mouse_move_action(game_coordinat(1.5, 2.25), side::rhs)
+    },
+    6,
+    0x0123456789abcdefull
+  );
+}
+
+void test_lockstep_packet()
+{
+#ifndef NDEBUG
+  // lockstep_packet::lockstep_packet
+  {
+    const auto p{get_test_lockstep_packet()};
+    assert(p.get_tick() == 12);
+    assert(p.get_player() == side::rhs);
+    assert(p.get_user_inputs().size() == 2);
+    assert(p.get_hash_tick() == 6);
+    assert(p.get_hash() == 0x0123456789abcdefull);
+  }
+  // to_bytes, without user inputs
+  {
+    const lockstep_packet p(1, side::lhs, {}, 0, 42);
+    assert(to_bytes(p).size() == 19);
+  }
+  // to_bytes, with a key press and a mouse move
+  {
+    assert(to_bytes(get_test_lockstep_packet()).size() == 19 + 2 + 18);
+  }
+  // to_lockstep_packet and to_bytes are symmetric
+  {
+    const auto p{get_test_lockstep_packet()};
+    assert(to_lockstep_packet(to_bytes(p)) == p);
+  }
+  // to_lockstep_packet throws on too few bytes
+  {
+    auto bytes{to_bytes(get_test_lockstep_packet())};
+    bytes.pop_back();
+    bool has_thrown{false};
+    try
+    {
+      to_lockstep_packet(bytes);
+    }
+    catch (const std::invalid_argument&)
+    {
+      has_thrown = true;
+    }
+    assert(has_thrown);
+  }
+  // to_lockstep_packet throws on too many bytes
+  {
+    auto bytes{to_bytes(get_test_lockstep_packet())};
+    bytes.push_back(0);
+    bool has_thrown{false};
+    try
+    {
+      to_lockstep_packet(bytes);
+    }
+    catch (const std::invalid_argument&)
+    {
+      has_thrown = true;
+    }
+    assert(has_thrown);
+  }
+  // operator<<
+  {
+    std::stringstream s;
+    s << get_test_lockstep_packet();
+    assert(!s.str().empty());
+  }
+#endif // NDEBUG
+}
+
+lockstep_packet to_lockstep_packet(const std::vector<std::uint8_t>& bytes)
+{
+  std::size_t pos{0};
+  const auto read{
+    [&bytes, &pos](const int n_bytes) -> std::uint64_t
+    {
+      if (pos + n_bytes > bytes.size())
+      {
+        throw std::invalid_argument("Too few bytes for a lockstep packet");
+      }
+      std::uint64_t value{0};
+      for (int i{0}; i != n_bytes; ++i)
+      {
+        value |= static_cast<std::uint64_t>(bytes[pos++]) << (8 * i);
+      }
+      return value;
+    }
+  };
+  const int tick{static_cast<int>(read(4))};
+  const int hash_tick{static_cast<int>(read(4))};
+  const std::uint64_t hash{read(8)};
+  const auto player_index{read(1)};
+  if (player_index > 1)
+  {
+    throw std::invalid_argument("Invalid player in lockstep packet");
+  }
+  const side player{player_index == 0 ? side::lhs : side::rhs};
+  const int n_user_inputs{static_cast<int>(read(2))};
+  const auto user_input_types{get_all_user_input_types()};
+  std::vector<user_input> user_inputs;
+  user_inputs.reserve(n_user_inputs);
+  for (int i{0}; i != n_user_inputs; ++i)
+  {
+    const auto type_index{read(1)};
+    if (type_index >= user_input_types.size())
+    {
+      throw std::invalid_argument("Invalid user input type in lockstep packet");
+    }
+    const user_input_type type{user_input_types[type_index]};
+    const bool has_coordinat{read(1) != 0};
+    if (has_coordinat != does_input_type_need_coordinat(type))
+    {
+      throw std::invalid_argument("Invalid coordinat in lockstep packet");
+    }
+    std::optional<game_coordinat> coordinat;
+    if (has_coordinat)
+    {
+      const std::uint64_t x_bits{read(8)};
+      const std::uint64_t y_bits{read(8)};
+      double x{0.0};
+      double y{0.0};
+      std::memcpy(&x, &x_bits, sizeof(x));
+      std::memcpy(&y, &y_bits, sizeof(y));
+      coordinat = game_coordinat(x, y);
+    }
+    user_inputs.push_back(
+      user_input(type, player, coordinat)
+    );
+  }
+  if (pos != bytes.size())
+  {
+    throw std::invalid_argument("Too many bytes for a lockstep packet");
+  }
+  if (tick < 0 || hash_tick < 0 || hash_tick > tick)
+  {
+    throw std::invalid_argument("Invalid ticks in lockstep packet");
+  }
+  return lockstep_packet(tick, player, user_inputs, hash_tick, hash);
+}
+
+std::vector<std::uint8_t> to_bytes(const lockstep_packet& p)
+{
+  std::vector<std::uint8_t> bytes;
+  bytes.reserve(19 + (18 * p.get_user_inputs().size()));
+  const auto write{
+    [&bytes](const std::uint64_t value, const int n_bytes)
+    {
+      for (int i{0}; i != n_bytes; ++i)
+      {
+        bytes.push_back(static_cast<std::uint8_t>(value >> (8 * i)));
+      }
+    }
+  };
+  write(p.get_tick(), 4);
+  write(p.get_hash_tick(), 4);
+  write(p.get_hash(), 8);
+  write(p.get_player() == side::lhs ? 0 : 1, 1);
+  assert(p.get_user_inputs().size() < 65536);
+  write(p.get_user_inputs().size(), 2);
+  for (const auto& input: p.get_user_inputs())
+  {
+    assert(input.get_player() == p.get_player());
+    write(static_cast<std::uint64_t>(input.get_user_input_type()), 1);
+    const auto& coordinat{input.get_coordinat()};
+    write(coordinat.has_value() ? 1 : 0, 1);
+    if (coordinat)
+    {
+      const double x{coordinat->get_x()};
+      const double y{coordinat->get_y()};
+      std::uint64_t x_bits{0};
+      std::uint64_t y_bits{0};
+      std::memcpy(&x_bits, &x, sizeof(x));
+      std::memcpy(&y_bits, &y, sizeof(y));
+      write(x_bits, 8);
+      write(y_bits, 8);
+    }
+  }
+  return bytes;
+}
+
+bool operator==(const lockstep_packet& lhs, const lockstep_packet& rhs) noexcept
+{
+  return lhs.get_tick() == rhs.get_tick()
+    && lhs.get_player() == rhs.get_player()
+    && lhs.get_user_inputs() == rhs.get_user_inputs()
+    && lhs.get_hash_tick() == rhs.get_hash_tick()
+    && lhs.get_hash() == rhs.get_hash()
+  ;
+}
+
+std::ostream& operator<<(std::ostream& os, const lockstep_packet& p) noexcept
+{
+  os
+    << "tick " << p.get_tick() << " of " << p.get_player()
+    << ", with " << p.get_user_inputs().size() << " user inputs"
+    << ", hash at tick " << p.get_hash_tick() << ": " << p.get_hash()
+  ;
+  return os;
+}
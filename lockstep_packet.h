@@ -0,0 +1,96 @@
+#ifndef LOCKSTEP_PACKET_H
+#define LOCKSTEP_PACKET_H
+
+#include "ccfwd.h"
+#include "side.h"
+#include "user_input.h"
+
+#include <cstdint>
+#include <iosfwd>
+#include <vector>
+
+/// What one player sends to the other, once per tick,
+/// when playing in \link{lockstep}:
+/// the user inputs of that player to apply at a tick,
+/// and the hash of the game at the tick the packet is made,
+/// so that the other player can detect that the games differ.
+///
+/// A packet without user inputs is still sent,
+/// as it tells the other player that the tick can be done
+class lockstep_packet
+{
+public:
+  explicit lockstep_packet(
+    const int tick,
+    const side player,
+    const std::vector<user_input>& user_inputs,
+    const int hash_tick,
+    const std::uint64_t hash
+  );
+
+  /// Get the hash of the sender's game, see \link{get_hash}
+  auto get_hash() const noexcept { return m_hash; }
+
+  /// Get the tick at which the sender's game had the hash
+  int get_hash_tick() const noexcept { return m_hash_tick; }
+
+  /// Get the player that sent the packet
+  auto get_player() const noexcept { return m_player; }
+
+  /// Get the tick at which the user inputs must be applied
+  int get_tick() const noexcept { return m_tick; }
+
+  /// Get the user inputs of the sender
+  const auto& get_user_inputs() const noexcept { return m_user_inputs; }
+
+private:
+
+  /// The hash of the sender's game
+  std::uint64_t m_hash;
+
+  /// The tick at which the sender's game had the hash
+  int m_hash_tick;
+
+  /// The player that sent the packet
+  side m_player;
+
+  /// The tick at which the user inputs must be applied
+  int m_tick;
+
+  /// The user inputs of the sender
+  std::vector<user_input> m_user_inputs;
+};
+
+/// Get a packet to be used in testing
+lockstep_packet get_test_lockstep_packet();
+
+/// Test this class and its free functions
+void test_lockstep_packet();
+
+/// Convert the bytes sent over the wire back to a packet.
+/// Throws a std::invalid_argument if the bytes are not a packet
+lockstep_packet to_lockstep_packet(const std::vector<std::uint8_t>& bytes);
+
+/// Convert a packet to the bytes sent over the wire.
+///
+/// All values are little-endian. A packet without user inputs
+/// takes 19 bytes, each keyboard input takes 2 bytes more,
+/// each mouse move takes 18 bytes more:
+///
+/// Bytes | Value
+/// ------|-----------------------------------------
+/// 4     | tick
+/// 4     | hash tick
+/// 8     | hash
+/// 1     | player
+/// 2     | number of user inputs
+/// 1     | per user input: the user input type
+/// 1     | per user input: 1 if it has a coordinat
+/// 16    | per user input with a coordinat: x and y
+std::vector<std::uint8_t> to_bytes(const lockstep_packet& p);
+
+bool operator==(const lockstep_packet& lhs, const lockstep_packet& rhs) noexcept;
+
+std::ostream& operator<<(std::ostream& os, const lockstep_packet& p) noexcept;
+
+#endif // LOCKSTEP_PACKET_H
@@ -0,0 +1,58 @@
+#include "log_level.h"
+
+#include <cassert>
+#include <iostream>
+#include <sstream>
+
+#include "../magic_enum/include/magic_enum/magic_enum.hpp" // https://github.com/Neargye/magic_enum
+
+std::vector<log_level> get_all_log_levels() noexcept
+{
+  const auto a{magic_enum::enum_values<log_level>()};
+  std::vector<log_level> v;
+  v.reserve(a.size());
+  std::copy(std::begin(a), std::end(a), std::back_inserter(v));
+  assert(a.size() == v.size());
+  return v;
+}
+
+void test_log_level()
+{
+#ifndef NDEBUG
+  // get_all_log_levels
+  {
+    assert(get_all_log_levels().size() == 3);
+  }
+  // is_logged
+  {
+    static_assert(is_logged(log_level::error) || !is_logged(log_level::info));
+    static_assert(is_logged(log_level::info) || !is_logged(log_level::debug));
+    #ifndef LOG_LEVEL
+    static_assert(!is_logged(log_level::error));
+    #endif // LOG_LEVEL
+  }
+  // to_str
+  {
+    assert(to_str(log_level::error) == "error");
+    assert(to_str(log_level::info) == "info");
+    assert(to_str(log_level::debug) == "debug");
+  }
+  // operator<<
+  {
+    std::stringstream s;
+    s << log_level::debug;
+    assert(!s.str().empty());
+  }
+#endif // NDEBUG
+}
+
+std::string to_str(const log_level level) noexcept
+{
+  return std::string(magic_enum::enum_name(level));
+}
+
+std::ostream& operator<<(std::ostream& os, const log_level level) noexcept
+{
+  os << to_str(level);
+  return os;
+}
@@ -0,0 +1,51 @@
+#ifndef LOG_LEVEL_H
+#define LOG_LEVEL_H
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+/// The level of detail of a debug log message,
+/// from least to most detailed.
+///
+/// The log level is set at compile time, e.g. by
+/// 'DEFINES += LOG_LEVEL=3' in a .pro file.
+/// Messages that are more detailed than the log level
+/// are removed by the compiler.
+/// By default, nothing is logged
+/// @see use \link{log_message} to log a message
+enum class log_level
+{
+  error = 1,
+  info = 2,
+  debug = 3
+};
+
+/// Get all the log levels
+std::vector<log_level> get_all_log_levels() noexcept;
+
+/// Get the log level set at compile time,
+/// as an integer, where zero denotes that nothing is logged
+constexpr int get_compile_time_log_level() noexcept
+{
+  #ifdef LOG_LEVEL
+  return LOG_LEVEL;
+  #else
+  return 0;
+  #endif
+}
+
+/// Are messages of this log level logged?
+constexpr bool is_logged(const log_level level) noexcept
+{
+  return static_cast<int>(level) <= get_compile_time_log_level();
+}
+
+/// Test this class and its free functions
+void test_log_level();
+
+std::string to_str(const log_level level) noexcept;
+
+std::ostream& operator<<(std::ostream& os, const log_level level) noexcept;
+
+#endif // LOG_LEVEL_H
@@ -0,0 +1,206 @@
+#include "log_ring_buffer.h"
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <sstream>
+
+log_ring_buffer::log_ring_buffer()
+  : m_n_added{0}
+{
+  m_lengths.fill(0);
+  m_levels.fill(log_level::debug);
+}
+
+void log_ring_buffer::add(
+  const log_level level,
+  const std::string_view message
+) noexcept
+{
+  const int i{m_n_added % capacity};
+  const int length{
+    std::min(static_cast<int>(message.size()), max_message_length)
+  };
+  std::copy(
+    std::begin(message),
+    std::begin(message) + length,
+    std::begin(m_messages[i])
+  );
+  m_lengths[i] = length;
+  m_levels[i] = level;
+  ++m_n_added;
+  // Prevent an overflow, without changing the order of the messages
+  if (m_n_added == 2 * capacity) m_n_added = capacity;
+}
+
+void log_ring_buffer::clear() noexcept
+{
+  m_n_added = 0;
+}
+
+log_level log_ring_buffer::get_level(const int i) const noexcept
+{
+  return m_levels[to_array_index(i)];
+}
+
+std::string_view log_ring_buffer::get_message(const int i) const noexcept
+{
+  const int j{to_array_index(i)};
+  return std::string_view(m_messages[j].data(), m_lengths[j]);
+}
+
+int log_ring_buffer::get_n_messages() const noexcept
+{
+  return std::min(m_n_added, capacity);
+}
+
+log_message_buffer::log_message_buffer()
+{
+  setp(m_text.data(), m_text.data() + m_text.size());
+}
+
+std::string_view log_message_buffer::get_message() const noexcept
+{
+  return std::string_view(pbase(), pptr() - pbase());
+}
+
+log_message_buffer::int_type log_message_buffer::overflow(int_type c)
+{
+  return traits_type::not_eof(c);
+}
+
+log_ring_buffer& get_thread_log() noexcept
+{
+  thread_local log_ring_buffer b;
+  return b;
+}
+
+int log_ring_buffer::to_array_index(const int i) const noexcept
+{
+  assert(i >= 0);
+  assert(i < get_n_messages());
+  const int n_overwritten{m_n_added - get_n_messages()};
+  return (n_overwritten + i) % capacity;
+}
+
+void test_log_ring_buffer()
+{
+#ifndef NDEBUG
+  // log_ring_buffer::log_ring_buffer
+  {
+    const log_ring_buffer b;
+    assert(b.get_n_messages() == 0);
+  }
+  // log_ring_buffer::add
+  {
+    log_ring_buffer b;
+    b.add(log_level::info, "hello");
+    assert(b.get_n_messages() == 1);
+    assert(b.get_message(0) == "hello");
+    assert(b.get_level(0) == log_level::info);
+  }
+  // log_ring_buffer::add truncates long messages
+  {
+    log_ring_buffer b;
+    const std::string s(log_ring_buffer::max_message_length + 1, 'x');
+    b.add(log_level::info, s);
+    assert(
+      static_cast<int>(b.get_message(0).size())
+      == log_ring_buffer::max_message_length
+    );
+  }
+  // log_ring_buffer::add overwrites the oldest message when full
+  {
+    log_ring_buffer b;
+    for (int i{0}; i != log_ring_buffer::capacity + 2; ++i)
+    {
+      b.add(log_level::debug, std::to_string(i));
+    }
+    assert(b.get_n_messages() == log_ring_buffer::capacity);
+    assert(b.get_message(0) == "2");
+    assert(
+      b.get_message(log_ring_buffer::capacity - 1)
+      == std::to_string(log_ring_buffer::capacity + 1)
+    );
+  }
+  // log_ring_buffer::add keeps the order after many messages
+  {
+    log_ring_buffer b;
+    for (int i{0}; i != 3 * log_ring_buffer::capacity; ++i)
+    {
+      b.add(log_level::debug, std::to_string(i));
+    }
+    assert(
+      b.get_message(log_ring_buffer::capacity - 1)
+      == std::to_string((3 * log_ring_buffer::capacity) - 1)
+    );
+  }
+  // log_ring_buffer::clear
+  {
+    log_ring_buffer b;
+    b.add(log_level::info, "hello");
+    b.clear();
+    assert(b.get_n_messages() == 0);
+  }
+  // log_message only calls 'write' if the level is logged
+  {
+    get_thread_log().clear();
+    bool is_called{false};
+    log_message<log_level::debug>(
+      [&is_called](std::ostream& os) { is_called = true; os << "hello"; }
+    );
+    assert(is_called == is_logged(log_level::debug));
+    assert(get_thread_log().get_n_messages() == (is_called ? 1 : 0));
+    get_thread_log().clear();
+  }
+  // log_message_buffer
+  {
+    log_message_buffer b;
+    std::ostream s(&b);
+    s << "hello " << 42;
+    assert(b.get_message() == "hello 42");
+  }
+  // log_message_buffer drops the characters that do not fit
+  {
+    log_message_buffer b;
+    std::ostream s(&b);
+    s << std::string(log_ring_buffer::max_message_length + 1, 'x');
+    assert(s.good());
+    assert(
+      static_cast<int>(b.get_message().size())
+      == log_ring_buffer::max_message_length
+    );
+  }
+  // write_log
+  {
+    log_ring_buffer b;
+    b.add(log_level::info, "hello");
+    std::stringstream s;
+    write_log(s, b);
+    assert(s.str() == "info: hello\n");
+  }
+  // operator<<
+  {
+    log_ring_buffer b;
+    b.add(log_level::info, "hello");
+    std::stringstream s;
+    s << b;
+    assert(!s.str().empty());
+  }
+#endif // NDEBUG
+}
+
+void write_log(std::ostream& os, const log_ring_buffer& b)
+{
+  const int n{b.get_n_messages()};
+  for (int i{0}; i != n; ++i)
+  {
+    os << b.get_level(i) << ": " << b.get_message(i) << '\n';
+  }
+}
+
+std::ostream& operator<<(std::ostream& os, const log_ring_buffer& b) noexcept
+{
+  write_log(os, b);
+  return os;
+}
@@ -0,0 +1,121 @@
+#ifndef LOG_RING_BUFFER_H
+#define LOG_RING_BUFFER_H
+
+#include "log_level.h"
+
+#include <array>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <string_view>
+
+/// The most recent debug log messages.
+///
+/// The messages are stored in a buffer of fixed capacity,
+/// where a new message overwrites the oldest one,
+/// so that logging does no I/O and the log allocates no memory.
+/// Use \link{write_log} to write the messages to a stream
+class log_ring_buffer
+{
+public:
+  log_ring_buffer();
+
+  /// Add a message. A message that is too long is truncated
+  void add(const log_level level, const std::string_view message) noexcept;
+
+  /// Remove all messages
+  void clear() noexcept;
+
+  /// Get the level of the message at an index,
+  /// where index zero is the oldest message
+  log_level get_level(const int i) const noexcept;
+
+  /// Get the message at an index,
+  /// where index zero is the oldest message
+  std::string_view get_message(const int i) const noexcept;
+
+  /// Get the number of messages,
+  /// which is at most \link{log_ring_buffer::capacity}
+  int get_n_messages() const noexcept;
+
+  /// The maximum number of messages
+  static constexpr int capacity{1024};
+
+  /// The maximum length of a message
+  static constexpr int max_message_length{128};
+
+private:
+
+  /// The lengths of the messages
+  std::array<int, capacity> m_lengths;
+
+  /// The levels of the messages
+  std::array<log_level, capacity> m_levels;
+
+  /// The text of the messages
+  std::array<std::array<char, max_message_length>, capacity> m_messages;
+
+  /// The number of messages ever added
+  int m_n_added;
+
+  /// Get the index in the arrays of the message at index 'i',
+  /// where index zero is the oldest message
+  int to_array_index(const int i) const noexcept;
+};
+
+/// A stream buffer that writes a message into a fixed-size array,
+/// so that \link{log_message} can format a message without allocating.
+/// Characters beyond \link{log_ring_buffer::max_message_length}
+/// are dropped
+class log_message_buffer : public std::streambuf
+{
+public:
+  log_message_buffer();
+
+  /// Get the message written so far
+  std::string_view get_message() const noexcept;
+
+protected:
+
+  /// Called when the array is full: drop the character
+  int_type overflow(int_type c) override;
+
+private:
+
+  /// The text of the message
+  std::array<char, log_ring_buffer::max_message_length> m_text;
+};
+
+/// Get the log of this thread,
+/// so that threads do not need to wait for each other
+log_ring_buffer& get_thread_log() noexcept;
+
+/// Log a message, if messages at that level are logged.
+/// The message is created by 'write', which writes it to a stream,
+/// e.g. 'log_message<log_level::debug>([&](auto& os) { os << p; })'.
+/// If messages at that level are not logged,
+/// 'write' is never called and this function does nothing.
+/// The message is formatted in a fixed-size buffer,
+/// yet the operator<< used by 'write' may allocate
+template <log_level level, class Write>
+void log_message(const Write& write)
+{
+  if constexpr (is_logged(level))
+  {
+    log_message_buffer b;
+    std::ostream s(&b);
+    write(s);
+    get_thread_log().add(level, b.get_message());
+  }
+}
+
+/// Test this class and its free functions
+void test_log_ring_buffer();
+
+/// Write all messages of a log to a stream, oldest first,
+/// one per line
+void write_log(std::ostream& os, const log_ring_buffer& b);
+
+std::ostream& operator<<(std::ostream& os, const log_ring_buffer& b) noexcept;
+
+#endif // LOG_RING_BUFFER_H
@@ -3,47 +3,81 @@
 #include "asserts.h"
 #include "about_view_layout.h"
 #include "action_history.h"
+#include "bitboard.h"
+#include "board.h"
 #include "board_to_text_options.h"
 #include "chess_move.h"
+#include "computer_player.h"
 #include "controls_view.h"
+#include "played_game_view.h"
 #include "played_game_view_layout.h"
 #include "controls_view_item.h"
 #include "controls_view_layout.h"
+#include "copy_on_write.h"
 #include "physical_controller.h"
 #include "physical_controllers.h"
+#include "fixed_timestep.h"
 #include "fps_clock.h"
 #include "game.h"
 #include "game_controller.h"
 #include "game_log.h"
 #include "game_rect.h"
 #include "game_resources.h"
+#include "game_snapshot.h"
 #include "game_view.h"
 #include "game_view_layout.h"
 #include "helper.h"
 #include "id.h"
+#include "input_recorder.h"
+#include "input_recording.h"
 #include "key_bindings.h"
+#include "keyframed_replay.h"
 #include "loading_view.h"
 #include "lobby_options.h"
+#include "lockstep.h"
+#include "lockstep_connection.h"
+#include "lockstep_packet.h"
+#include "log_level.h"
+#include "log_ring_buffer.h"
 #include "lobby_view_item.h"
 #include "lobby_view_layout.h"
+#include "mapped_file.h"
 #include "menu_view.h"
 #include "menu_view_item.h"
 #include "menu_view_layout.h"
 #include "options_view_layout.h"
+#include "pgn_reader.h"
 #include "pgn_string.h"
+#include "piece_action_queue.h"
 #include "piece_actions.h"
+#include "piece_id_table.h"
 #include "race.h"
 #include "sfml_helper.h"
 #include "read_only.h"
 #include "replay.h"
+#include "replay_validation.h"
+#include "resimulation.h"
+#include "rollout_statistics.h"
+#include "rollouts.h"
 #include "screen_coordinat.h"
+#include "simulation.h"
+#include "simulation_result.h"
+#include "simulations.h"
+#include "spsc_queue.h"
 #include "test_game.h"
+#include "tick_mode.h"
+#include "triple_buffer.h"
+#include "zobrist.h"
 
 #include <SFML/Graphics.hpp>
 
 #include <cassert>
 #include <chrono>
+#include <fstream>
 #include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
 
 /// All tests are called from here, only in debug mode
 void test()
@@ -53,9 +87,12 @@ void test()
   test_asserts();
   test_about_view_layout();
   test_action_history();
+  test_bitboard();
+  test_board();
   test_board_to_text_options();
   test_chess_color();
   test_chess_move();
+  test_computer_player();
   test_user_input();
   test_control_action_type();
   test_user_inputs();
@@ -64,47 +101,73 @@ void test()
   test_physical_controllers();
   test_controls_view_item();
   test_controls_view_layout();
+  test_copy_on_write();
   test_delta_t();
+  test_fixed_timestep();
   test_fps_clock();
   test_game();
   test_game_controller();
   test_game_coordinat();
   test_game_options();
   test_game_rect();
+  test_game_snapshot();
   test_game_speed();
   test_game_view_layout();
   test_helper();
   test_id();
+  test_input_recording();
+  test_input_recorder();
   test_key_bindings();
+  test_keyframed_replay();
   test_lobby_options();
   test_lobby_view_item();
   test_lobby_view_layout();
+  test_lockstep();
+  test_lockstep_connection();
+  test_lockstep_packet();
   test_log();
+  test_log_level();
+  test_log_ring_buffer();
+  test_mapped_file();
   test_menu_view_item();
   test_menu_view_layout();
   test_message();
   test_message_type();
   test_options_view_item();
   test_options_view_layout();
+  test_pgn_reader();
   test_pgn_string();
   test_piece();
   test_piece_action();
+  test_piece_action_queue();
   test_piece_actions();
   test_piece_action_type();
+  test_piece_id_table();
   test_piece_type();
   test_pieces();
   test_played_game_view_layout();
   test_race();
   test_read_only();
   test_replay();
+  test_replay_validation();
   test_replayer();
+  test_resimulation();
+  test_rollout_statistics();
+  test_rollouts();
   test_screen_coordinat();
   test_screen_rect();
   test_side();
   test_sfml_helper();
+  test_simulation();
+  test_simulation_result();
+  test_simulations();
+  test_spsc_queue();
   test_square();
   test_starting_position_type();
+  test_tick_mode();
+  test_triple_buffer();
   test_volume();
+  test_zobrist();
 #endif
 }
 
@@ -138,4 +201,68 @@ int main(int argc, char **argv) //!OCLINT tests may be long
     v.exec();
     #endif // LOGIC_ONLY
   }
+  else if (args[1] == "host" || args[1] == "join")
+  {
+    // Play over a network, e.g. 'host [port]' at one computer
+    // and 'join [address] [port]' at the other
+    const bool is_host{args[1] == "host"};
+    const std::size_t port_arg{is_host ? 2u : 3u};
+    const std::string address{!is_host && args.size() > 2 ? args[2] : "127.0.0.1"};
+    const unsigned short port{
+      args.size() > port_arg
+      ? static_cast<unsigned short>(std::stoi(args[port_arg]))
+      : get_default_lockstep_port()
+    };
+    try
+    {
+      std::cout
+        << (is_host ? "Waiting for the other player at port " : "Joining ")
+        << (is_host ? "" : address + ":") << port << '\n'
+      ;
+      auto connection{
+        is_host
+        ? std::make_unique<lockstep_connection>(port)
+        : std::make_unique<lockstep_connection>(address, port)
+      };
+      #ifndef LOGIC_ONLY
+      // Both players use the same game, the host plays at the left side
+      game_view v(
+        game(),
+        game_controller(create_two_keyboard_controllers()),
+        {},
+        std::move(connection),
+        is_host ? side::lhs : side::rhs
+      );
+      v.exec();
+      #endif // LOGIC_ONLY
+    }
+    catch (const std::runtime_error& e)
+    {
+      std::cerr << e.what() << '\n';
+      return 1;
+    }
+  }
+  else if (args.size() == 2)
+  {
+    // View a recorded match, e.g. 'conquer_chess_20240131_235959.ccir'
+    std::ifstream file(args[1], std::ios::binary);
+    if (!file)
+    {
+      std::cerr << "Cannot open '" << args[1] << "'\n";
+      return 1;
+    }
+    try
+    {
+      const input_recording r{read_input_recording(file)};
+      #ifndef LOGIC_ONLY
+      played_game_view v(r);
+      v.exec();
+      #endif // LOGIC_ONLY
+    }
+    catch (const std::invalid_argument& e)
+    {
+      std::cerr << "Cannot read recording '" << args[1] << "': " << e.what() << '\n';
+      return 1;
+    }
+  }
 }
@@ -0,0 +1,116 @@
+#include "mapped_file.h"
+
+#include <cassert>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define CONQUER_CHESS_USE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+mapped_file::mapped_file(const std::string& filename)
+  : m_data{nullptr},
+    m_size{0}
+{
+#ifdef CONQUER_CHESS_USE_MMAP
+  const int fd{::open(filename.c_str(), O_RDONLY)};
+  if (fd == -1)
+  {
+    throw std::runtime_error("Cannot open '" + filename + "'");
+  }
+  struct stat status;
+  if (::fstat(fd, &status) == -1)
+  {
+    ::close(fd);
+    throw std::runtime_error("Cannot get the size of '" + filename + "'");
+  }
+  m_size = static_cast<std::size_t>(status.st_size);
+  // An empty file cannot be mapped
+  if (m_size != 0)
+  {
+    void * const data{::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0)};
+    if (data == MAP_FAILED)
+    {
+      ::close(fd);
+      throw std::runtime_error("Cannot map '" + filename + "' into memory");
+    }
+    // The file is read from start to end
+    ::madvise(data, m_size, MADV_SEQUENTIAL);
+    m_data = data;
+  }
+  ::close(fd);
+#else
+  std::ifstream file(filename, std::ios::binary);
+  if (!file)
+  {
+    throw std::runtime_error("Cannot open '" + filename + "'");
+  }
+  std::stringstream s;
+  s << file.rdbuf();
+  m_contents = s.str();
+  m_size = m_contents.size();
+#endif
+}
+
+mapped_file::~mapped_file()
+{
+#ifdef CONQUER_CHESS_USE_MMAP
+  if (m_data) ::munmap(m_data, m_size);
+#endif
+}
+
+std::string_view mapped_file::get_text() const noexcept
+{
+  if (m_data) return std::string_view(static_cast<const char*>(m_data), m_size);
+  return m_contents;
+}
+
+void test_mapped_file()
+{
+#ifndef NDEBUG
+  // mapped_file::get_text
+  {
+    const std::string filename{"test_mapped_file.pgn"};
+    {
+      std::ofstream f(filename);
+      f << "1. e4 e5 1-0\n";
+    }
+    {
+      const mapped_file f(filename);
+      assert(f.get_text() == "1. e4 e5 1-0\n");
+    }
+    std::remove(filename.c_str());
+  }
+  // mapped_file::get_text, of an empty file
+  {
+    const std::string filename{"test_mapped_file_empty.pgn"};
+    {
+      std::ofstream f(filename);
+    }
+    {
+      const mapped_file f(filename);
+      assert(f.get_text().empty());
+    }
+    std::remove(filename.c_str());
+  }
+  // mapped_file::mapped_file throws if the file is absent
+  {
+    bool has_thrown{false};
+    try
+    {
+      const mapped_file f("absent.pgn");
+    }
+    catch (const std::runtime_error&)
+    {
+      has_thrown = true;
+    }
+    assert(has_thrown);
+  }
+#endif // NDEBUG
+}
@@ -0,0 +1,40 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+/// A read-only file, mapped into memory,
+/// so that a file of gigabytes can be read without copying it.
+///
+/// On systems without 'mmap' the file is read into memory instead
+class mapped_file
+{
+public:
+  /// Throws a std::runtime_error if the file cannot be opened
+  explicit mapped_file(const std::string& filename);
+  mapped_file(const mapped_file&) = delete;
+  mapped_file& operator=(const mapped_file&) = delete;
+  ~mapped_file();
+
+  /// Get the contents of the file,
+  /// which are valid as long as this object lives
+  std::string_view get_text() const noexcept;
+
+private:
+
+  /// The contents, if the file could not be mapped
+  std::string m_contents;
+
+  /// The mapped memory, if the file is mapped
+  void * m_data;
+
+  /// The size of the file, in bytes
+  std::size_t m_size;
+};
+
+/// Test this class and its free functions
+void test_mapped_file();
+
+#endif // MAPPED_FILE_H
@@ -52,6 +52,9 @@ void menu_view::exec()
     )
   );
 
+  // Show the menu once, as it is only shown again after an event
+  show();
+
   while (m_window.isOpen())
   {
     // Process user input and play game until instructed to exit
@@ -150,7 +153,9 @@ bool menu_view::process_events()
 {
   // User interaction
   sf::Event event;
-  while (m_window.pollEvent(event))
+  // Sleep until there is an event, so that an idle menu uses no CPU
+  if (!m_window.waitEvent(event)) return false;
+  do
   {
     if (event.type == sf::Event::Resized)
     {
@@ -281,7 +286,7 @@ bool menu_view::process_events()
         }
       }
     }
-  }
+  } while (m_window.pollEvent(event));
   return false; // Do not close the window :-)
 }
 
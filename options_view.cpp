@@ -147,6 +147,9 @@ void options_view::exec()
     ),
     "Conquer Chess: options menu"
   );
+  // Show the menu once, as it is only shown again after an event
+  show();
+
   while (m_window.isOpen())
   {
     // Process user input and play game until instructed to exit
@@ -174,7 +177,9 @@ bool options_view::process_events()
 {
   // User interaction
   sf::Event event;
-  while (m_window.pollEvent(event))
+  // Sleep until there is an event, so that an idle menu uses no CPU
+  if (!m_window.waitEvent(event)) return false;
+  do
   {
     if (event.type == sf::Event::Resized)
     {
@@ -275,7 +280,7 @@ bool options_view::process_events()
     {
       increase_selected();
     }
-  }
+  } while (m_window.pollEvent(event));
   return false; // if no events proceed with tick
 }
 
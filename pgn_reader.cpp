@@ -0,0 +1,301 @@
+#include "pgn_reader.h"
+
+#include "replay.h"
+
+#include <algorithm>
+#include <cassert>
+#include <string>
+
+pgn_reader::pgn_reader(const std::string_view text)
+  : m_n_games{0},
+    m_pos{0},
+    m_text{text}
+{
+
+}
+
+std::string_view get_tag(const pgn_reader& r, const std::string_view name) noexcept
+{
+  const auto& tags{r.get_tags()};
+  const auto there{
+    std::find_if(
+      std::begin(tags),
+      std::end(tags),
+      [name](const auto& tag) { return tag.first == name; }
+    )
+  };
+  if (there == std::end(tags)) return {};
+  return there->second;
+}
+
+bool is_game_result(const std::string_view token) noexcept
+{
+  return token == "1-0" || token == "0-1" || token == "1/2-1/2" || token == "*";
+}
+
+bool pgn_reader::read_game()
+{
+  const auto is_space{
+    [](const char c) { return c == ' ' || c == '\n' || c == '\r' || c == '\t'; }
+  };
+  const auto is_delimiter{
+    [is_space](const char c)
+    {
+      return is_space(c)
+        || c == '{' || c == '}' || c == '(' || c == ')'
+        || c == '[' || c == ']' || c == ';'
+      ;
+    }
+  };
+  m_moves.clear();
+  m_tags.clear();
+  chess_color color{chess_color::white};
+  const std::size_t n{m_text.size()};
+  while (m_pos != n)
+  {
+    const char c{m_text[m_pos]};
+    if (is_space(c) || c == ')' || c == '}' || c == ']')
+    {
+      ++m_pos;
+    }
+    else if (c == '[')
+    {
+      // A tag after the moves belongs to the next game
+      if (!m_moves.empty()) break;
+      read_tag();
+    }
+    else if (c == '{')
+    {
+      skip_past('}');
+    }
+    else if (c == ';' || (c == '%' && (m_pos == 0 || m_text[m_pos - 1] == '\n')))
+    {
+      skip_past('\n');
+    }
+    else if (c == '(')
+    {
+      skip_variation();
+    }
+    else
+    {
+      const std::size_t begin{m_pos};
+      while (m_pos != n && !is_delimiter(m_text[m_pos])) ++m_pos;
+      std::string_view token{m_text.substr(begin, m_pos - begin)};
+      // A numeric annotation, e.g. '$1'
+      if (token.front() == '$') continue;
+      // A move number, e.g. '12.' or '12...', which can be followed by a move, e.g. '12.e4'
+      const std::size_t n_digits{token.find_first_not_of("0123456789")};
+      if (n_digits != 0 && n_digits != std::string_view::npos && token[n_digits] == '.')
+      {
+        const std::size_t n_prefix{token.find_first_not_of('.', n_digits)};
+        if (n_prefix == std::string_view::npos) continue;
+        token.remove_prefix(n_prefix);
+      }
+      if (is_game_result(token))
+      {
+        if (token != "*") m_moves.emplace_back(token, color);
+        ++m_n_games;
+        return true;
+      }
+      m_moves.emplace_back(strip_annotation(token), color);
+      color = get_other_color(color);
+    }
+  }
+  // A game without a result, at the end of the text or before the next tags
+  if (m_moves.empty() && m_tags.empty()) return false;
+  ++m_n_games;
+  return true;
+}
+
+void pgn_reader::read_tag()
+{
+  assert(m_text[m_pos] == '[');
+  const std::size_t n{m_text.size()};
+  std::size_t pos{m_pos + 1};
+  const std::size_t name_begin{pos};
+  while (pos != n && m_text[pos] != ' ' && m_text[pos] != '"' && m_text[pos] != ']') ++pos;
+  const std::string_view name{m_text.substr(name_begin, pos - name_begin)};
+  while (pos != n && m_text[pos] == ' ') ++pos;
+  std::string_view value;
+  if (pos != n && m_text[pos] == '"')
+  {
+    const std::size_t value_begin{++pos};
+    // A quote in the value is escaped by a backslash
+    // A backslash at the end steps past the end of the text
+    while (pos < n && m_text[pos] != '"')
+    {
+      pos += m_text[pos] == '\\' ? 2 : 1;
+    }
+    pos = std::min(pos, n);
+    value = m_text.substr(value_begin, pos - value_begin);
+  }
+  m_pos = pos;
+  skip_past(']');
+  m_tags.emplace_back(name, value);
+}
+
+void pgn_reader::skip_past(const char c) noexcept
+{
+  const std::size_t there{m_text.find(c, m_pos)};
+  m_pos = there == std::string_view::npos ? m_text.size() : there + 1;
+}
+
+void pgn_reader::skip_variation() noexcept
+{
+  assert(m_text[m_pos] == '(');
+  const std::size_t n{m_text.size()};
+  int depth{0};
+  while (m_pos != n)
+  {
+    const char c{m_text[m_pos]};
+    if (c == '{')
+    {
+      // A comment can have parentheses
+      skip_past('}');
+      continue;
+    }
+    ++m_pos;
+    if (c == '(') ++depth;
+    else if (c == ')' && --depth == 0) return;
+  }
+}
+
+std::string_view strip_annotation(std::string_view token) noexcept
+{
+  std::size_t n{token.size()};
+  while (n != 0 && (token[n - 1] == '!' || token[n - 1] == '?')) --n;
+  if (token.find('!', n) != std::string_view::npos)
+  {
+    token.remove_suffix(token.size() - n);
+  }
+  return token;
+}
+
+void test_pgn_reader()
+{
+#ifndef NDEBUG
+  // pgn_reader::read_game on an empty text
+  {
+    pgn_reader r("");
+    assert(!r.read_game());
+    assert(r.get_n_games() == 0);
+  }
+  // pgn_reader::read_game on one line, as used by a replay
+  {
+    // The text must outlive the reader
+    const std::string text{get_scholars_mate_as_pgn_str()};
+    pgn_reader r(text);
+    assert(r.read_game());
+    assert(r.get_moves().size() == 8);
+    assert(r.get_moves()[5] == chess_move("Nf6??", chess_color::black));
+    assert(is_win(r.get_moves().back()));
+    assert(!r.read_game());
+    assert(r.get_n_games() == 1);
+  }
+  // pgn_reader::read_game reads tags and skips comments, variations and annotations
+  {
+    const std::string text{
+      "[Event \"F/S Return Match\"]\n"
+      "[White \"Fischer, Robert J.\"]\n"
+      "[Annotator \"A \\\"quoted\\\" name\"]\n"
+      "\n"
+      "1. e4 e5 2. Nf3 {This opening is called the (Ruy) Lopez.} 2... Nc6\n"
+      "3. Bb5 a6 (3... Nf6 4. O-O (4. d3)) 4. Ba4 $1 Nf6! 5. O-O!? ; a comment\n"
+      "5... Be7 6.Re1 b5 1/2-1/2\n"
+      "\n"
+      "[Event \"Second\"]\n"
+      "\n"
+      "1. d4 d5 0-1\n"
+      "\n"
+      "1. c4 *\n"
+    };
+    pgn_reader r(text);
+    assert(r.read_game());
+    assert(get_tag(r, "Event") == "F/S Return Match");
+    assert(get_tag(r, "White") == "Fischer, Robert J.");
+    assert(get_tag(r, "Annotator") == "A \\\"quoted\\\" name");
+    assert(get_tag(r, "Black").empty());
+    const std::vector<std::string> expected{
+      "e4", "e5", "Nf3", "Nc6", "Bb5", "a6", "Ba4", "Nf6", "O-O", "Be7", "Re1", "b5", "1/2-1/2"
+    };
+    assert(r.get_moves().size() == expected.size());
+    for (std::size_t i{0}; i != expected.size(); ++i)
+    {
+      assert(r.get_moves()[i].get_pgn_str() == expected[i]);
+      assert(r.get_moves()[i].get_color() == (i % 2 == 0 ? chess_color::white : chess_color::black));
+    }
+    assert(r.read_game());
+    assert(get_tag(r, "Event") == "Second");
+    assert(r.get_moves().size() == 3);
+    assert(r.read_game());
+    assert(r.get_tags().empty());
+    assert(r.get_moves().size() == 1);
+    assert(!r.read_game());
+    assert(r.get_n_games() == 3);
+  }
+  // pgn_reader::read_game reads castling with a check or checkmate
+  {
+    pgn_reader r("1. O-O+ O-O-O# 2. O-O+!? O-O-O#?? 1-0");
+    assert(r.read_game());
+    assert(r.get_moves().size() == 5);
+    for (int i{0}; i != 4; ++i)
+    {
+      assert(is_castling(r.get_moves()[i]));
+    }
+    assert(r.get_moves()[0].get_castling_type() == castling_type::king_side);
+    assert(r.get_moves()[1].get_castling_type() == castling_type::queen_side);
+    assert(r.get_moves()[2].get_pgn_str() == "O-O+");
+    assert(r.get_moves()[3].get_pgn_str() == "O-O-O#??");
+  }
+  // pgn_reader::read_game on a text that ends after a backslash in a tag value
+  {
+    pgn_reader r("[Event \"a\\");
+    assert(r.read_game());
+    assert(get_tag(r, "Event") == "a\\");
+    assert(r.get_moves().empty());
+    assert(!r.read_game());
+  }
+  // pgn_reader::read_game, a game without a result ends at the next tags
+  {
+    pgn_reader r("1. e4 e5\n[Event \"Next\"]\n1. d4 1-0");
+    assert(r.read_game());
+    assert(r.get_moves().size() == 2);
+    assert(r.read_game());
+    assert(get_tag(r, "Event") == "Next");
+    assert(!r.read_game());
+  }
+  // pgn_reader::read_game gives the same moves as split_pgn_str
+  {
+    const std::string text{get_replay_1_as_pgn_str()};
+    const auto pgn_strs{split_pgn_str(text)};
+    pgn_reader r(text);
+    assert(r.read_game());
+    assert(r.get_moves().size() == pgn_strs.size());
+    for (std::size_t i{0}; i != pgn_strs.size(); ++i)
+    {
+      assert(r.get_moves()[i].get_pgn_str() == pgn_strs[i]);
+    }
+  }
+  // is_game_result
+  {
+    assert(is_game_result("1-0"));
+    assert(is_game_result("0-1"));
+    assert(is_game_result("1/2-1/2"));
+    assert(is_game_result("*"));
+    assert(!is_game_result("e4"));
+  }
+  // strip_annotation
+  {
+    assert(strip_annotation("e4") == "e4");
+    assert(strip_annotation("e4!") == "e4");
+    assert(strip_annotation("e4!!") == "e4");
+    assert(strip_annotation("e4!?") == "e4");
+    assert(strip_annotation("e4?!") == "e4");
+    assert(strip_annotation("Qxf7+!") == "Qxf7+");
+    assert(strip_annotation("O-O+!") == "O-O+");
+    assert(strip_annotation("O-O-O#!?") == "O-O-O#");
+    assert(strip_annotation("e4?") == "e4?");
+    assert(strip_annotation("e4??") == "e4??");
+  }
+#endif // NDEBUG
+}
@@ -0,0 +1,83 @@
+#ifndef PGN_READER_H
+#define PGN_READER_H
+
+#include "chess_move.h"
+
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/// Reads the games in a PGN text, one game at a time,
+/// e.g. from a \link{mapped_file} of a game database.
+///
+/// Comments, variations, move numbers and numeric annotations are skipped.
+/// The tags are views on the text, so the text must outlive this reader.
+/// The buffers of a game are re-used for the next,
+/// so reading a game does not allocate memory after the first few games
+class pgn_reader
+{
+public:
+  explicit pgn_reader(const std::string_view text);
+
+  /// Get the moves of the game read last,
+  /// including the result, e.g. '1-0', if there is one
+  const auto& get_moves() const noexcept { return m_moves; }
+
+  /// Get the number of games read
+  int get_n_games() const noexcept { return m_n_games; }
+
+  /// Get the tags of the game read last,
+  /// e.g. the pair 'White' and 'Kasparov, Garry' for the tag '[White "Kasparov, Garry"]'
+  const auto& get_tags() const noexcept { return m_tags; }
+
+  /// Read the next game.
+  /// Returns false if there are no more games
+  bool read_game();
+
+private:
+
+  /// The moves of the game read last
+  std::vector<chess_move> m_moves;
+
+  /// The number of games read
+  int m_n_games;
+
+  /// The index of the next character to read
+  std::size_t m_pos;
+
+  /// The tags of the game read last
+  std::vector<std::pair<std::string_view, std::string_view>> m_tags;
+
+  /// The text to read from
+  std::string_view m_text;
+
+  /// Read a tag, e.g. '[Event "F/S Return Match"]',
+  /// with m_pos at its '['
+  void read_tag();
+
+  /// Skip until and including a character,
+  /// or to the end if it is not there
+  void skip_past(const char c) noexcept;
+
+  /// Skip a variation, which can have variations itself,
+  /// with m_pos at its '('
+  void skip_variation() noexcept;
+};
+
+/// Get the value of a tag of the game read last,
+/// e.g. 'Kasparov, Garry' for 'White'.
+/// Returns an empty string if the game has no such tag
+std::string_view get_tag(const pgn_reader& r, const std::string_view name) noexcept;
+
+/// Is the token the result of a game, e.g. '1-0' or '*'?
+bool is_game_result(const std::string_view token) noexcept;
+
+/// Remove the annotation that a chess_move does not know, e.g. '!' or '?!',
+/// keeping the ones it does know, e.g. '??',
+/// and the check or checkmate, e.g. 'O-O+!' becomes 'O-O+'
+std::string_view strip_annotation(std::string_view token) noexcept;
+
+/// Test this class and its free functions
+void test_pgn_reader();
+
+#endif // PGN_READER_H
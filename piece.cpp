@@ -5,6 +5,8 @@
 #include "square.h"
 #include "message.h"
 #include "game.h"
+#include "log_ring_buffer.h"
+#include "zobrist.h"
 
 #include <algorithm>
 #include <cassert>
@@ -18,20 +20,21 @@ piece::piece(
   const square& coordinat,
   const race r
 )
-  : m_color{color},
-    m_current_action_time{delta_t(0.0)},
+  : m_current_action_time{delta_t(0.0)},
+    m_health{::get_max_health(type)},
+    m_time{delta_t(0.0)},
+    m_color{color},
+    m_type{type},
+    m_kill_count{0},
     m_current_square{coordinat},
     m_has_moved{false},
-    m_health{::get_max_health(type)},
-    m_id{create_new_id()},
     m_is_selected{false},
-    m_kill_count{0},
+    m_hash{0},
+    m_id{create_new_id()},
     m_max_health{::get_max_health(type)},
-    m_race{r},
-    m_time{delta_t(0.0)},
-    m_type{type}
+    m_race{r}
 {
-
+  xor_square_keys(m_current_square);
 }
 
 piece::piece(
@@ -146,7 +149,7 @@ void piece::add_action(const piece_action& action)
 
 void piece::add_message(const message_type& message)
 {
-  m_messages.push_back(message);
+  m_messages.get_mutable().push_back(message);
 }
 
 bool can_attack(
@@ -254,6 +257,17 @@ bool can_promote(const piece& p) noexcept
   );
 }
 
+std::uint64_t calc_hash(const piece& p) noexcept
+{
+  const square& s{p.get_current_square()};
+  std::uint64_t hash{
+    get_zobrist_key(p.get_color(), p.get_type(), s)
+    ^ get_zobrist_health_key(s, get_zobrist_health_bucket(get_f_health(p)))
+  };
+  if (p.is_selected()) hash ^= get_zobrist_selected_key(s);
+  return hash;
+}
+
 void clear_actions(piece& p)
 {
   p.get_actions().clear();
@@ -262,8 +276,9 @@ void clear_actions(piece& p)
 
 void piece::clear_messages() noexcept
 {
-  m_messages.clear();
-  assert(m_messages.empty());
+  if (get_messages().empty()) return; // Keep sharing the messages
+  m_messages.get_mutable().clear();
+  assert(get_messages().empty());
 }
 
 int count_piece_actions(const piece& p)
@@ -293,6 +308,15 @@ double get_f_health(const piece& p) noexcept
   return p.get_health() / p.get_max_health();
 }
 
+std::uint64_t get_hash(const piece& p) noexcept
+{
+  if (p.get_actions().empty()) return p.get_hash();
+  return p.get_hash() ^ get_zobrist_action_key(
+    p.get_actions().front(),
+    get_zobrist_progress_bucket(p.get_current_action_time())
+  );
+}
+
 square get_occupied_square(const piece& p) noexcept
 {
   return p.get_current_square();
@@ -347,7 +371,15 @@ bool is_idle(const piece& p) noexcept
 void piece::receive_damage(const double damage)
 {
   assert(damage >= 0.0);
+  const int old_bucket{get_zobrist_health_bucket(get_f_health(*this))};
   m_health -= damage;
+  const int new_bucket{get_zobrist_health_bucket(get_f_health(*this))};
+  if (old_bucket != new_bucket)
+  {
+    m_hash ^= get_zobrist_health_key(m_current_square, old_bucket)
+      ^ get_zobrist_health_key(m_current_square, new_bucket)
+    ;
+  }
 }
 
 void select(piece& p) noexcept
@@ -360,13 +392,36 @@ void piece::set_current_action_time(const delta_t& t) noexcept
   m_current_action_time = t;
 }
 
+void piece::set_current_square(const square& s) noexcept
+{
+  xor_square_keys(m_current_square);
+  m_current_square = s;
+  xor_square_keys(m_current_square);
+}
+
+void piece::set_is_selected(const bool is_selected) noexcept
+{
+  if (m_is_selected != is_selected)
+  {
+    m_hash ^= get_zobrist_selected_key(m_current_square);
+  }
+  m_is_selected = is_selected;
+}
+
 void piece::set_selected(const bool is_selected) noexcept
 {
   if (!m_is_selected && is_selected)
   {
     add_message(message_type::select);
   }
-  m_is_selected = is_selected;
+  set_is_selected(is_selected);
+}
+
+void piece::set_type(const piece_type type) noexcept
+{
+  xor_square_keys(m_current_square);
+  m_type = type;
+  xor_square_keys(m_current_square);
 }
 
 void test_piece()
@@ -658,6 +713,59 @@ void test_piece()
     const auto p{get_test_white_king()};
     assert(get_f_health(p) == 1.0);
   }
+  // get_hash of pieces in the same state is the same
+  {
+    const auto a{get_test_white_king()};
+    const auto b{get_test_white_king()};
+    assert(a.get_id() != b.get_id());
+    assert(a.get_hash() == b.get_hash());
+    assert(a.get_hash() == calc_hash(a));
+    assert(get_hash(a) == a.get_hash());
+    assert(a.get_hash() != get_test_white_knight().get_hash());
+  }
+  // get_hash is kept up to date when moving
+  {
+    auto p{get_test_white_king()};
+    const auto before{p.get_hash()};
+    p.set_current_square(square("e2"));
+    assert(p.get_hash() != before);
+    assert(p.get_hash() == calc_hash(p));
+    p.set_current_square(square("e1"));
+    assert(p.get_hash() == before);
+  }
+  // get_hash is kept up to date when receiving damage
+  {
+    auto p{get_test_white_king()};
+    const auto before{p.get_hash()};
+    p.receive_damage(0.0);
+    assert(p.get_hash() == before);
+    p.receive_damage(p.get_max_health() / 2.0);
+    assert(p.get_hash() != before);
+    assert(p.get_hash() == calc_hash(p));
+  }
+  // get_hash is kept up to date when selecting
+  {
+    auto p{get_test_white_king()};
+    const auto before{p.get_hash()};
+    select(p);
+    assert(p.get_hash() != before);
+    assert(p.get_hash() == calc_hash(p));
+    p.set_current_square(square("e2"));
+    assert(p.get_hash() == calc_hash(p));
+    unselect(p);
+    p.set_current_square(square("e1"));
+    assert(p.get_hash() == before);
+  }
+  // get_hash includes the action
+  {
+    auto p{get_test_white_king()};
+    p.add_action(piece_action(chess_color::white, piece_type::king, piece_action_type::move, square("e1"), square("e2")));
+    assert(get_hash(p) != p.get_hash());
+    p.set_current_action_time(delta_t(0.5));
+    const auto halfway{get_hash(p)};
+    p.set_current_action_time(delta_t(0.0));
+    assert(get_hash(p) != halfway);
+  }
   // get_max_health
   {
     const auto p{get_test_white_king()};
@@ -923,6 +1031,30 @@ void test_piece()
     // Black queen is shot, but survives
     assert(get_f_health(black_queen) < 1.0);
   }
+  // When two pieces kill the same piece in one tick,
+  // only the first captures it, the second sees a piece of its own color
+  // and stops attacking.
+  // The white pawn at e4 is before the black pawns in the pieces,
+  // which used to make the second attacker capture it as well
+  {
+    game g{get_game_with_starting_position(starting_position_type::pawn_all_out_assault)};
+    get_piece_at(g, square("d5")).add_action(piece_action(chess_color::black, piece_type::pawn, piece_action_type::attack, square("d5"), square("e4")));
+    get_piece_at(g, square("f5")).add_action(piece_action(chess_color::black, piece_type::pawn, piece_action_type::attack, square("f5"), square("e4")));
+    g.tick(delta_t(100.0));
+    const auto& pieces{g.get_pieces()};
+    assert(
+      std::count_if(
+        std::begin(pieces),
+        std::end(pieces),
+        [](const auto& p) { return p.get_current_square() == square("e4"); }
+      ) == 1
+    );
+    assert(get_piece_at(g, square("e4")).get_color() == chess_color::black);
+    assert(get_piece_at(g, square("e4")).get_kill_count() == 1);
+    assert(is_piece_at(g, square("f5")));
+    assert(!has_actions(get_piece_at(g, square("f5"))));
+    assert(get_piece_at(g, square("f5")).get_kill_count() == 0);
+  }
   // A knight never occupied squares between its source and target square
   {
     piece p{get_test_white_knight()};
@@ -944,6 +1076,34 @@ void test_piece()
     assert(p.get_current_square() == square("e4"));
     assert(get_occupied_square(p) == square("e4"));
   }
+  // A piece that finds its target occupied moves back,
+  // using its own color and type, not those of the piece at its source square
+  {
+    game g{get_game_with_starting_position(starting_position_type::pawn_all_out_assault)};
+    assert(get_piece_at(g, square("d1")).get_type() == piece_type::queen);
+    piece p(chess_color::white, piece_type::rook, square("d1"));
+    p.add_action(piece_action(chess_color::white, piece_type::rook, piece_action_type::move, square("d1"), square("d4")));
+    p.tick(delta_t(0.1), g);
+    assert(has_actions(p));
+    const auto& back{p.get_actions()[0]};
+    assert(back.get_action_type() == piece_action_type::move);
+    assert(back.get_piece_type() == piece_type::rook);
+    assert(back.get_color() == chess_color::white);
+    assert(back.get_from() == square("d4"));
+    assert(back.get_to() == square("d1"));
+  }
+  // A pawn that finds its target occupied cannot move back,
+  // so it stays idle, with its action time reset
+  {
+    game g{get_game_with_starting_position(starting_position_type::pawn_all_out_assault)};
+    assert(is_empty(g, square("e3")));
+    piece p(chess_color::white, piece_type::pawn, square("e3"));
+    p.add_action(piece_action(chess_color::white, piece_type::pawn, piece_action_type::move, square("e3"), square("e4")));
+    p.tick(delta_t(0.1), g);
+    assert(!has_actions(p));
+    assert(p.get_current_square() == square("e3"));
+    assert(p.get_current_action_time() == delta_t(0.0));
+  }
   // operator<<
   {
     std::stringstream s;
@@ -964,7 +1124,12 @@ void piece::tick(
     return;
   }
   const auto action_type{m_actions[0].get_action_type()};
-  std::clog << get_color() << " " << get_type() << " going to " << action_type << '\n';
+  log_message<log_level::debug>(
+    [&](std::ostream& os)
+    {
+      os << get_color() << " " << get_type() << " going to " << action_type;
+    }
+  );
   if (!has_actions(m_action_history)
     || get_last_action(m_action_history) != m_actions[0]
   )
@@ -977,29 +1142,29 @@ void piece::tick(
   {
     case piece_action_type::move:
       m_has_moved = true; // Whatever happens, this piece has tried to move
-      m_is_selected = false; //
+      set_is_selected(false); //
       return tick_move(*this, dt, g);
     case piece_action_type::attack:
       return tick_attack(*this, dt, g);
     case piece_action_type::unselect:
       assert(m_is_selected);
-      m_is_selected = false;
+      set_is_selected(false);
       remove_first(m_actions);
       return;
     case piece_action_type::select:
       assert(!m_is_selected);
-      m_is_selected = true;
+      set_is_selected(true);
       remove_first(m_actions);
       return;
     case piece_action_type::castle_kingside:
-      m_is_selected = false; //
+      set_is_selected(false); //
       #ifdef FIX_ISSUE_3
       return tick_castle_kingside(*this, dt, g);
       #else
       return;
       #endif // FIX_ISSUE_3
     case piece_action_type::castle_queenside:
-      m_is_selected = false; //
+      set_is_selected(false); //
       #ifdef FIX_ISSUE_3
       return tick_castle_queenside(*this, dt, g);
       #else
@@ -1020,7 +1185,7 @@ void piece::tick(
       );
       assert(get_type() == piece_type::pawn);
       add_message(message_type::done);
-      m_type = first_action.get_piece_type();
+      set_type(first_action.get_piece_type());
       remove_first(m_actions);
     }
   }
@@ -1099,8 +1264,7 @@ void tick_move(
   assert(f >= 0.0);
   assert(f <= 1.0);
 
-  const auto occupied_squares{get_occupied_squares(g)};
-  const bool is_target_occupied{is_occupied(first_action.get_to(), occupied_squares)};
+  const bool is_target_occupied{is_piece_at(g, first_action.get_to())};
   const bool is_focal_piece_at_target{p.get_current_square() == first_action.get_to()};
 
   if (is_target_occupied)
@@ -1109,7 +1273,12 @@ void tick_move(
     {
       // Moving the last half
       assert(f > 0.5);
-      std::clog << "Piece over halfway (" << f << "), already occupies " << p.get_current_square() << '\n';
+      log_message<log_level::debug>(
+        [&](std::ostream& os)
+        {
+          os << "Piece over halfway (" << f << "), already occupies " << p.get_current_square();
+        }
+      );
     }
     else
     {
@@ -1117,29 +1286,49 @@ void tick_move(
       p.get_actions().clear();
       p.add_action(
         piece_action(
-          get_piece_at(g, first_action.get_from()).get_color(),
-          get_piece_at(g, first_action.get_from()).get_type(),
+          p.get_color(),
+          p.get_type(),
           piece_action_type::move,
           first_action.get_to(), // Reverse
           first_action.get_from()
         )
       );
-      p.set_current_action_time(delta_t(1.0) - p.get_current_action_time()); // Keep progress
+      if (p.get_actions().empty())
+      {
+        // A pawn cannot move back, yet has not left its square
+        p.set_current_action_time(delta_t(0.0));
+      }
+      else
+      {
+        p.set_current_action_time(delta_t(1.0) - p.get_current_action_time()); // Keep progress
+      }
       p.add_message(message_type::cannot);
-      std::clog << "I cannot" << '\n';
+      log_message<log_level::debug>(
+        [](std::ostream& os) { os << "I cannot"; }
+      );
       return;
     }
   }
   else
   {
-    std::clog << "Piece not yet halfway (" << f << "), still occupied " << p.get_current_square() << '\n';
+    log_message<log_level::debug>(
+      [&](std::ostream& os)
+      {
+        os << "Piece not yet halfway (" << f << "), still occupied " << p.get_current_square();
+      }
+    );
     assert(!is_target_occupied);
     if (f >= 0.5)
     {
       // If over halfway, occupy target
-      assert(!is_occupied(first_action.get_to(), get_occupied_squares(g)));
+      assert(!is_piece_at(g, first_action.get_to()));
       p.set_current_square(first_action.get_to());
-      std::clog << "Piece over halfway (" << f << "), now occupies " << p.get_current_square() << '\n';
+      log_message<log_level::debug>(
+        [&](std::ostream& os)
+        {
+          os << "Piece over halfway (" << f << "), now occupies " << p.get_current_square();
+        }
+      );
       // Maybe cannot check, as p is not fully updated in game?
       // assert(is_occupied(first_action.get_to(), get_occupied_squares(g)));
     }
@@ -1179,6 +1368,14 @@ void unselect(piece& p) noexcept
   p.set_selected(false);
 }
 
+void piece::xor_square_keys(const square& s) noexcept
+{
+  m_hash ^= get_zobrist_key(get_color(), get_type(), s)
+    ^ get_zobrist_health_key(s, get_zobrist_health_bucket(get_f_health(*this)))
+  ;
+  if (m_is_selected) m_hash ^= get_zobrist_selected_key(s);
+}
+
 bool operator==(const piece& lhs, const piece& rhs) noexcept
 {
   return lhs.get_type() == rhs.get_type()
@@ -4,11 +4,13 @@
 #include <iosfwd>
 
 #include "action_history.h"
+#include "copy_on_write.h"
 #include "delta_t.h"
 #include "chess_color.h"
 #include "id.h"
 #include "piece_type.h"
 #include "piece_action.h"
+#include "piece_action_queue.h"
 #include "game_coordinat.h"
 #include "message.h"
 #include "message_type.h"
@@ -17,10 +19,17 @@
 #include "side.h"
 #include "read_only.h"
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
-/// A chess piece
+/// A chess piece.
+///
+/// The pieces of a game are stored as a std::vector<piece>,
+/// i.e. as an array of structures, as pieces are passed by reference
+/// throughout the game, its views and its tests.
+/// To keep a tick cache-friendly, the state read every tick
+/// is stored inline and together, see the private members
 class piece
 {
 public:
@@ -64,6 +73,11 @@ public:
 
   const auto& get_current_square() const noexcept { return m_current_square; }
 
+  /// Get the Zobrist hash of the color, type, square, health and selectedness,
+  /// which is kept up to date by the member functions that change these.
+  /// The actions are not in here, see the free function \link{get_hash}
+  auto get_hash() const noexcept { return m_hash; }
+
   /// Get the health of the unit
   double get_health() const noexcept { return m_health; }
 
@@ -77,7 +91,7 @@ public:
   double get_max_health() const noexcept { return m_max_health; }
 
   /// The things this piece wants to say
-  const auto& get_messages() const noexcept { return m_messages; }
+  const auto& get_messages() const noexcept { return m_messages.get(); }
 
   /// Get the race of piece, e.g class, protoss, terran or zerg
   const auto& get_race() const noexcept { return m_race.get_value(); }
@@ -102,7 +116,7 @@ public:
   void set_current_action_time(const delta_t& t) noexcept;
 
   /// Set the current/occupied square
-  void set_current_square(const square& s) noexcept { m_current_square = s; }
+  void set_current_square(const square& s) noexcept;
 
   /// Set the selectedness of the piece
   void set_selected(bool is_selected) noexcept;
@@ -120,17 +134,29 @@ public:
 
 private:
 
+  // The members read every tick come first,
+  // so that these share the same cache lines
+
   /// The actions the piece is doing, or about to do
-  std::vector<piece_action> m_actions;
+  piece_action_queue m_actions;
 
-  /// The history of actions, in chrononical order
-  action_history m_action_history;
+  /// Time that the current action is taking
+  delta_t m_current_action_time;
+
+  /// The health
+  double m_health;
+
+  /// The time (in chess move time)
+  delta_t m_time;
 
   /// The color of the piece, i.e. white or black
   read_only<chess_color> m_color;
 
-  /// Time that the current action is taking
-  delta_t m_current_action_time;
+  /// The type of piece, e.g. king, queen, rook, bishop, knight, pawn
+  read_only<piece_type> m_type;
+
+  /// The number of pieces killed by this one
+  int m_kill_count;
 
   /// The square the piece occupies now
   square m_current_square;
@@ -138,34 +164,45 @@ private:
   /// Has this piece (attempted to) move?
   bool m_has_moved;
 
-  /// The health
-  double m_health;
-
-  /// The unique ID of this piece
-  read_only<id> m_id;
-
   /// Is this piece selected?
   bool m_is_selected;
 
-  /// The number of pieces killed by this one
-  int m_kill_count;
+  /// The Zobrist hash, see 'get_hash'
+  std::uint64_t m_hash;
+
+  // The members below are rarely read during a tick
+
+  /// The history of actions, in chrononical order
+  action_history m_action_history;
+
+  /// The unique ID of this piece
+  read_only<id> m_id;
 
   /// The maximum health
   double m_max_health;
 
   /// The things this piece wants to say
-  std::vector<message_type> m_messages;
+  copy_on_write<std::vector<message_type>> m_messages;
 
   /// The race of this piece
   read_only<race> m_race;
 
-  /// The time (in chess move time)
-  delta_t m_time;
+  /// Set the selectedness, without saying so
+  void set_is_selected(const bool is_selected) noexcept;
 
-  /// The type of piece, e.g. king, queen, rook, bishop, knight, pawn
-  read_only<piece_type> m_type;
+  /// Set the type, i.e. promote
+  void set_type(const piece_type type) noexcept;
+
+  /// Add or remove the Zobrist keys of the features that depend on the square,
+  /// as adding and removing are both an XOR
+  void xor_square_keys(const square& s) noexcept;
 };
 
+/// Calculate the Zobrist hash of the color, type, square,
+/// health and selectedness from scratch,
+/// which is what 'piece::get_hash' keeps up to date incrementally
+std::uint64_t calc_hash(const piece& p) noexcept;
+
 /// Can a piece attack from 'from' to 'to'?
 /// This function assumes the board is empty
 bool can_attack(
@@ -215,6 +252,10 @@ std::string describe_actions(const piece& p);
 /// Get the fraction of the health, where 1.0 denotes full health
 double get_f_health(const piece& p) noexcept;
 
+/// Get the Zobrist hash of a piece, including the progress
+/// of the action it is doing, if any
+std::uint64_t get_hash(const piece& p) noexcept;
+
 /// Get the square that this piece occupies now
 square get_occupied_square(const piece& p) noexcept;
 
@@ -4,8 +4,10 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <iostream>
 #include <sstream>
+#include <type_traits>
 
 piece_action::piece_action(
   const chess_color color,
@@ -13,13 +15,16 @@ piece_action::piece_action(
   const piece_action_type at,
   const square& from,
   const square& to
-) : m_action_type{at},
-    m_color{color},
+) : m_action_type{static_cast<std::uint8_t>(at)},
+    m_color{static_cast<std::uint8_t>(color)},
+    m_piece_type{static_cast<std::uint8_t>(pt)},
     m_from{from},
-    m_piece_type{pt},
     m_to{to}
 {
   // m_from can be m_to if a piece needs to move back
+  assert(get_action_type() == at);
+  assert(get_color() == color);
+  assert(get_piece_type() == pt);
 }
 
 piece_action::piece_action(
@@ -85,6 +90,22 @@ bool is_atomic(const piece_action& a) noexcept
 void test_piece_action()
 {
 #ifndef NDEBUG
+  // piece_action is four bytes that can be copied with memcpy
+  {
+    static_assert(sizeof(piece_action) == 4);
+    static_assert(std::is_trivially_copyable_v<piece_action>);
+    const piece_action a(
+      chess_color::black, piece_type::rook, piece_action_type::unselect, "h8", "a1"
+    );
+    assert(a.get_color() == chess_color::black);
+    assert(a.get_piece_type() == piece_type::rook);
+    assert(a.get_action_type() == piece_action_type::unselect);
+    assert(a.get_from() == square("h8"));
+    assert(a.get_to() == square("a1"));
+    piece_action b{get_test_piece_action()};
+    std::memcpy(&b, &a, sizeof(a));
+    assert(b == a);
+  }
   // describe_action
   {
     const piece_action a(chess_color::white, piece_type::rook, piece_action_type::attack, square("d1"), square("d8"));
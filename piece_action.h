@@ -1,6 +1,7 @@
 #ifndef PIECE_ACTION_H
 #define PIECE_ACTION_H
 
+#include <cstdint>
 #include <iosfwd>
 #include <string>
 #include <vector>
@@ -13,6 +14,9 @@
 /// An action to be done by a piece, for example:
 /// * Move from d1 to d7
 /// * Attack e5
+///
+/// A piece_action is four bytes that can be copied with memcpy,
+/// so that action histories and queues stay small
 class piece_action
 {
 public:
@@ -35,18 +39,24 @@ public:
     const std::string& to_str
   );
 
-  auto get_action_type() const noexcept { return m_action_type; }
+  auto get_action_type() const noexcept { return static_cast<piece_action_type>(m_action_type); }
   const auto& get_from() const noexcept { return m_from; }
-  auto get_piece_type() const noexcept { return m_piece_type; }
-  auto get_color() const noexcept { return m_color; }
+  auto get_piece_type() const noexcept { return static_cast<piece_type>(m_piece_type); }
+  auto get_color() const noexcept { return static_cast<chess_color>(m_color); }
   const auto& get_to() const noexcept { return m_to; }
 
 private:
 
-  piece_action_type m_action_type;
-  chess_color m_color;
+  /// The piece_action_type
+  std::uint8_t m_action_type;
+
+  /// The chess_color, in the lower four bits
+  std::uint8_t m_color : 4;
+
+  /// The piece_type, in the upper four bits
+  std::uint8_t m_piece_type : 4;
+
   square m_from;
-  piece_type m_piece_type;
   square m_to;
 };
 
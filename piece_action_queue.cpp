@@ -0,0 +1,256 @@
+#include "piece_action_queue.h"
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <sstream>
+
+piece_action_queue::piece_action_queue(const std::vector<piece_action>& actions)
+  : m_buffer{actions},
+    m_first{0},
+    m_size{static_cast<int>(actions.size())}
+{
+
+}
+
+piece_action_queue::piece_action_queue(const piece_action_queue& other)
+  : m_buffer(std::begin(other), std::end(other)),
+    m_first{0},
+    m_size{other.m_size}
+{
+
+}
+
+piece_action_queue& piece_action_queue::operator=(const piece_action_queue& other)
+{
+  if (this == &other) return *this;
+  if (capacity() < other.m_size)
+  {
+    *this = piece_action_queue(other);
+    return *this;
+  }
+  std::copy(std::begin(other), std::end(other), std::begin(m_buffer));
+  m_first = 0;
+  m_size = other.m_size;
+  return *this;
+}
+
+const piece_action& piece_action_queue::operator[](const int i) const noexcept
+{
+  assert(i >= 0);
+  assert(i < m_size);
+  return m_buffer[(m_first + i) % capacity()];
+}
+
+void piece_action_queue::clear() noexcept
+{
+  m_first = 0;
+  m_size = 0;
+}
+
+const piece_action& piece_action_queue::front() const noexcept
+{
+  assert(!empty());
+  return m_buffer[m_first];
+}
+
+void piece_action_queue::pop_front() noexcept
+{
+  assert(!empty());
+  m_first = (m_first + 1) % capacity();
+  --m_size;
+  if (m_size == 0) m_first = 0;
+}
+
+void piece_action_queue::push_back(const piece_action& action)
+{
+  if (m_size == capacity())
+  {
+    // Move the actions in order to a buffer twice as big.
+    // The unused elements are there to be overwritten
+    std::vector<piece_action> buffer;
+    buffer.reserve(std::max(4, 2 * m_size));
+    std::copy(begin(), end(), std::back_inserter(buffer));
+    buffer.resize(buffer.capacity(), action);
+    m_buffer.swap(buffer);
+    m_first = 0;
+  }
+  m_buffer[(m_first + m_size) % capacity()] = action;
+  ++m_size;
+}
+
+void remove_first(piece_action_queue& q) noexcept
+{
+  q.pop_front();
+}
+
+void test_piece_action_queue()
+{
+#ifndef NDEBUG
+  const piece_action a(
+    chess_color::white, piece_type::queen, piece_action_type::move, "d1", "d2"
+  );
+  const piece_action b(
+    chess_color::white, piece_type::queen, piece_action_type::move, "d2", "d3"
+  );
+  const piece_action c(
+    chess_color::white, piece_type::queen, piece_action_type::move, "d3", "d4"
+  );
+  // piece_action_queue::piece_action_queue
+  {
+    const piece_action_queue q;
+    assert(q.empty());
+    assert(q.size() == 0);
+    assert(q.begin() == q.end());
+  }
+  // piece_action_queue::piece_action_queue from actions
+  {
+    const piece_action_queue q({a, b});
+    assert(q.size() == 2);
+    assert(q.front() == a);
+    assert(q[1] == b);
+  }
+  // piece_action_queue::push_back
+  {
+    piece_action_queue q;
+    q.push_back(a);
+    q.push_back(b);
+    assert(q.size() == 2);
+    assert(q.front() == a);
+    assert(q[1] == b);
+  }
+  // piece_action_queue::pop_front
+  {
+    piece_action_queue q({a, b});
+    q.pop_front();
+    assert(q.size() == 1);
+    assert(q.front() == b);
+    q.pop_front();
+    assert(q.empty());
+  }
+  // piece_action_queue::pop_front does not shift the actions
+  {
+    piece_action_queue q({a, b, c});
+    const auto* const first_c{&q[2]};
+    q.pop_front();
+    assert(&q[1] == first_c);
+  }
+  // piece_action_queue keeps the order when wrapping around
+  {
+    piece_action_queue q({a, b, c});
+    q.pop_front();
+    q.push_back(a);
+    assert(q.capacity() == 3);
+    assert(to_vector(q) == std::vector<piece_action>({b, c, a}));
+  }
+  // piece_action_queue keeps the order when growing
+  {
+    piece_action_queue q({a, b, c});
+    q.pop_front();
+    q.push_back(a);
+    q.push_back(b);
+    assert(q.capacity() > 3);
+    assert(to_vector(q) == std::vector<piece_action>({b, c, a, b}));
+  }
+  // piece_action_queue copy only holds the actions
+  {
+    piece_action_queue q({a, b, c});
+    q.pop_front();
+    q.push_back(a);
+    q.pop_front();
+    const piece_action_queue r(q);
+    assert(r == q);
+    assert(r.capacity() == 2);
+    assert(to_vector(r) == std::vector<piece_action>({c, a}));
+  }
+  // piece_action_queue copy of an empty queue has no buffer
+  {
+    piece_action_queue q({a, b});
+    q.clear();
+    const piece_action_queue r(q);
+    assert(r.empty());
+    assert(r.capacity() == 0);
+  }
+  // piece_action_queue assignment reuses a big enough buffer
+  {
+    piece_action_queue q({a, b, c});
+    const piece_action_queue r({b});
+    q = r;
+    assert(q == r);
+    assert(q.capacity() == 3);
+    const piece_action_queue bigger({a, b, c, a});
+    q = bigger;
+    assert(q == bigger);
+  }
+  // piece_action_queue::clear
+  {
+    piece_action_queue q({a, b});
+    q.clear();
+    assert(q.empty());
+    q.push_back(c);
+    assert(q.front() == c);
+  }
+  // piece_action_queue iteration, as used by a range-based for loop
+  {
+    const piece_action_queue q({a, b, c});
+    std::vector<piece_action> v;
+    for (const auto& action: q) v.push_back(action);
+    assert(v == std::vector<piece_action>({a, b, c}));
+  }
+  // remove_first
+  {
+    piece_action_queue q({a, b});
+    remove_first(q);
+    assert(q.front() == b);
+  }
+  // to_str
+  {
+    const piece_action_queue q({a, b});
+    assert(to_str(q) == to_str(std::vector<piece_action>({a, b})));
+  }
+  // operator==
+  {
+    piece_action_queue q({a, b, c});
+    q.pop_front();
+    const piece_action_queue r({b, c});
+    assert(q == r);
+    assert(!(q != r));
+    assert(q != piece_action_queue({b}));
+  }
+  // operator<<
+  {
+    const piece_action_queue q({a});
+    std::stringstream s;
+    s << q;
+    assert(!s.str().empty());
+  }
+#endif // NDEBUG
+}
+
+std::vector<piece_action> to_vector(const piece_action_queue& q)
+{
+  return std::vector<piece_action>(std::begin(q), std::end(q));
+}
+
+std::string to_str(const piece_action_queue& q) noexcept
+{
+  return to_str(to_vector(q));
+}
+
+bool operator==(const piece_action_queue& lhs, const piece_action_queue& rhs) noexcept
+{
+  return lhs.size() == rhs.size()
+    && std::equal(std::begin(lhs), std::end(lhs), std::begin(rhs))
+  ;
+}
+
+bool operator!=(const piece_action_queue& lhs, const piece_action_queue& rhs) noexcept
+{
+  return !(lhs == rhs);
+}
+
+std::ostream& operator<<(std::ostream& os, const piece_action_queue& q) noexcept
+{
+  os << to_str(q);
+  return os;
+}
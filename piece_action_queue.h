@@ -0,0 +1,128 @@
+#ifndef PIECE_ACTION_QUEUE_H
+#define PIECE_ACTION_QUEUE_H
+
+#include "piece_action.h"
+
+#include <cstddef>
+#include <iosfwd>
+#include <iterator>
+#include <string>
+#include <vector>
+
+/// The actions a piece will do, in the order these will be done.
+///
+/// A piece does its first action and removes it when done.
+/// The actions are stored in a ring buffer,
+/// so that removing the first action takes constant time,
+/// instead of shifting all the actions after it.
+/// The buffer grows when it is full.
+/// A copy only holds the actions, not the unused part of the buffer,
+/// so copying an empty queue does not allocate
+class piece_action_queue
+{
+public:
+  using value_type = piece_action;
+  using size_type = std::size_t;
+  using const_reference = const piece_action&;
+
+  /// Iterates over the actions, from first to last
+  class const_iterator
+  {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = piece_action;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const piece_action*;
+    using reference = const piece_action&;
+
+    const_iterator(const piece_action_queue& q, const int i) noexcept
+      : m_index{i}, m_queue{&q} {}
+
+    reference operator*() const noexcept { return (*m_queue)[m_index]; }
+    pointer operator->() const noexcept { return &(*m_queue)[m_index]; }
+    const_iterator& operator++() noexcept { ++m_index; return *this; }
+    const_iterator operator++(int) noexcept { auto i{*this}; ++m_index; return i; }
+
+    bool operator==(const const_iterator& rhs) const noexcept
+    {
+      return m_index == rhs.m_index && m_queue == rhs.m_queue;
+    }
+    bool operator!=(const const_iterator& rhs) const noexcept
+    {
+      return !(*this == rhs);
+    }
+
+  private:
+    /// The index of the action, where zero is the first action
+    int m_index;
+
+    const piece_action_queue* m_queue;
+  };
+
+  explicit piece_action_queue(const std::vector<piece_action>& actions = {});
+
+  /// Copy the actions only
+  piece_action_queue(const piece_action_queue& other);
+  piece_action_queue(piece_action_queue&& other) noexcept = default;
+
+  /// Copy the actions only, reusing the buffer if it is big enough
+  piece_action_queue& operator=(const piece_action_queue& other);
+  piece_action_queue& operator=(piece_action_queue&& other) noexcept = default;
+
+  /// Get the action at an index, where zero is the first action
+  const piece_action& operator[](const int i) const noexcept;
+
+  const_iterator begin() const noexcept { return const_iterator(*this, 0); }
+
+  /// Get the number of actions that can be held without growing
+  int capacity() const noexcept { return static_cast<int>(m_buffer.size()); }
+
+  /// Remove all actions
+  void clear() noexcept;
+
+  bool empty() const noexcept { return m_size == 0; }
+
+  const_iterator end() const noexcept { return const_iterator(*this, m_size); }
+
+  /// Get the first action
+  const piece_action& front() const noexcept;
+
+  /// Remove the first action
+  void pop_front() noexcept;
+
+  /// Add an action after the last one
+  void push_back(const piece_action& action);
+
+  std::size_t size() const noexcept { return m_size; }
+
+private:
+
+  /// The ring buffer, of which 'm_size' elements,
+  /// starting at 'm_first', are the actions
+  std::vector<piece_action> m_buffer;
+
+  /// The index in 'm_buffer' of the first action
+  int m_first;
+
+  /// The number of actions
+  int m_size;
+};
+
+/// Remove the first action
+void remove_first(piece_action_queue& q) noexcept;
+
+/// Test this class and its free functions
+void test_piece_action_queue();
+
+/// Convert to the actions, from first to last
+std::vector<piece_action> to_vector(const piece_action_queue& q);
+
+/// Convert to string, one line per action, no newline at the end
+std::string to_str(const piece_action_queue& q) noexcept;
+
+bool operator==(const piece_action_queue& lhs, const piece_action_queue& rhs) noexcept;
+bool operator!=(const piece_action_queue& lhs, const piece_action_queue& rhs) noexcept;
+
+std::ostream& operator<<(std::ostream& os, const piece_action_queue& q) noexcept;
+
+#endif // PIECE_ACTION_QUEUE_H
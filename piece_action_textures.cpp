@@ -11,6 +11,7 @@
 
 piece_action_textures::piece_action_textures()
 {
+  std::vector<const sf::Texture *> all_textures;
   for (const auto r: get_all_piece_action_types())
   {
     const std::string filename_str{get_filename(r)};
@@ -22,6 +23,15 @@ piece_action_textures::piece_action_textures()
       QString msg{"Cannot find image file '" + filename + "'"};
       throw std::runtime_error(msg.toStdString());
     }
+    all_textures.push_back(&m_textures[r]);
+  }
+  // The icons are about 128 pixels already
+  m_atlas.emplace(all_textures, 128);
+  int index{0};
+  for (const auto r: get_all_piece_action_types())
+  {
+    m_rects[r] = m_atlas->get_rect(index);
+    ++index;
   }
 }
 
@@ -34,6 +44,13 @@ std::string piece_action_textures::get_filename(
   return s.str();
 }
 
+const sf::FloatRect& piece_action_textures::get_rect(
+  const piece_action_type t
+) const
+{
+  return m_rects.at(t);
+}
+
 sf::Texture& piece_action_textures::get_texture(
   const piece_action_type t
 ) noexcept
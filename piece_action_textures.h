@@ -5,6 +5,9 @@
 
 #include <SFML/Graphics.hpp>
 #include "piece_action_type.h"
+#include "texture_atlas.h"
+
+#include <optional>
 
 /// The games' icon_textures
 /// The raw game resources
@@ -24,6 +27,12 @@ public:
     ;
   }
 
+  /// Get the atlas with all icons
+  const texture_atlas& get_atlas() const noexcept { return *m_atlas; }
+
+  /// Get the part of the atlas with an icon
+  const sf::FloatRect& get_rect(const piece_action_type t) const;
+
   /// Get an icon that accompanies a game option,
   /// to be used in the Options screen
   sf::Texture& get_texture(
@@ -32,6 +41,12 @@ public:
 
 private:
 
+  /// All textures in one, created after these have been loaded
+  std::optional<texture_atlas> m_atlas;
+
+  /// The part of the atlas of each texture
+  std::map<piece_action_type, sf::FloatRect> m_rects;
+
   std::map<piece_action_type, sf::Texture> m_textures;
 };
 
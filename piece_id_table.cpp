@@ -0,0 +1,121 @@
+#include "piece_id_table.h"
+
+#include "piece.h"
+#include "pieces.h"
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <sstream>
+
+piece_id_table::piece_id_table()
+  : m_first_id{0}
+{
+
+}
+
+piece_id_table::piece_id_table(const std::vector<piece>& pieces)
+  : piece_id_table()
+{
+  if (pieces.empty()) return;
+  const auto [lowest, highest]{
+    std::minmax_element(
+      std::begin(pieces),
+      std::end(pieces),
+      [](const piece& lhs, const piece& rhs)
+      {
+        return lhs.get_id().get() < rhs.get_id().get();
+      }
+    )
+  };
+  m_first_id = lowest->get_id().get();
+  m_indices.resize(highest->get_id().get() - m_first_id + 1, no_piece);
+  const int n_pieces{static_cast<int>(pieces.size())};
+  for (int i{0}; i != n_pieces; ++i)
+  {
+    int& index{m_indices[pieces[i].get_id().get() - m_first_id]};
+    assert(index == no_piece); // IDs are unique
+    index = i;
+  }
+}
+
+int piece_id_table::get_index(const id& i) const noexcept
+{
+  const int j{i.get() - m_first_id};
+  if (j < 0 || j >= static_cast<int>(m_indices.size())) return no_piece;
+  return m_indices[j];
+}
+
+bool piece_id_table::has_id(const id& i) const noexcept
+{
+  return get_index(i) != no_piece;
+}
+
+void test_piece_id_table()
+{
+#ifndef NDEBUG
+  // piece_id_table::piece_id_table
+  {
+    const piece_id_table t;
+    assert(!t.has_id(create_new_id()));
+    assert(t.get_indices().empty());
+  }
+  // piece_id_table::piece_id_table from pieces
+  {
+    const auto pieces{get_standard_starting_pieces()};
+    const piece_id_table t(pieces);
+    const int n_pieces{static_cast<int>(pieces.size())};
+    for (int i{0}; i != n_pieces; ++i)
+    {
+      assert(t.has_id(pieces[i].get_id()));
+      assert(t.get_index(pieces[i].get_id()) == i);
+    }
+  }
+  // piece_id_table::get_index of an unknown ID
+  {
+    const piece_id_table t(get_standard_starting_pieces());
+    const id i{create_new_id()};
+    assert(!t.has_id(i));
+    assert(t.get_index(i) == piece_id_table::no_piece);
+  }
+  // operator==
+  {
+    const auto pieces{get_standard_starting_pieces()};
+    const piece_id_table a(pieces);
+    const piece_id_table b(pieces);
+    const piece_id_table c;
+    assert(a == b);
+    assert(a != c);
+  }
+  // operator<<
+  {
+    const piece_id_table t(get_standard_starting_pieces());
+    std::stringstream s;
+    s << t;
+    assert(!s.str().empty());
+  }
+#endif // NDEBUG
+}
+
+bool operator==(const piece_id_table& lhs, const piece_id_table& rhs) noexcept
+{
+  return lhs.get_first_id() == rhs.get_first_id()
+    && lhs.get_indices() == rhs.get_indices()
+  ;
+}
+
+bool operator!=(const piece_id_table& lhs, const piece_id_table& rhs) noexcept
+{
+  return !(lhs == rhs);
+}
+
+std::ostream& operator<<(std::ostream& os, const piece_id_table& t) noexcept
+{
+  const int n{static_cast<int>(t.get_indices().size())};
+  for (int i{0}; i != n; ++i)
+  {
+    if (t.get_indices()[i] == piece_id_table::no_piece) continue;
+    os << (t.get_first_id() + i) << ": " << t.get_indices()[i] << '\n';
+  }
+  return os;
+}
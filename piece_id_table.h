@@ -0,0 +1,60 @@
+#ifndef PIECE_ID_TABLE_H
+#define PIECE_ID_TABLE_H
+
+#include "ccfwd.h"
+
+#include <iosfwd>
+#include <vector>
+
+/// For each piece ID, the index of the piece
+/// (in the std::vector<piece> of a \link{game}),
+/// so that a piece can be found by its ID in constant time.
+///
+/// As the IDs of the pieces of a game are created together,
+/// these are close to each other, and the table stores
+/// one index per ID, from the lowest to the highest ID.
+///
+/// The table is shared between the copies of a \link{game},
+/// which rebuilds it in \link{game::tick} when pieces are removed
+class piece_id_table
+{
+public:
+  /// A table without pieces
+  piece_id_table();
+
+  /// Create a table from the pieces
+  explicit piece_id_table(const std::vector<piece>& pieces);
+
+  /// Get the lowest ID in the table
+  int get_first_id() const noexcept { return m_first_id; }
+
+  /// Get the index of the piece with an ID,
+  /// or \link{piece_id_table::no_piece} if there is no such piece
+  int get_index(const id& i) const noexcept;
+
+  const auto& get_indices() const noexcept { return m_indices; }
+
+  /// Is there a piece with the ID?
+  bool has_id(const id& i) const noexcept;
+
+  /// The value of an ID without a piece
+  static constexpr int no_piece{-1};
+
+private:
+
+  /// The lowest ID, i.e. the ID of the piece at 'm_indices[0]'
+  int m_first_id;
+
+  /// For each ID, starting at 'm_first_id', the index of the piece
+  std::vector<int> m_indices;
+};
+
+/// Test this class and its free functions
+void test_piece_id_table();
+
+bool operator==(const piece_id_table& lhs, const piece_id_table& rhs) noexcept;
+bool operator!=(const piece_id_table& lhs, const piece_id_table& rhs) noexcept;
+
+std::ostream& operator<<(std::ostream& os, const piece_id_table& t) noexcept;
+
+#endif // PIECE_ID_TABLE_H
@@ -7,6 +7,9 @@
 #include "chess_color.h"
 #include "piece_type.h"
 #include "race.h"
+#include "texture_atlas.h"
+
+#include <optional>
 
 /// The games' piece_portrait_textures
 /// The raw game resources
@@ -28,6 +31,9 @@ public:
     ;
   }
 
+  /// Get the atlas with the portraits of all pieces
+  const texture_atlas& get_atlas() const noexcept { return *m_atlas; }
+
   /// Get texture of a piece
   sf::Texture& get_portrait(
     const race race,
@@ -35,8 +41,30 @@ public:
     const piece_type type
   );
 
+  /// Get the part of the atlas with the portrait of a piece
+  const sf::FloatRect& get_rect(
+    const race race,
+    const chess_color color,
+    const piece_type type
+  ) const;
+
 private:
 
+  /// All textures in one, created after these have been loaded
+  std::optional<texture_atlas> m_atlas;
+
+  /// The part of the atlas of each texture
+  std::map<
+    race,
+    std::map<
+      chess_color,
+      std::map<
+        piece_type,
+        sf::FloatRect
+      >
+    >
+  > m_rects;
+
   std::map<
     race,
     std::map<
@@ -11,6 +11,7 @@
 
 piece_textures::piece_textures()
 {
+  std::vector<const sf::Texture *> all_textures;
   for (const auto r: get_all_races())
   {
     for (const auto c: get_all_chess_colors())
@@ -26,6 +27,21 @@ piece_textures::piece_textures()
           QString msg{"Cannot find image file '" + filename + "'"};
           throw std::runtime_error(msg.toStdString());
         }
+        all_textures.push_back(&m_textures[r][c][p]);
+      }
+    }
+  }
+  // A piece is drawn at about a square's size, so 256 pixels suffices
+  m_atlas.emplace(all_textures, 256);
+  int index{0};
+  for (const auto r: get_all_races())
+  {
+    for (const auto c: get_all_chess_colors())
+    {
+      for (const auto p: get_all_piece_types())
+      {
+        m_rects[r][c][p] = m_atlas->get_rect(index);
+        ++index;
       }
     }
   }
@@ -59,4 +75,13 @@ sf::Texture& piece_textures::get_piece(
   return m_textures[race][color][type];
 }
 
+const sf::FloatRect& piece_textures::get_rect(
+  const race race,
+  const chess_color color,
+  const piece_type type
+) const
+{
+  return m_rects.at(race).at(color).at(type);
+}
+
 #endif // LOGIC_ONLY
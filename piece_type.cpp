@@ -4,6 +4,22 @@
 #include <iostream>
 #include <sstream>
 
+double get_material_value(const piece_type type) noexcept
+{
+  switch (type)
+  {
+    case piece_type::bishop: return 3.0;
+    case piece_type::king: return 100.0;
+    case piece_type::knight: return 3.0;
+    case piece_type::pawn: return 1.0;
+    case piece_type::queen: return 9.0;
+    default:
+    case piece_type::rook:
+      assert(type == piece_type::rook);
+      return 5.0;
+  }
+}
+
 double get_max_health(const piece_type type)
 {
   switch (type)
@@ -52,6 +68,12 @@ void test_piece_type()
       assert(!to_str(t).empty());
     }
   }
+  // get_material_value
+  {
+    assert(get_material_value(piece_type::pawn) == 1.0);
+    assert(get_material_value(piece_type::queen) == 9.0);
+    assert(get_material_value(piece_type::king) > 8.0 * 1.0 + 2.0 * (3.0 + 3.0 + 5.0) + 9.0);
+  }
   // get_max_health
   {
     assert(get_max_health(piece_type::king) > 0.0);
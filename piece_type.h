@@ -17,6 +17,11 @@ enum class piece_type
 /// Get all the piece types
 std::vector<piece_type> get_all_piece_types() noexcept;
 
+/// Get the material value of a piece,
+/// using the classic values, e.g. 1 for a pawn and 9 for a queen.
+/// A king is worth more than all other pieces together
+double get_material_value(const piece_type type) noexcept;
+
 /// Get the maximum health for a piece
 double get_max_health(const piece_type type);
 
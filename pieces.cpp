@@ -1,5 +1,7 @@
 #include "pieces.h"
 
+#include "bitboard.h"
+
 #include <algorithm>
 #include <cassert>
 #include <numeric>
@@ -177,6 +179,43 @@ std::vector<piece> get_kings_only_starting_pieces(
   return pieces;
 }
 
+bitboard get_occupied_bitboard(const std::vector<piece>& pieces) noexcept
+{
+  bitboard b{0};
+  for (const auto& p: pieces) b |= to_bitboard(p.get_current_square());
+  return b;
+}
+
+bitboard get_occupied_bitboard(
+  const std::vector<piece>& pieces,
+  const chess_color color
+) noexcept
+{
+  bitboard b{0};
+  for (const auto& p: pieces)
+  {
+    if (p.get_color() == color) b |= to_bitboard(p.get_current_square());
+  }
+  return b;
+}
+
+bitboard get_occupied_bitboard(
+  const std::vector<piece>& pieces,
+  const chess_color color,
+  const piece_type type
+) noexcept
+{
+  bitboard b{0};
+  for (const auto& p: pieces)
+  {
+    if (p.get_color() == color && p.get_type() == type)
+    {
+      b |= to_bitboard(p.get_current_square());
+    }
+  }
+  return b;
+}
+
 std::vector<square> get_occupied_squares(const std::vector<piece>& pieces) noexcept
 {
   std::vector<square> squares;
@@ -228,7 +267,7 @@ piece& get_piece_at(
   return *there;
 }
 
-piece get_piece_with_id(
+const piece& get_piece_with_id(
   const std::vector<piece>& pieces,
   const id& i
 )
@@ -255,34 +294,11 @@ std::vector<square> get_possible_bishop_moves(
   assert(!pieces.empty());
   assert(has_piece_with_id(pieces, focal_piece.get_id()));
   assert(focal_piece.get_type() == piece_type::bishop);
-  const int x{focal_piece.get_current_square().get_x()};
-  const int y{focal_piece.get_current_square().get_y()};
-
-  std::vector<square> moves;
-  std::vector<std::pair<int, int>> delta_pairs{
-    std::make_pair( 1, -1), // NE
-    std::make_pair( 1,  1), // SE
-    std::make_pair(-1,  1), // SW
-    std::make_pair(-1, -1)  // NW
-  };
-  for (const auto& delta_pair: delta_pairs)
-  {
-    for (int distance{1}; distance != 8; ++distance)
-    {
-      const int new_x{x + (delta_pair.first * distance)};
-      const int new_y{y + (delta_pair.second * distance)};
-      if (!is_valid_square_xy(new_x, new_y)) break;
-      const square there(new_x, new_y);
-      if (is_piece_at(pieces, there)
-        && get_piece_at(pieces, there).get_color() == focal_piece.get_color()
-      )
-      {
-        break;
-      }
-      moves.push_back(there);
-    }
-  }
-  return moves;
+  // Only pieces of own color block a path
+  const bitboard own{get_occupied_bitboard(pieces, focal_piece.get_color())};
+  return to_squares(
+    get_bishop_attacks(focal_piece.get_current_square(), own) & ~own
+  );
 }
 
 std::vector<square> get_possible_king_moves(
@@ -293,33 +309,10 @@ std::vector<square> get_possible_king_moves(
   assert(!pieces.empty());
   assert(has_piece_with_id(pieces, focal_piece.get_id()));
   assert(focal_piece.get_type() == piece_type::king);
-  const int x{focal_piece.get_current_square().get_x()};
-  const int y{focal_piece.get_current_square().get_y()};
-  const auto enemy_color{get_other_color(focal_piece.get_color())};
-  std::vector<std::pair<int, int>> xys{
-    std::make_pair(x + 0, y - 1),
-    std::make_pair(x + 1, y - 1),
-    std::make_pair(x + 1, y - 0),
-    std::make_pair(x + 1, y + 1),
-    std::make_pair(x - 0, y + 1),
-    std::make_pair(x - 1, y + 1),
-    std::make_pair(x - 1, y + 0),
-    std::make_pair(x - 1, y - 1)
-  };
-  const auto squares_on_board{to_squares(xys)};
-  std::vector<square> squares;
-  std::copy_if(
-    std::begin(squares_on_board),
-    std::end(squares_on_board),
-    std::back_inserter(squares),
-    [pieces, enemy_color](const auto& square)
-    {
-      return !is_piece_at(pieces, square)
-        || get_piece_at(pieces, square).get_color() == enemy_color
-      ;
-    }
+  const bitboard own{get_occupied_bitboard(pieces, focal_piece.get_color())};
+  return to_squares(
+    get_king_attacks(focal_piece.get_current_square()) & ~own
   );
-  return squares;
 }
 
 std::vector<square> get_possible_knight_moves(
@@ -330,37 +323,11 @@ std::vector<square> get_possible_knight_moves(
   assert(!pieces.empty());
   assert(has_piece_with_id(pieces, focal_piece.get_id()));
   assert(focal_piece.get_type() == piece_type::knight);
-  const int x{focal_piece.get_current_square().get_x()};
-  const int y{focal_piece.get_current_square().get_y()};
-  std::vector<square> moves;
-  std::vector<std::pair<int, int>> delta_pairs{
-    std::make_pair( 1, -2), // 1 o'clock
-    std::make_pair( 2, -1), // 2 o'clock
-    std::make_pair( 2,  1), // 4 o'clock
-    std::make_pair( 1,  2), // 5 o'clock
-    std::make_pair(-1,  2), // 7 o'clock
-    std::make_pair(-2,  1), // 8 o'clock
-    std::make_pair(-2, -1), // 10 o'clock
-    std::make_pair(-1, -2)  // 11 o'clock
-  };
-  for (const auto& delta_pair: delta_pairs)
-  {
-    for (int distance{1}; distance != 4; ++distance)
-    {
-      const int new_x{x + (delta_pair.first * distance)};
-      const int new_y{y + (delta_pair.second * distance)};
-      if (!is_valid_square_xy(new_x, new_y)) break;
-      const square there(new_x, new_y);
-      if (is_piece_at(pieces, there)
-        && get_piece_at(pieces, there).get_color() == focal_piece.get_color()
-      )
-      {
-        break;
-      }
-      moves.push_back(there);
-    }
-  }
-  return moves;
+  // Only pieces of own color block a path
+  const bitboard own{get_occupied_bitboard(pieces, focal_piece.get_color())};
+  return to_squares(
+    get_knight_ray_attacks(focal_piece.get_current_square(), own) & ~own
+  );
 }
 
 std::vector<square> get_possible_moves(
@@ -392,49 +359,20 @@ std::vector<square> get_possible_pawn_moves(
   assert(!pieces.empty());
   assert(has_piece_with_id(pieces, focal_piece.get_id()));
   assert(focal_piece.get_type() == piece_type::pawn);
-  const int x{focal_piece.get_current_square().get_x()};
-  const int y{focal_piece.get_current_square().get_y()};
+  const auto& s{focal_piece.get_current_square()};
+  const auto color{focal_piece.get_color()};
 
   // Can attack to where?
-  const int dx{focal_piece.get_color() == chess_color::white ? 1 : -1};
-  const std::vector<std::pair<int, int>> attack_xys{
-    std::make_pair(x + dx, y - 1),
-    std::make_pair(x + dx, y + 1)
+  const bitboard enemies{
+    get_occupied_bitboard(pieces, get_other_color(color))
   };
-  const auto attack_squares{to_squares(attack_xys)};
-  std::vector<square> valid_attack_squares;
-  std::copy_if(
-    std::begin(attack_squares),
-    std::end(attack_squares),
-    std::back_inserter(valid_attack_squares),
-    [pieces, focal_piece](const auto& square)
-    {
-      return is_piece_at(pieces, square)
-        && get_piece_at(pieces, square).get_color() != focal_piece.get_color();
-    }
-  );
+  const bitboard attacks{get_pawn_attacks(s, color) & enemies};
 
-  // Move forward
-  const std::vector<std::pair<int, int>> move_xys{
-    std::make_pair(x + (1 * dx), y),
-    std::make_pair(x + (2 * dx), y),
-    std::make_pair(x + (3 * dx), y),
-    std::make_pair(x + (4 * dx), y),
-    std::make_pair(x + (5 * dx), y),
-    std::make_pair(x + (6 * dx), y),
-    std::make_pair(x + (7 * dx), y)
+  // Move forward until a piece
+  const bitboard moves{
+    get_pawn_pushes(s, color, get_occupied_bitboard(pieces))
   };
-  const auto move_squares{to_squares(move_xys)};
-  std::vector<square> valid_move_squares;
-  for (const auto s: move_squares)
-  {
-    // Move until a piece
-    if (is_piece_at(pieces, s)) break;
-    valid_move_squares.push_back(s) ;
-  }
-
-  // Concatenate the vectors
-  return concatenate(valid_attack_squares, valid_move_squares);
+  return concatenate(to_squares(attacks), to_squares(moves));
 }
 
 std::vector<square> get_possible_queen_moves(
@@ -445,39 +383,11 @@ std::vector<square> get_possible_queen_moves(
   assert(!pieces.empty());
   assert(has_piece_with_id(pieces, focal_piece.get_id()));
   assert(focal_piece.get_type() == piece_type::queen);
-  const int x{focal_piece.get_current_square().get_x()};
-  const int y{focal_piece.get_current_square().get_y()};
-
-  std::vector<square> moves;
-  std::vector<std::pair<int, int>> delta_pairs{
-    std::make_pair( 0, -1), // N
-    std::make_pair( 1, -1), // NE
-    std::make_pair( 1,  0), // E
-    std::make_pair( 1,  1), // SE
-    std::make_pair( 0,  1), // S
-    std::make_pair(-1,  1), // SW
-    std::make_pair(-1,  0), // W
-    std::make_pair(-1, -1)  // SE
-  };
-  for (const auto& delta_pair: delta_pairs)
-  {
-    for (int distance{1}; distance != 8; ++distance)
-    {
-      const int new_x{x + (delta_pair.first * distance)};
-      const int new_y{y + (delta_pair.second * distance)};
-      if (!is_valid_square_xy(new_x, new_y)) break;
-      const square there(new_x, new_y);
-      if (is_piece_at(pieces, there)
-        && get_piece_at(pieces, there).get_color() == focal_piece.get_color()
-      )
-      {
-        break;
-      }
-      moves.push_back(there);
-    }
-  }
-  return moves;
-
+  // Only pieces of own color block a path
+  const bitboard own{get_occupied_bitboard(pieces, focal_piece.get_color())};
+  return to_squares(
+    get_queen_attacks(focal_piece.get_current_square(), own) & ~own
+  );
 }
 
 std::vector<square> get_possible_rook_moves(
@@ -488,34 +398,11 @@ std::vector<square> get_possible_rook_moves(
   assert(!pieces.empty());
   assert(has_piece_with_id(pieces, focal_piece.get_id()));
   assert(focal_piece.get_type() == piece_type::rook);
-  const int x{focal_piece.get_current_square().get_x()};
-  const int y{focal_piece.get_current_square().get_y()};
-
-  std::vector<square> moves;
-  std::vector<std::pair<int, int>> delta_pairs{
-    std::make_pair( 0, -1), // N
-    std::make_pair( 1,  0), // E
-    std::make_pair( 0,  1), // S
-    std::make_pair(-1,  0)  // W
-  };
-  for (const auto& delta_pair: delta_pairs)
-  {
-    for (int distance{1}; distance != 8; ++distance)
-    {
-      const int new_x{x + (delta_pair.first * distance)};
-      const int new_y{y + (delta_pair.second * distance)};
-      if (!is_valid_square_xy(new_x, new_y)) break;
-      const square there(new_x, new_y);
-      if (is_piece_at(pieces, there)
-        && get_piece_at(pieces, there).get_color() == focal_piece.get_color()
-      )
-      {
-        break;
-      }
-      moves.push_back(there);
-    }
-  }
-  return moves;
+  // Only pieces of own color block a path
+  const bitboard own{get_occupied_bitboard(pieces, focal_piece.get_color())};
+  return to_squares(
+    get_rook_attacks(focal_piece.get_current_square(), own) & ~own
+  );
 }
 
 
@@ -952,6 +839,16 @@ void test_pieces()
       assert(count_dead_pieces(pieces) == 1);
     }
   }
+  // get_occupied_bitboard
+  {
+    const auto pieces{get_standard_starting_pieces()};
+    assert(count_squares(get_occupied_bitboard(pieces)) == 32);
+    assert(count_squares(get_occupied_bitboard(pieces, chess_color::white)) == 16);
+    const bitboard black_knights{
+      get_occupied_bitboard(pieces, chess_color::black, piece_type::knight)
+    };
+    assert(black_knights == to_bitboard({square("b8"), square("g8")}));
+  }
   // get_piece_at, const
   {
     const auto pieces{get_standard_starting_pieces()};
@@ -2,6 +2,7 @@
 #define PIECES_H
 
 /// Functions to work on collections of pieces
+#include "bitboard.h"
 #include "board_to_text_options.h"
 #include "piece.h"
 
@@ -87,6 +88,23 @@ std::vector<piece> get_kings_only_starting_pieces(
   const race black_race = race::classic
 ) noexcept;
 
+/// Get all the squares that are occupied, as a bitboard
+bitboard get_occupied_bitboard(const std::vector<piece>& pieces) noexcept;
+
+/// Get all the squares that are occupied by pieces of a color, as a bitboard
+bitboard get_occupied_bitboard(
+  const std::vector<piece>& pieces,
+  const chess_color color
+) noexcept;
+
+/// Get all the squares that are occupied by pieces
+/// of a color and type, as a bitboard
+bitboard get_occupied_bitboard(
+  const std::vector<piece>& pieces,
+  const chess_color color,
+  const piece_type type
+) noexcept;
+
 /// Get all the squares that are occupied
 std::vector<square> get_occupied_squares(const std::vector<piece>& pieces) noexcept;
 
@@ -104,9 +122,12 @@ piece& get_piece_at(
   const square& coordinat
 );
 
-/// Find a piece with a certain ID
-/// Will throw if there is no piece with that ID
-piece get_piece_with_id(
+/// Find a piece with a certain ID,
+/// by searching all pieces.
+/// There must be a piece with that ID.
+/// Use \link{get_piece_with_id(const game&, const id&)}
+/// to find a piece in a game in constant time
+const piece& get_piece_with_id(
   const std::vector<piece>& pieces,
   const id& i
 );
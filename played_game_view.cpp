@@ -4,8 +4,10 @@
 
 #include "screen_coordinat.h"
 
+#include "input_recording.h"
 #include "pieces.h"
 #include "sfml_helper.h"
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <iostream>
@@ -13,7 +15,20 @@
 #include <sstream>
 
 played_game_view::played_game_view(const game& g)
-  : m_game{g}
+  : m_is_paused{true},
+    m_game{g},
+    m_playback_time{0.0},
+    m_speed{1}
+{
+
+}
+
+played_game_view::played_game_view(const input_recording& r)
+  : m_is_paused{false},
+    m_game{r.get_game_options(), r.get_lobby_options()},
+    m_playback_time{0.0},
+    m_replay(keyframed_replay(r)),
+    m_speed{1}
 {
 
 }
@@ -38,12 +53,15 @@ void played_game_view::exec()
     )
   );
 
+  m_frame_clock.restart();
   while (m_window.isOpen())
   {
     // Process user input and play game until instructed to exit
     const bool must_quit{process_events()};
     if (must_quit) return;
 
+    tick();
+
     show();
 
   }
@@ -85,11 +103,66 @@ bool played_game_view::process_events()
         file << to_pgn(m_game) << '\n';
         m_resources.get_sound_effects().play(message(message_type::done, chess_color::white, piece_type::king));
       }
+      else if (m_replay && key_pressed == sf::Keyboard::Key::Space)
+      {
+        m_is_paused = !m_is_paused;
+      }
+      else if (m_replay && key_pressed == sf::Keyboard::Key::Up)
+      {
+        m_speed = std::min(64, m_speed * 2);
+      }
+      else if (m_replay && key_pressed == sf::Keyboard::Key::Down)
+      {
+        m_speed = std::max(1, m_speed / 2);
+      }
+      else if (m_replay && key_pressed == sf::Keyboard::Key::Right)
+      {
+        m_is_paused = true;
+        seek(std::min(m_replay->get_tick() + 1, get_n_ticks(*m_replay)));
+      }
+      else if (m_replay && key_pressed == sf::Keyboard::Key::Left)
+      {
+        m_is_paused = true;
+        seek(std::max(m_replay->get_tick() - 1, 0));
+      }
+      else if (m_replay && key_pressed == sf::Keyboard::Key::Home)
+      {
+        seek(0);
+      }
+      else if (m_replay && key_pressed == sf::Keyboard::Key::End)
+      {
+        seek(get_n_ticks(*m_replay));
+      }
+    }
+    else if (m_replay
+      && (event.type == sf::Event::MouseButtonPressed || event.type == sf::Event::MouseMoved)
+      && sf::Mouse::isButtonPressed(sf::Mouse::Left)
+    )
+    {
+      // Scrub through the match by dragging over the seek bar
+      const auto& bar{m_layout.get_seek_bar()};
+      const int x{event.type == sf::Event::MouseButtonPressed ? event.mouseButton.x : event.mouseMove.x};
+      const int y{event.type == sf::Event::MouseButtonPressed ? event.mouseButton.y : event.mouseMove.y};
+      if (y >= bar.get_tl().get_y() && y <= bar.get_br().get_y())
+      {
+        const double f{
+          static_cast<double>(x - bar.get_tl().get_x()) / static_cast<double>(get_width(bar))
+        };
+        seek(get_tick_at_fraction(*m_replay, f));
+      }
     }
   }
   return false; // Do not close the window :-)
 }
 
+void played_game_view::seek(const int tick)
+{
+  assert(m_replay);
+  m_replay->seek(tick);
+  m_game = m_replay->get_game();
+  m_playback_time = m_game.get_time();
+}
+
 void played_game_view::set_text_style(sf::Text& text)
 {
   text.setFont(get_code_squared_font(get_resources()));
@@ -107,11 +180,49 @@ void played_game_view::show()
 
   show_text_panel(*this);
 
+  show_seek_bar(*this);
+
   // Display all shapes
   m_window.display();
 
 }
 
+void show_seek_bar(played_game_view& v)
+{
+  if (!v.get_replay()) return;
+  const auto& r{*v.get_replay()};
+  const auto& bar{v.get_layout().get_seek_bar()};
+  const int n_ticks{get_n_ticks(r)};
+  const double f{n_ticks == 0 ? 1.0 : static_cast<double>(r.get_tick()) / static_cast<double>(n_ticks)};
+  const screen_rect played(
+    bar.get_tl(),
+    screen_coordinat(
+      bar.get_tl().get_x() + static_cast<int>(f * get_width(bar)),
+      bar.get_br().get_y()
+    )
+  );
+  sf::RectangleShape rectangle;
+  set_rect(rectangle, played);
+  rectangle.setFillColor(sf::Color(128, 128, 128));
+  v.get_window().draw(rectangle);
+}
+
+void played_game_view::tick()
+{
+  const double secs{m_frame_clock.restart().asSeconds()};
+  if (!m_replay || m_is_paused) return;
+  // One delta_t equals one second under normal game speed
+  m_playback_time += delta_t(secs * m_speed);
+  const int n_ticks{get_n_ticks(*m_replay)};
+  int tick{m_replay->get_tick()};
+  while (tick < n_ticks && m_replay->get_game().get_time() < m_playback_time)
+  {
+    m_replay->seek(++tick);
+  }
+  m_game = m_replay->get_game();
+  if (tick == n_ticks) m_is_paused = true;
+}
+
 void show_layout_panels(played_game_view& v)
 {
   for (const auto& screen_rect: get_panels(v.get_layout()))
@@ -128,6 +239,14 @@ void show_text_panel(played_game_view& v)
   const auto& g{v.get_game()};
   const auto screen_rect{v.get_layout().get_text()};
   std::stringstream s;
+  if (const auto& r{v.get_replay()})
+  {
+    s
+      << "Tick " << r->get_tick() << "/" << get_n_ticks(*r)
+      << ", " << v.get_speed() << "x"
+      << (v.is_paused() ? ", paused" : "") << '\n'
+    ;
+  }
   s << to_pgn(g);
   if (s.str().empty()) s << "[none]";
   sf::Text text;
@@ -7,13 +7,30 @@
 #include "game_resources.h"
 #include "played_game_view_layout.h"
 #include "game.h"
-
-/// View a played Conquer Chess game
+#include "keyframed_replay.h"
+
+#include <optional>
+
+/// View a played Conquer Chess game.
+///
+/// When viewing an \link{input_recording}, the match can be played
+/// and searched through:
+///
+/// Input           | Effect
+/// ----------------|--------------------------------
+/// Space           | pause or continue
+/// Up, Down        | play twice as fast or slow, from 1x to 64x
+/// Right, Left     | pause and go one tick forward or back
+/// Home, End       | go to the start or end
+/// LMB on the bar  | go to that point in the match
 class played_game_view
 {
 public:
   played_game_view(const game& g);
 
+  /// View a recorded match, from the start
+  explicit played_game_view(const input_recording& r);
+
   /// Run the menu, until the user quits
   void exec();
 
@@ -21,21 +38,45 @@ public:
 
   const auto& get_layout() const noexcept { return m_layout; }
 
+  /// Get the recorded match being played, if any
+  const auto& get_replay() const noexcept { return m_replay; }
+
+  /// Get how many times faster than real-time the recorded match is played
+  int get_speed() const noexcept { return m_speed; }
+
   auto& get_resources() noexcept { return m_resources; }
 
   auto& get_window() noexcept { return m_window; }
 
+  /// Is playing the recorded match paused?
+  bool is_paused() const noexcept { return m_is_paused; }
+
   /// Set the text to a uniform style
   void set_text_style(sf::Text& t);
 
 private:
 
+  /// Measures the duration of a frame
+  sf::Clock m_frame_clock;
+
+  /// Is playing the recorded match paused?
+  bool m_is_paused;
+
   /// The layout of this window
   played_game_view_layout m_layout;
 
   /// The played game
   game m_game;
 
+  /// The game time the recorded match should be at
+  delta_t m_playback_time;
+
+  /// The recorded match, if any
+  std::optional<keyframed_replay> m_replay;
+
+  /// How many times faster than real-time the recorded match is played
+  int m_speed;
+
   /// The window to draw to
   sf::RenderWindow m_window;
 
@@ -46,6 +87,12 @@ private:
   /// @return if the user wants to quit
   bool process_events();
 
+  /// Go to a tick in the recorded match
+  void seek(const int tick);
+
+  /// Play the recorded match for the duration of a frame
+  void tick();
+
   /// Show the menu on-screen
   void show();
 };
@@ -53,6 +100,9 @@ private:
 /// Show where the panels will be drawn
 void show_layout_panels(played_game_view& v);
 
+/// Show where in the recorded match the view is, if there is one
+void show_seek_bar(played_game_view& v);
+
 /// Show where the panels will be drawn
 void show_text_panel(played_game_view& v);
 
@@ -1,5 +1,6 @@
 #include "played_game_view_layout.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 
@@ -14,13 +15,20 @@ played_game_view_layout::played_game_view_layout(
   const int x1{margin_width};
   const int x2{x1 + panel_width};
 
+  const int seek_bar_height{std::max(8, panel_height / 20)};
   const int y1{margin_width};
-  const int y2{y1 + panel_height};
+  const int y4{y1 + panel_height};
+  const int y3{y4 - seek_bar_height};
+  const int y2{y3 - margin_width};
 
   m_text = screen_rect(
     screen_coordinat(x1, y1),
     screen_coordinat(x2, y2)
   );
+  m_seek_bar = screen_rect(
+    screen_coordinat(x1, y3),
+    screen_coordinat(x2, y4)
+  );
   m_font_size = std::min(
     panel_height / 10,
     panel_width / 35
@@ -31,7 +39,8 @@ std::vector<screen_rect> get_panels(const played_game_view_layout& layout)
 {
   return
   {
-    layout.get_text()
+    layout.get_text(),
+    layout.get_seek_bar()
   };
 }
 
@@ -43,5 +52,11 @@ void test_played_game_view_layout()
     const played_game_view_layout layout;
     assert(!get_panels(layout).empty());
   }
+  // The seek bar is below the text
+  {
+    const played_game_view_layout layout;
+    assert(layout.get_seek_bar().get_tl().get_y() > layout.get_text().get_br().get_y());
+    assert(get_width(layout.get_seek_bar()) == get_width(layout.get_text()));
+  }
   #endif
 }
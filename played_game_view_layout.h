@@ -20,9 +20,12 @@
 /// | |          | |
 /// | |          | |
 /// | |          | |
-/// | |          | |
 /// | +----------+ | y2
 /// |              |
+/// | +----------+ | y3
+/// | | seek bar | |
+/// | +----------+ | y4
+/// |              |
 /// +--------------+
 ///
 ///   ^          ^
@@ -38,6 +41,9 @@ public:
     const int margin_width = get_default_margin_width()
   );
 
+  /// Get the bar that shows where in a recorded match the view is
+  const auto& get_seek_bar() const noexcept { return m_seek_bar; }
+
   const auto& get_text() const noexcept { return m_text; }
 
   /// Get the size of the font that would fit nicely
@@ -47,6 +53,9 @@ public:
 
 private:
 
+  /// The bar that shows where in a recorded match the view is
+  screen_rect m_seek_bar;
+
   screen_rect m_text;
 
   /// The size of the font that would fit nicely
@@ -56,6 +56,10 @@ void test_read_only()
     assert(x_other < x);  // Can compare
     assert(x_other <= x); // Can compare
   }
+  // The value is stored inline
+  {
+    static_assert(sizeof(read_only<int>) <= 2 * sizeof(int));
+  }
   // double
   {
     read_only<double> y(3.14);
@@ -1,30 +1,34 @@
 #ifndef READ_ONLY_H
 #define READ_ONLY_H
 
-#include <vector>
+#include <optional>
 #include <iostream>
+#include <stdexcept>
 
+/// A value that can only be set at construction.
+/// The value is stored inline, so that reading it
+/// does not need to follow a pointer
 template <class T>
 class read_only
 {
 public:
-  read_only() : m_value{std::vector<T>()} {};
-  read_only(const T& value) : m_value{std::vector<T>(1, value)} {};
+  read_only() : m_value{} {};
+  read_only(const T& value) : m_value{value} {};
 
-  bool has_value() const { return !m_value.empty(); };
+  bool has_value() const noexcept { return m_value.has_value(); };
 
   const T& get_value() const {
     if(!this->has_value())
       {
         throw std::logic_error("this object does not contain a value!\n");
       }
-    return m_value[0];
+    return *m_value;
   };
 
-  void operator=( const T& value ) { m_value[0] = value; };
+  void operator=( const T& value ) { m_value = value; };
 
 private:
-  std::vector<T> m_value;
+  std::optional<T> m_value;
 };
 
 /// Test our read_only class
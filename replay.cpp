@@ -1,6 +1,7 @@
 #include "replay.h"
 
 #include "helper.h"
+#include "pgn_reader.h"
 
 #include <algorithm>
 #include <cassert>
@@ -13,16 +14,10 @@ replay::replay(const std::string& pgn_str)
 
   assert(!pgn_str.empty());
   assert(std::count(std::begin(pgn_str), std::end(pgn_str), '\n') == 0);
-  const std::vector<std::string> pgn_moves{
-    split_pgn_str(pgn_str)
-  };
-
-  m_moves.reserve(pgn_moves.size());
-  chess_color color{chess_color::white};
-  for (const auto& pgn_move: pgn_moves)
+  pgn_reader reader(pgn_str);
+  if (reader.read_game())
   {
-    m_moves.push_back(chess_move(pgn_move, color));
-    color = get_other_color(color);
+    m_moves = reader.get_moves();
   }
 }
 
@@ -42,7 +37,7 @@ std::string get_scholars_mate_as_pgn_str() noexcept
   return "1. e4 e5 2. Qh5 Nc6 3. Bc4 Nf6?? Qxf7# 1-0";
 }
 
-std::vector<std::string> split_pgn_str(const std::string pgn_str)
+std::vector<std::string> split_pgn_str(const std::string& pgn_str)
 {
   std::vector<std::string> strings{
     split_str(pgn_str, ' ')
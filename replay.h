@@ -34,7 +34,7 @@ replay get_replay_1() noexcept;
 
 /// Split the PGN string into its moves
 /// E.g. '1. e4 e5 2. Nc3' will be split into {'e4', 'e5', 'Nc3'}
-std::vector<std::string> split_pgn_str(const std::string pgn_str);
+std::vector<std::string> split_pgn_str(const std::string& pgn_str);
 
 /// Test this class and its free functions
 void test_replay();
@@ -0,0 +1,278 @@
+#include "replay_validation.h"
+
+#include "game.h"
+#include "game_controller.h"
+#include "physical_controllers.h"
+#include "replay.h"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <exception>
+#include <iostream>
+#include <numeric>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+
+replay_validation::replay_validation(
+  const std::vector<chess_move>& moves,
+  const int max_n_ticks_per_move
+)
+  : m_n_moves{0},
+    m_n_secs{0.0},
+    m_n_ticks{0}
+{
+  assert(max_n_ticks_per_move > 0);
+  const auto start{std::chrono::steady_clock::now()};
+  game g;
+  game_controller c(create_two_keyboard_controllers());
+  for (const auto& m: moves)
+  {
+    // The result, e.g. '1-0', ends the game
+    if (!m.get_winner().empty()) break;
+    try
+    {
+      const square from{get_from(g, m)};
+      const id moved_id{get_piece_at(g, from).get_id()};
+      const square to{get_target_square(m)};
+      // A pawn that captures on an empty square does en passant
+      if (m.get_type() == piece_type::pawn && m.is_capture() && !is_piece_at(g, to))
+      {
+        throw std::invalid_argument("en passant is not supported yet");
+      }
+      const user_inputs inputs{convert_move_to_user_inputs(g, c, m)};
+      // Each input is done in its own tick, as a user would
+      for (const auto& input: inputs.get_user_inputs())
+      {
+        c.add_user_input(input);
+        c.apply_user_inputs_to_game(g);
+        g.tick(delta_t(0.0));
+        ++m_n_ticks;
+      }
+      int n_ticks{0};
+      while (!is_idle(g) && n_ticks != max_n_ticks_per_move)
+      {
+        g.tick(delta_t(0.1));
+        ++n_ticks;
+      }
+      m_n_ticks += n_ticks;
+      const piece_type type{
+        is_castling(m) ? piece_type::king
+        : m.get_promotion_type().value_or(m.get_type().value())
+      };
+      std::stringstream error;
+      if (!is_idle(g))
+      {
+        error << "the pieces are not idle after " << n_ticks << " ticks";
+      }
+      else if (is_piece_at(g, from))
+      {
+        error << "there still is a piece at " << to_str(from);
+      }
+      else if (!is_piece_at(g, to) || get_piece_at(g, to).get_id() != moved_id)
+      {
+        error << "the piece from " << to_str(from) << " is not at " << to_str(to);
+      }
+      else if (get_piece_at(g, to).get_color() != m.get_color()
+        || get_piece_at(g, to).get_type() != type
+      )
+      {
+        error << "there is no " << to_str(m.get_color()) << ' ' << to_str(type)
+          << " at " << to_str(to);
+      }
+      m_error = error.str();
+    }
+    catch (const std::exception& e)
+    {
+      m_error = e.what();
+    }
+    if (!m_error.empty())
+    {
+      m_failed_move = m.get_pgn_str();
+      break;
+    }
+    ++m_n_moves;
+  }
+  const std::chrono::duration<double> duration{
+    std::chrono::steady_clock::now() - start
+  };
+  m_n_secs = duration.count();
+}
+
+long long count_moves(const std::vector<replay_validation>& validations) noexcept
+{
+  return std::accumulate(
+    std::begin(validations),
+    std::end(validations),
+    0LL,
+    [](const long long sum, const replay_validation& v)
+    {
+      return sum + v.get_n_moves();
+    }
+  );
+}
+
+int count_reproduced(const std::vector<replay_validation>& validations) noexcept
+{
+  return std::count_if(
+    std::begin(validations),
+    std::end(validations),
+    [](const replay_validation& v) { return is_reproduced(v); }
+  );
+}
+
+long long count_ticks(const std::vector<replay_validation>& validations) noexcept
+{
+  return std::accumulate(
+    std::begin(validations),
+    std::end(validations),
+    0LL,
+    [](const long long sum, const replay_validation& v)
+    {
+      return sum + v.get_n_ticks();
+    }
+  );
+}
+
+bool is_reproduced(const replay_validation& v) noexcept
+{
+  return v.get_error().empty();
+}
+
+std::vector<replay_validation> validate_in_parallel(
+  const std::vector<std::vector<chess_move>>& games,
+  const int n_threads,
+  const int max_n_ticks_per_move
+)
+{
+  const int n_games{static_cast<int>(games.size())};
+  std::vector<std::optional<replay_validation>> maybe_validations(n_games);
+  do_in_parallel(
+    n_games,
+    [&games, &maybe_validations, max_n_ticks_per_move](const int i)
+    {
+      maybe_validations[i].emplace(games[i], max_n_ticks_per_move);
+    },
+    n_threads
+  );
+
+  std::vector<replay_validation> validations;
+  validations.reserve(n_games);
+  for (const auto& v: maybe_validations)
+  {
+    assert(v);
+    validations.push_back(v.value());
+  }
+  return validations;
+}
+
+void test_replay_validation()
+{
+#ifndef NDEBUG
+  // replay_validation on zero moves
+  {
+    const replay_validation v({});
+    assert(is_reproduced(v));
+    assert(v.get_n_moves() == 0);
+    assert(v.get_failed_move().empty());
+  }
+  // replay_validation reproduces simple moves
+  {
+    const replay_validation v(replay("1. e4 e5 2. Nf3 Nc6 1-0").get_moves());
+    assert(is_reproduced(v));
+    assert(v.get_n_moves() == 4);
+    assert(v.get_n_ticks() > 0);
+    assert(v.get_n_secs() >= 0.0);
+  }
+  // replay_validation reproduces a capture
+  {
+    const replay_validation v(replay("1. e4 d5 2. exd5").get_moves());
+    assert(is_reproduced(v));
+    assert(v.get_n_moves() == 3);
+  }
+  // replay_validation moves the knight the file tells
+  {
+    const replay_validation v(replay("1. Nf3 a6 2. d3 a5 3. Nfd2 a4 4. Nc3 *").get_moves());
+    assert(is_reproduced(v));
+    assert(v.get_n_moves() == 7);
+  }
+  // replay_validation captures with the pawn the file tells
+  {
+    for (const std::string capture: { "exd5", "cxd5" })
+    {
+      const replay_validation v(replay("1. e4 d5 2. c4 e6 3. " + capture).get_moves());
+      assert(is_reproduced(v));
+      assert(v.get_n_moves() == 5);
+    }
+  }
+  // replay_validation stops at en passant
+  {
+    const replay_validation v(replay("1. e4 a6 2. e5 d5 3. exd6 *").get_moves());
+    assert(!is_reproduced(v));
+    assert(v.get_n_moves() == 4);
+    assert(v.get_failed_move() == "exd6");
+    assert(v.get_error() == "en passant is not supported yet");
+  }
+  // replay_validation reproduces a capture by a piece
+  {
+    const replay_validation v(replay("1. Nf3 e5 2. Nxe5").get_moves());
+    assert(is_reproduced(v));
+  }
+  // replay_validation stops at a move that cannot be done
+  {
+    const replay_validation v(replay("1. e4 e5 2. e5 Nc6").get_moves());
+    assert(!is_reproduced(v));
+    assert(v.get_n_moves() == 2);
+    assert(v.get_failed_move() == "e5");
+    assert(!v.get_error().empty());
+  }
+  // replay_validation stops at a move that does not finish in time
+  {
+    const replay_validation v(replay("1. e4").get_moves(), 1);
+    assert(!is_reproduced(v));
+    assert(v.get_n_moves() == 0);
+  }
+  // validate_in_parallel gives the same results as validating one by one
+  {
+    const std::vector<std::vector<chess_move>> games{
+      replay("1. e4 e5").get_moves(),
+      replay("1. e5").get_moves(),
+      replay("1. d4 d5 2. c4").get_moves()
+    };
+    const auto validations{validate_in_parallel(games, 2)};
+    assert(validations.size() == 3);
+    for (int i{0}; i != 3; ++i)
+    {
+      const replay_validation v(games[i]);
+      assert(validations[i].get_error() == v.get_error());
+      assert(validations[i].get_n_moves() == v.get_n_moves());
+      assert(validations[i].get_n_ticks() == v.get_n_ticks());
+    }
+    assert(count_reproduced(validations) == 2);
+    assert(count_moves(validations) == 5);
+    assert(count_ticks(validations) > 0);
+  }
+  // operator<<
+  {
+    const replay_validation v(replay("1. e5").get_moves());
+    std::stringstream s;
+    s << v;
+    assert(!s.str().empty());
+  }
+#endif // NDEBUG
+}
+
+std::ostream& operator<<(std::ostream& os, const replay_validation& v) noexcept
+{
+  os
+    << "Number of moves reproduced: " << v.get_n_moves() << '\n'
+    << "Number of ticks: " << v.get_n_ticks() << '\n'
+    << "Duration (secs): " << v.get_n_secs()
+  ;
+  if (!is_reproduced(v))
+  {
+    os << '\n' << "Move '" << v.get_failed_move() << "' not reproduced: " << v.get_error();
+  }
+  return os;
+}
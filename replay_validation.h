@@ -0,0 +1,97 @@
+#ifndef REPLAY_VALIDATION_H
+#define REPLAY_VALIDATION_H
+
+#include "ccfwd.h"
+#include "chess_move.h"
+#include "simulations.h"
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+/// Get the default maximum number of ticks a move may take,
+/// which is 100 seconds at 10 ticks per second
+constexpr int get_default_max_n_ticks_per_move() noexcept { return 1000; }
+
+/// The replay of the moves of a chess game in a \link{game},
+/// to check that the game reproduces the chess game.
+///
+/// The moves are done one after the other, by two keyboard users,
+/// where the game is ticked until all pieces are idle after each move.
+/// A move is reproduced if the piece that did it left its square
+/// and ends up at its target square.
+/// The replay stops at the first move that is not reproduced.
+/// A move that cannot be done, e.g. for which \link{get_from} throws,
+/// is not reproduced, so the replay does not abort.
+/// En passant is not supported yet, so it is never reproduced.
+class replay_validation
+{
+public:
+  explicit replay_validation(
+    const std::vector<chess_move>& moves,
+    const int max_n_ticks_per_move = get_default_max_n_ticks_per_move()
+  );
+
+  /// Get why the move at index 'get_n_moves()' was not reproduced.
+  /// Is empty if all moves were reproduced
+  const auto& get_error() const noexcept { return m_error; }
+
+  /// Get the move that was not reproduced, in PGN notation, e.g. 'exd5'.
+  /// Is empty if all moves were reproduced
+  const auto& get_failed_move() const noexcept { return m_failed_move; }
+
+  /// Get the number of moves reproduced
+  int get_n_moves() const noexcept { return m_n_moves; }
+
+  /// Get the number of seconds the replay took
+  double get_n_secs() const noexcept { return m_n_secs; }
+
+  /// Get the number of ticks done
+  int get_n_ticks() const noexcept { return m_n_ticks; }
+
+private:
+
+  /// Why a move was not reproduced
+  std::string m_error;
+
+  /// The move that was not reproduced
+  std::string m_failed_move;
+
+  /// The number of moves reproduced
+  int m_n_moves;
+
+  /// The number of seconds the replay took
+  double m_n_secs;
+
+  /// The number of ticks done
+  int m_n_ticks;
+};
+
+/// Count the total number of moves reproduced
+long long count_moves(const std::vector<replay_validation>& validations) noexcept;
+
+/// Count the number of replays in which all moves were reproduced
+int count_reproduced(const std::vector<replay_validation>& validations) noexcept;
+
+/// Count the total number of ticks
+long long count_ticks(const std::vector<replay_validation>& validations) noexcept;
+
+/// Were all moves reproduced?
+bool is_reproduced(const replay_validation& v) noexcept;
+
+/// Replay each game of chess moves.
+/// The replays are independent, hence are done in parallel,
+/// see \link{do_in_parallel}.
+/// The validation at index i is of the game at index i
+std::vector<replay_validation> validate_in_parallel(
+  const std::vector<std::vector<chess_move>>& games,
+  const int n_threads = get_n_threads(),
+  const int max_n_ticks_per_move = get_default_max_n_ticks_per_move()
+);
+
+/// Test this class and its free functions
+void test_replay_validation();
+
+std::ostream& operator<<(std::ostream& os, const replay_validation& v) noexcept;
+
+#endif // REPLAY_VALIDATION_H
@@ -1,6 +1,7 @@
 #include "replayer.h"
 #include "game.h"
 #include "game_controller.h"
+#include "log_ring_buffer.h"
 
 #include <cassert>
 #include <iostream>
@@ -30,9 +31,19 @@ void replayer::do_move(
 
   // Do the move
   const auto& move{m_replay.get_moves().at(move_index)};
-  std::clog << g.get_time() << ": replayer doing " << move << '\n';
+  log_message<log_level::info>(
+    [&](std::ostream& os)
+    {
+      os << g.get_time() << ": replayer doing " << move;
+    }
+  );
   const auto inputs{convert_move_to_user_inputs(g, c, move)};
-  std::clog << g.get_time() << ": replayer doing inputs:\n" << user_inputs(inputs) << '\n';
+  log_message<log_level::debug>(
+    [&](std::ostream& os)
+    {
+      os << g.get_time() << ": replayer doing inputs: " << inputs;
+    }
+  );
   add_user_inputs(c, inputs);
 }
 
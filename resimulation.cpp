@@ -0,0 +1,168 @@
+#include "resimulation.h"
+
+#include "input_recording.h"
+#include "physical_controllers.h"
+#include "user_input.h"
+
+#include <cassert>
+
+resimulation::resimulation(const input_recording& r)
+  : m_delta_t{0.0},
+    m_game(r.get_game_options(), r.get_lobby_options()),
+    m_game_controller(get_physical_controllers(r)),
+    m_next_delta_t_index{0},
+    m_next_user_input_index{0},
+    m_recording{std::make_shared<const input_recording>(r)},
+    m_tick{0}
+{
+
+}
+
+void resimulation::apply_user_inputs()
+{
+  const auto& timed_user_inputs{m_recording->get_timed_user_inputs()};
+  const int n{static_cast<int>(timed_user_inputs.size())};
+  while (m_next_user_input_index != n
+    && timed_user_inputs[m_next_user_input_index].first == m_tick
+  )
+  {
+    m_game_controller.add_user_input(timed_user_inputs[m_next_user_input_index].second);
+    ++m_next_user_input_index;
+  }
+  m_game_controller.apply_user_inputs_to_game(m_game);
+}
+
+int get_n_ticks(const resimulation& r) noexcept
+{
+  return r.get_recording().get_n_ticks();
+}
+
+bool is_done(const resimulation& r) noexcept
+{
+  return r.get_tick() == get_n_ticks(r);
+}
+
+game resimulate(const input_recording& r)
+{
+  resimulation s(r);
+  while (!is_done(s))
+  {
+    s.tick();
+  }
+  // The user inputs after the last tick
+  s.apply_user_inputs();
+  return s.get_game();
+}
+
+void resimulation::tick()
+{
+  assert(!is_done(*this));
+  apply_user_inputs();
+  const auto& timed_delta_ts{m_recording->get_timed_delta_ts()};
+  const int n{static_cast<int>(timed_delta_ts.size())};
+  while (m_next_delta_t_index != n
+    && timed_delta_ts[m_next_delta_t_index].first == m_tick
+  )
+  {
+    m_delta_t = timed_delta_ts[m_next_delta_t_index].second;
+    ++m_next_delta_t_index;
+  }
+  m_game.tick(m_delta_t);
+  ++m_tick;
+}
+
+void test_resimulation()
+{
+#ifndef NDEBUG
+  // resimulation::resimulation
+  {
+    const input_recording r(
+      create_default_game_options(),
+      create_default_lobby_options(),
+      physical_controller_type::keyboard,
+      physical_controller_type::keyboard,
+      {},
+      { std::make_pair(0, delta_t(0.1)) },
+      3
+    );
+    const resimulation s(r);
+    assert(s.get_tick() == 0);
+    assert(get_n_ticks(s) == 3);
+    assert(!is_done(s));
+    assert(s.get_recording() == r);
+  }
+  // resimulation::tick
+  {
+    const input_recording r(
+      create_default_game_options(),
+      create_default_lobby_options(),
+      physical_controller_type::keyboard,
+      physical_controller_type::keyboard,
+      {},
+      { std::make_pair(0, delta_t(0.1)), std::make_pair(1, delta_t(0.2)) },
+      2
+    );
+    resimulation s(r);
+    s.tick();
+    assert(s.get_tick() == 1);
+    assert(s.get_game().get_time() == delta_t(0.1));
+    s.tick();
+    assert(is_done(s));
+    assert(s.get_game().get_time() == delta_t(0.1) + delta_t(0.2));
+  }
+  // resimulate, without user inputs, gives the game after ticking
+  {
+    game_options go{create_default_game_options()};
+    go.set_starting_position(starting_position_type::kings_only);
+    const input_recording r(
+      go,
+      create_default_lobby_options(),
+      physical_controller_type::keyboard,
+      physical_controller_type::keyboard,
+      {},
+      { std::make_pair(0, delta_t(0.25)) },
+      4
+    );
+    game g(go, create_default_lobby_options());
+    for (int i{0}; i != 4; ++i) g.tick(delta_t(0.25));
+    const game resimulated{resimulate(r)};
+    assert(resimulated.get_time() == g.get_time());
+    assert(get_hash(resimulated) == get_hash(g));
+  }
+  // resimulate, with user inputs, gives the game they were applied to
+  {
+    const auto go{create_default_game_options()};
+    const auto lo{create_default_lobby_options()};
+    const std::vector<std::pair<int, user_input>> timed_user_inputs{
+      std::make_pair(0, create_press_right_action(side::lhs)),
+      std::make_pair(0, create_press_action_1(side::lhs)),
+      std::make_pair(1, create_press_right_action(side::lhs)),
+      std::make_pair(1, create_press_action_1(side::lhs)),
+      std::make_pair(2, create_press_left_action(side::rhs))
+    };
+    const input_recording r(
+      go,
+      lo,
+      physical_controller_type::keyboard,
+      physical_controller_type::keyboard,
+      timed_user_inputs,
+      { std::make_pair(0, delta_t(0.1)) },
+      30
+    );
+    game g(go, lo);
+    game_controller c(create_two_keyboard_controllers());
+    for (int tick{0}; tick != 30; ++tick)
+    {
+      for (const auto& p: timed_user_inputs)
+      {
+        if (p.first == tick) c.add_user_input(p.second);
+      }
+      c.apply_user_inputs_to_game(g);
+      g.tick(delta_t(0.1));
+    }
+    const game resimulated{resimulate(r)};
+    assert(resimulated.get_pieces() == g.get_pieces());
+    assert(get_hash(resimulated) == get_hash(g));
+  }
+#endif // NDEBUG
+}
@@ -0,0 +1,71 @@
+#ifndef RESIMULATION_H
+#define RESIMULATION_H
+
+#include "ccfwd.h"
+#include "delta_t.h"
+#include "game.h"
+#include "game_controller.h"
+
+#include <memory>
+
+/// Plays an \link{input_recording} again, one tick at a time.
+///
+/// The recording is shared between copies,
+/// so a copy costs about as much as a copy of the game,
+/// which allows to keep copies as keyframes, see \link{keyframed_replay}
+class resimulation
+{
+public:
+  explicit resimulation(const input_recording& r);
+
+  /// Apply the user inputs recorded at the current tick
+  void apply_user_inputs();
+
+  const auto& get_game() const noexcept { return m_game; }
+
+  const auto& get_game_controller() const noexcept { return m_game_controller; }
+
+  const auto& get_recording() const noexcept { return *m_recording; }
+
+  /// Get the number of ticks done
+  int get_tick() const noexcept { return m_tick; }
+
+  /// Apply the user inputs recorded at the current tick,
+  /// then tick the game as long as recorded
+  void tick();
+
+private:
+
+  /// The time per tick
+  delta_t m_delta_t;
+
+  game m_game;
+
+  game_controller m_game_controller;
+
+  /// The index of the next time per tick in the recording
+  int m_next_delta_t_index;
+
+  /// The index of the next user input in the recording
+  int m_next_user_input_index;
+
+  std::shared_ptr<const input_recording> m_recording;
+
+  /// The number of ticks done
+  int m_tick;
+};
+
+/// Get the number of ticks in the recording
+int get_n_ticks(const resimulation& r) noexcept;
+
+/// Are all recorded ticks done?
+bool is_done(const resimulation& r) noexcept;
+
+/// Play the recording again, from the start, and get the game at its end.
+/// This game is identical to the recorded one
+game resimulate(const input_recording& r);
+
+/// Test this class and its free functions
+void test_resimulation();
+
+#endif // RESIMULATION_H
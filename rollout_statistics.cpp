@@ -0,0 +1,119 @@
+#include "rollout_statistics.h"
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <sstream>
+
+rollout_statistics::rollout_statistics(const piece_action& first_action)
+  : m_first_action{first_action},
+    m_n_draws{0},
+    m_n_losses{0},
+    m_n_wins{0}
+{
+
+}
+
+void rollout_statistics::add(const std::optional<chess_color>& winner) noexcept
+{
+  if (!winner) ++m_n_draws;
+  else if (*winner == get_color()) ++m_n_wins;
+  else ++m_n_losses;
+}
+
+const rollout_statistics& get_best(const std::vector<rollout_statistics>& s)
+{
+  assert(!s.empty());
+  return *std::max_element(
+    std::begin(s),
+    std::end(s),
+    [](const rollout_statistics& lhs, const rollout_statistics& rhs)
+    {
+      return get_score(lhs) < get_score(rhs);
+    }
+  );
+}
+
+int get_n_rollouts(const rollout_statistics& s) noexcept
+{
+  return s.get_n_draws() + s.get_n_losses() + s.get_n_wins();
+}
+
+double get_score(const rollout_statistics& s) noexcept
+{
+  const int n{get_n_rollouts(s)};
+  if (n == 0) return 0.5;
+  return (static_cast<double>(s.get_n_wins()) + (0.5 * s.get_n_draws())) / n;
+}
+
+void test_rollout_statistics()
+{
+#ifndef NDEBUG
+  // rollout_statistics::rollout_statistics
+  {
+    const rollout_statistics s(get_test_piece_action());
+    assert(s.get_first_action() == get_test_piece_action());
+    assert(s.get_color() == get_test_piece_action().get_color());
+    assert(get_n_rollouts(s) == 0);
+    assert(get_score(s) == 0.5);
+  }
+  // rollout_statistics::add
+  {
+    rollout_statistics s(get_test_piece_action());
+    assert(s.get_color() == chess_color::white);
+    s.add(chess_color::white);
+    s.add(chess_color::black);
+    s.add(chess_color::white);
+    s.add({});
+    assert(s.get_n_wins() == 2);
+    assert(s.get_n_losses() == 1);
+    assert(s.get_n_draws() == 1);
+    assert(get_n_rollouts(s) == 4);
+    assert(get_score(s) == 2.5 / 4.0);
+  }
+  // get_best
+  {
+    rollout_statistics a(get_test_piece_action());
+    rollout_statistics b(get_test_piece_action());
+    a.add(chess_color::black);
+    b.add(chess_color::white);
+    const std::vector<rollout_statistics> v{a, b};
+    assert(get_best(v) == b);
+  }
+  // operator==
+  {
+    rollout_statistics a(get_test_piece_action());
+    const rollout_statistics b(get_test_piece_action());
+    assert(a == b);
+    a.add({});
+    assert(!(a == b));
+  }
+  // operator<<
+  {
+    const rollout_statistics s(get_test_piece_action());
+    std::stringstream str;
+    str << s;
+    assert(!str.str().empty());
+  }
+#endif // NDEBUG
+}
+
+bool operator==(const rollout_statistics& lhs, const rollout_statistics& rhs) noexcept
+{
+  return lhs.get_first_action() == rhs.get_first_action()
+    && lhs.get_n_draws() == rhs.get_n_draws()
+    && lhs.get_n_losses() == rhs.get_n_losses()
+    && lhs.get_n_wins() == rhs.get_n_wins()
+  ;
+}
+
+std::ostream& operator<<(std::ostream& os, const rollout_statistics& s) noexcept
+{
+  os
+    << s.get_first_action() << ": "
+    << s.get_n_wins() << " wins, "
+    << s.get_n_draws() << " draws, "
+    << s.get_n_losses() << " losses"
+  ;
+  return os;
+}
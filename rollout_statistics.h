@@ -0,0 +1,70 @@
+#ifndef ROLLOUT_STATISTICS_H
+#define ROLLOUT_STATISTICS_H
+
+#include "chess_color.h"
+#include "piece_action.h"
+
+#include <iosfwd>
+#include <optional>
+#include <vector>
+
+/// The results of the rollouts that started with the same action,
+/// from the perspective of the color doing that action
+class rollout_statistics
+{
+public:
+  explicit rollout_statistics(const piece_action& first_action);
+
+  /// Add the result of a rollout, i.e. its winner, if any
+  void add(const std::optional<chess_color>& winner) noexcept;
+
+  /// Get the color doing the first action
+  auto get_color() const noexcept { return m_first_action.get_color(); }
+
+  /// Get the action the rollouts started with
+  const auto& get_first_action() const noexcept { return m_first_action; }
+
+  /// Get the number of rollouts without a winner
+  int get_n_draws() const noexcept { return m_n_draws; }
+
+  /// Get the number of rollouts lost
+  int get_n_losses() const noexcept { return m_n_losses; }
+
+  /// Get the number of rollouts won
+  int get_n_wins() const noexcept { return m_n_wins; }
+
+private:
+
+  /// The action the rollouts started with
+  piece_action m_first_action;
+
+  /// The number of rollouts without a winner
+  int m_n_draws;
+
+  /// The number of rollouts lost
+  int m_n_losses;
+
+  /// The number of rollouts won
+  int m_n_wins;
+};
+
+/// Get the number of rollouts
+int get_n_rollouts(const rollout_statistics& s) noexcept;
+
+/// Get the score, i.e. the number of wins plus half the number of draws,
+/// divided by the number of rollouts.
+/// Returns 0.5 if there are no rollouts
+double get_score(const rollout_statistics& s) noexcept;
+
+/// Get the statistics with the highest score.
+/// There must be at least one statistics
+const rollout_statistics& get_best(const std::vector<rollout_statistics>& s);
+
+/// Test this class and its free functions
+void test_rollout_statistics();
+
+bool operator==(const rollout_statistics& lhs, const rollout_statistics& rhs) noexcept;
+
+std::ostream& operator<<(std::ostream& os, const rollout_statistics& s) noexcept;
+
+#endif // ROLLOUT_STATISTICS_H
@@ -0,0 +1,177 @@
+#include "rollouts.h"
+
+#include "computer_player.h"
+#include "game.h"
+#include "pieces.h"
+
+#include <algorithm>
+#include <cassert>
+
+void add_random_actions(
+  game& g,
+  std::mt19937& rng,
+  std::vector<piece_action>& actions
+)
+{
+  actions.clear();
+  for (const auto color: { chess_color::white, chess_color::black })
+  {
+    collect_candidate_actions(g, color, actions);
+  }
+
+  // The actions of a piece are adjacent, pick one per piece
+  auto first{std::begin(actions)};
+  while (first != std::end(actions))
+  {
+    const square from{first->get_from()};
+    const auto last{
+      std::find_if(
+        first,
+        std::end(actions),
+        [&from](const piece_action& action) { return action.get_from() != from; }
+      )
+    };
+    std::uniform_int_distribution<int> distribution(
+      0,
+      static_cast<int>(std::distance(first, last)) - 1
+    );
+    const piece_action& action{*(first + distribution(rng))};
+    get_piece_at(g, from).add_action(action);
+    first = last;
+  }
+}
+
+std::optional<chess_color> do_rollout(
+  game& g,
+  const int max_n_ticks,
+  std::mt19937& rng,
+  const delta_t& dt
+)
+{
+  assert(delta_t(0.0) < dt);
+  std::vector<piece_action> actions;
+  for (int i{0}; i != max_n_ticks; ++i)
+  {
+    const auto winner{get_winner(g)};
+    if (winner) return winner;
+    add_random_actions(g, rng, actions);
+    g.tick(dt);
+  }
+  return get_winner(g);
+}
+
+std::vector<rollout_statistics> do_rollouts(
+  const game& g,
+  const chess_color color,
+  const int n_rollouts_per_action,
+  const int max_n_ticks,
+  const int n_threads,
+  const int seed,
+  const delta_t& dt
+)
+{
+  assert(n_rollouts_per_action >= 0);
+  std::vector<piece_action> first_actions;
+  collect_candidate_actions(g, color, first_actions);
+
+  const int n_jobs{
+    static_cast<int>(first_actions.size()) * n_rollouts_per_action
+  };
+  std::vector<std::optional<chess_color>> winners(n_jobs);
+  do_in_parallel(
+    n_jobs,
+    [&](const int i)
+    {
+      const piece_action& first_action{first_actions[i / n_rollouts_per_action]};
+      std::mt19937 rng(seed + i);
+      game copy{g};
+      get_piece_at(copy, first_action.get_from()).add_action(first_action);
+      winners[i] = do_rollout(copy, max_n_ticks, rng, dt);
+    },
+    n_threads
+  );
+
+  std::vector<rollout_statistics> statistics;
+  statistics.reserve(first_actions.size());
+  for (const auto& first_action: first_actions)
+  {
+    statistics.push_back(rollout_statistics(first_action));
+  }
+  for (int i{0}; i != n_jobs; ++i)
+  {
+    statistics[i / n_rollouts_per_action].add(winners[i]);
+  }
+  return statistics;
+}
+
+void test_rollouts()
+{
+#ifndef NDEBUG
+  // add_random_actions gives each idle piece one action
+  {
+    game g{get_kings_only_game()};
+    std::mt19937 rng(42);
+    std::vector<piece_action> actions;
+    add_random_actions(g, rng, actions);
+    for (const auto& p: g.get_pieces())
+    {
+      assert(p.get_actions().size() == 1);
+    }
+  }
+  // add_random_actions leaves busy pieces alone
+  {
+    game g{get_kings_only_game()};
+    std::mt19937 rng(42);
+    std::vector<piece_action> actions;
+    add_random_actions(g, rng, actions);
+    add_random_actions(g, rng, actions);
+    for (const auto& p: g.get_pieces())
+    {
+      assert(p.get_actions().size() == 1);
+    }
+  }
+  // do_rollout without ticks has no winner in the starting position
+  {
+    game g{get_kings_only_game()};
+    std::mt19937 rng(42);
+    assert(!do_rollout(g, 0, rng));
+  }
+  // do_rollout with a winner already is done immediately
+  {
+    game g{get_kings_only_game()};
+    g.remove_piece_at(square("e1"));
+    std::mt19937 rng(42);
+    assert(do_rollout(g, 10, rng) == chess_color::black);
+    assert(g.get_time() == delta_t(0.0));
+  }
+  // do_rollouts gives statistics per candidate action
+  {
+    const game g{get_kings_only_game()};
+    std::vector<piece_action> candidates;
+    collect_candidate_actions(g, chess_color::white, candidates);
+    const auto statistics{do_rollouts(g, chess_color::white, 3, 10, 2)};
+    assert(statistics.size() == candidates.size());
+    for (std::size_t i{0}; i != statistics.size(); ++i)
+    {
+      assert(statistics[i].get_first_action() == candidates[i]);
+      assert(get_n_rollouts(statistics[i]) == 3);
+    }
+  }
+  // do_rollouts does not depend on the number of threads
+  {
+    const game g{get_game_with_starting_position(starting_position_type::queen_end_game)};
+    const auto a{do_rollouts(g, chess_color::black, 2, 100, 1)};
+    const auto b{do_rollouts(g, chess_color::black, 2, 100, 4)};
+    assert(a == b);
+  }
+  // do_rollouts with zero rollouts per action
+  {
+    const game g{get_kings_only_game()};
+    const auto statistics{do_rollouts(g, chess_color::white, 0, 10)};
+    for (const auto& s: statistics)
+    {
+      assert(get_n_rollouts(s) == 0);
+    }
+  }
+#endif // NDEBUG
+}
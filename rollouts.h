@@ -0,0 +1,58 @@
+#ifndef ROLLOUTS_H
+#define ROLLOUTS_H
+
+#include "ccfwd.h"
+#include "chess_color.h"
+#include "delta_t.h"
+#include "piece_action.h"
+#include "rollout_statistics.h"
+#include "simulations.h"
+
+#include <optional>
+#include <random>
+#include <vector>
+
+/// Let each idle piece, of both colors, start a random action.
+/// Only the actions a computer player considers are picked from,
+/// see \link{collect_candidate_actions}.
+/// 'actions' is a buffer that is re-used between calls,
+/// so that rollouts do not allocate at every tick
+void add_random_actions(
+  game& g,
+  std::mt19937& rng,
+  std::vector<piece_action>& actions
+);
+
+/// Play the game out with random actions,
+/// by ticking it at most 'max_n_ticks' times, in steps of 'dt'.
+/// @return the winner, if any. No winner counts as a draw
+std::optional<chess_color> do_rollout(
+  game& g,
+  const int max_n_ticks,
+  std::mt19937& rng,
+  const delta_t& dt = delta_t(0.1)
+);
+
+/// Monte Carlo rollouts: for each action a color can start,
+/// do that action in a copy of the game, then play that copy out
+/// 'n_rollouts_per_action' times (see \link{do_rollout}).
+/// All rollouts are independent, hence are done in parallel,
+/// see \link{do_in_parallel}.
+/// Rollout i of action j uses seed 'seed + (j * n_rollouts_per_action) + i',
+/// so that the results do not depend on the number of threads.
+/// @return the statistics per first action,
+///   in the order of \link{collect_candidate_actions}
+std::vector<rollout_statistics> do_rollouts(
+  const game& g,
+  const chess_color color,
+  const int n_rollouts_per_action,
+  const int max_n_ticks,
+  const int n_threads = get_n_threads(),
+  const int seed = 42,
+  const delta_t& dt = delta_t(0.1)
+);
+
+/// Test these functions
+void test_rollouts();
+
+#endif // ROLLOUTS_H
@@ -8,10 +8,122 @@
 
 #include <SFML/Graphics/RectangleShape.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <iostream>
 
+#ifndef LOGIC_ONLY
+void add_circle(
+  sf::VertexArray& vertices,
+  const sf::Vector2f& center,
+  const float radius,
+  const sf::Color& color,
+  const int n_points
+)
+{
+  assert(vertices.getPrimitiveType() == sf::Triangles);
+  assert(n_points >= 3);
+  const double pi{std::acos(-1.0)};
+  const auto get_point{
+    [center, radius, n_points, pi](const int i)
+    {
+      const double angle{2.0 * pi * i / n_points};
+      return center + sf::Vector2f(
+        radius * std::cos(angle),
+        radius * std::sin(angle)
+      );
+    }
+  };
+  for (int i{0}; i != n_points; ++i)
+  {
+    vertices.append(sf::Vertex(center, color));
+    vertices.append(sf::Vertex(get_point(i), color));
+    vertices.append(sf::Vertex(get_point(i + 1), color));
+  }
+}
+
+void add_line(
+  sf::VertexArray& vertices,
+  const sf::Vector2f& from,
+  const sf::Vector2f& to,
+  const float width,
+  const sf::Color& color
+)
+{
+  assert(vertices.getPrimitiveType() == sf::Triangles);
+  const sf::Vector2f delta{to - from};
+  const float length{std::hypot(delta.x, delta.y)};
+  if (length == 0.0f) return;
+  // Half the width, perpendicular to the line
+  const sf::Vector2f normal{
+    -delta.y / length * width / 2.0f,
+    delta.x / length * width / 2.0f
+  };
+  vertices.append(sf::Vertex(from + normal, color));
+  vertices.append(sf::Vertex(to + normal, color));
+  vertices.append(sf::Vertex(to - normal, color));
+  vertices.append(sf::Vertex(from + normal, color));
+  vertices.append(sf::Vertex(to - normal, color));
+  vertices.append(sf::Vertex(from - normal, color));
+}
+
+void add_outline(
+  sf::VertexArray& vertices,
+  const sf::FloatRect& screen_rect,
+  const float thickness,
+  const sf::Color& color
+)
+{
+  const float left{screen_rect.left - thickness};
+  const float top{screen_rect.top - thickness};
+  const float outer_width{screen_rect.width + (2.0f * thickness)};
+  const float outer_height{screen_rect.height + (2.0f * thickness)};
+  add_quad(vertices, sf::FloatRect(left, top, outer_width, thickness), color);
+  add_quad(vertices, sf::FloatRect(left, top + outer_height - thickness, outer_width, thickness), color);
+  add_quad(vertices, sf::FloatRect(left, screen_rect.top, thickness, screen_rect.height), color);
+  add_quad(vertices, sf::FloatRect(left + outer_width - thickness, screen_rect.top, thickness, screen_rect.height), color);
+}
+
+void add_quad(
+  sf::VertexArray& vertices,
+  const sf::FloatRect& screen_rect,
+  const sf::FloatRect& texture_rect,
+  const sf::Color& color
+)
+{
+  assert(vertices.getPrimitiveType() == sf::Triangles);
+  const float left{screen_rect.left};
+  const float top{screen_rect.top};
+  const float right{screen_rect.left + screen_rect.width};
+  const float bottom{screen_rect.top + screen_rect.height};
+  const float tex_left{texture_rect.left};
+  const float tex_top{texture_rect.top};
+  const float tex_right{texture_rect.left + texture_rect.width};
+  const float tex_bottom{texture_rect.top + texture_rect.height};
+  const sf::Vertex tl(sf::Vector2f(left, top), color, sf::Vector2f(tex_left, tex_top));
+  const sf::Vertex tr(sf::Vector2f(right, top), color, sf::Vector2f(tex_right, tex_top));
+  const sf::Vertex br(sf::Vector2f(right, bottom), color, sf::Vector2f(tex_right, tex_bottom));
+  const sf::Vertex bl(sf::Vector2f(left, bottom), color, sf::Vector2f(tex_left, tex_bottom));
+  vertices.append(tl);
+  vertices.append(tr);
+  vertices.append(br);
+  vertices.append(tl);
+  vertices.append(br);
+  vertices.append(bl);
+}
+
+void add_quad(
+  sf::VertexArray& vertices,
+  const sf::FloatRect& screen_rect,
+  const sf::Color& color
+)
+{
+  add_quad(vertices, screen_rect, sf::FloatRect(), color);
+}
+
+#endif // LOGIC_ONLY
+
 sf::Color f_health_to_color(const double f)
 {
   assert(f >= 0.0);
@@ -77,18 +189,12 @@ void show_pieces(
 {
   const int square_width{1 + get_width(rect) / 8};
   const int square_height{1 + get_height(rect) / 8};
+  const auto& textures{resources.get_piece_textures()};
+  sf::VertexArray sprites(sf::Triangles);
+  sf::VertexArray outlines(sf::Triangles);
   for (const auto& piece: pieces)
   {
-    sf::RectangleShape sprite;
-    sprite.setSize(sf::Vector2f(0.9 * square_width, 0.9 * square_height));
-    sprite.setTexture(
-      &get_piece(
-        resources,
-        piece.get_race(),
-        piece.get_color(),
-        piece.get_type()
-      )
-    );
+    sf::Color color{sf::Color::White};
     // Transparency effect when moving
     if (!piece.get_actions().empty()
       && piece.get_actions()[0].get_action_type() == piece_action_type::move
@@ -104,18 +210,8 @@ void show_pieces(
       {
         alpha = static_cast<int>(f * 255.0);
       }
-      sprite.setFillColor(sf::Color(255, 255, 255, alpha));
-    }
-    else
-    {
-      //sprite.setFillColor(sf::Color(0, 0, 0, 255));
+      color.a = alpha;
     }
-    if (show_selected && piece.is_selected())
-    {
-      sprite.setOutlineColor(sf::Color(255, 0, 0));
-      sprite.setOutlineThickness(2);
-    }
-    sprite.setOrigin(sf::Vector2f(0.45 * square_width, 0.45 * square_height));
     const game_coordinat game_pos{
       to_coordinat(piece.get_current_square()) + game_coordinat(0.0, 0.1)
     };
@@ -123,16 +219,29 @@ void show_pieces(
       rect.get_tl().get_x() + static_cast<int>(game_pos.get_x() * square_width),
       rect.get_tl().get_y() + static_cast<int>(game_pos.get_y() * square_height),
     };
-    sprite.setPosition(
-      screen_position.get_x(),
-      screen_position.get_y()
+    const sf::FloatRect sprite_rect(
+      screen_position.get_x() - (0.45 * square_width),
+      screen_position.get_y() - (0.45 * square_height),
+      0.9 * square_width,
+      0.9 * square_height
+    );
+    add_quad(
+      sprites,
+      sprite_rect,
+      textures.get_rect(piece.get_race(), piece.get_color(), piece.get_type()),
+      color
     );
-    window.draw(sprite);
+    if (show_selected && piece.is_selected())
+    {
+      add_outline(outlines, sprite_rect, 2.0f, sf::Color(255, 0, 0));
+    }
   }
+  window.draw(sprites, &textures.get_atlas().get_texture());
+  window.draw(outlines);
 }
 
 void show_squares(
-  sf::RenderWindow& window,
+  sf::RenderTarget& target,
   const screen_rect& rect,
   game_resources& resources,
   const bool semi_transparent
@@ -140,28 +249,30 @@ void show_squares(
 {
   const int square_width{1 + (get_width(rect) / 8)};
   const int square_height{1 + (get_height(rect) / 8)};
-  sf::RectangleShape black_square;
-  sf::RectangleShape white_square;
-  black_square.setSize(sf::Vector2f(square_width, square_height));
-  black_square.setOrigin(sf::Vector2f(square_width / 2.0, square_height / 2.0));
-  white_square.setSize(sf::Vector2f(square_width, square_height));
-  white_square.setOrigin(sf::Vector2f(square_width / 2.0, square_height / 2.0));
-  if (semi_transparent)
-  {
-    black_square.setTexture(&resources.get_textures().get_semitransparent_square(chess_color::black));
-    white_square.setTexture(&resources.get_textures().get_semitransparent_square(chess_color::white));
-  }
-  else
-  {
-    black_square.setTexture(&resources.get_textures().get_square(chess_color::black));
-    white_square.setTexture(&resources.get_textures().get_square(chess_color::white));
-  }
-
+  const sf::Texture& black_texture{
+    semi_transparent
+    ? resources.get_textures().get_semitransparent_square(chess_color::black)
+    : resources.get_textures().get_square(chess_color::black)
+  };
+  const sf::Texture& white_texture{
+    semi_transparent
+    ? resources.get_textures().get_semitransparent_square(chess_color::white)
+    : resources.get_textures().get_square(chess_color::white)
+  };
+  const auto get_texture_rect{
+    [](const sf::Texture& t)
+    {
+      return sf::FloatRect(0.0f, 0.0f, t.getSize().x, t.getSize().y);
+    }
+  };
+  // One batch per texture
+  sf::VertexArray black_squares(sf::Triangles);
+  sf::VertexArray white_squares(sf::Triangles);
   for (int x = 0; x != 8; ++x)
   {
     for (int y = 0; y != 8; ++y)
     {
-      sf::RectangleShape& s = (x + y) % 2 == 0 ? black_square : white_square;
+      const bool is_black{(x + y) % 2 == 0};
       const screen_coordinat square_pos{
         static_cast<int>(
           rect.get_tl().get_x() + ((0.5 + x) * square_width)
@@ -170,10 +281,39 @@ void show_squares(
           rect.get_tl().get_y() + ((0.5 + y) * square_height)
         )
       };
-      s.setPosition(square_pos.get_x(), square_pos.get_y());
-      window.draw(s);
+      add_quad(
+        is_black ? black_squares : white_squares,
+        sf::FloatRect(
+          square_pos.get_x() - (square_width / 2.0),
+          square_pos.get_y() - (square_height / 2.0),
+          square_width,
+          square_height
+        ),
+        get_texture_rect(is_black ? black_texture : white_texture)
+      );
     }
   }
+  target.draw(black_squares, &black_texture);
+  target.draw(white_squares, &white_texture);
+}
+
+bool wait_for_event(
+  sf::RenderWindow& window,
+  sf::Event& event,
+  const sf::Time& timeout
+)
+{
+  // SFML 2 has no timeout for waiting on an event,
+  // so poll, sleeping in between
+  const sf::Time poll_interval{sf::milliseconds(10)};
+  sf::Clock clock;
+  while (!window.pollEvent(event))
+  {
+    const sf::Time elapsed{clock.getElapsedTime()};
+    if (elapsed >= timeout) return false;
+    sf::sleep(std::min(timeout - elapsed, poll_interval));
+  }
+  return true;
 }
 #endif
 
@@ -20,11 +20,59 @@ void set_rect(sf::RectangleShape& rectangle, const screen_coordinat& screen_size
 void set_rect(sf::RectangleShape& rectangle, const screen_rect& screen_rect);
 
 #ifndef LOGIC_ONLY
+/// Add a filled circle to the vertices, as a fan of triangles,
+/// so 'vertices' must be of type sf::Triangles.
+/// Uses as many points as sf::CircleShape does by default
+void add_circle(
+  sf::VertexArray& vertices,
+  const sf::Vector2f& center,
+  const float radius,
+  const sf::Color& color,
+  const int n_points = 30
+);
+
+/// Add a straight line of some width to the vertices,
+/// as a rotated rectangle from 'from' to 'to',
+/// so 'vertices' must be of type sf::Triangles
+void add_line(
+  sf::VertexArray& vertices,
+  const sf::Vector2f& from,
+  const sf::Vector2f& to,
+  const float width,
+  const sf::Color& color
+);
+
+/// Add the outline of a rectangle to the vertices, drawn outside of it,
+/// as sf::RectangleShape::setOutlineThickness does
+void add_outline(
+  sf::VertexArray& vertices,
+  const sf::FloatRect& screen_rect,
+  const float thickness,
+  const sf::Color& color
+);
+
+/// Add a rectangle with (part of) a texture to the vertices,
+/// as two triangles, so 'vertices' must be of type sf::Triangles
+void add_quad(
+  sf::VertexArray& vertices,
+  const sf::FloatRect& screen_rect,
+  const sf::FloatRect& texture_rect,
+  const sf::Color& color = sf::Color::White
+);
+
+/// Add a rectangle of one color to the vertices,
+/// as two triangles, so 'vertices' must be of type sf::Triangles
+void add_quad(
+  sf::VertexArray& vertices,
+  const sf::FloatRect& screen_rect,
+  const sf::Color& color
+);
+
 /// Make 'text' have the same size and position as the 'screen_rect'
 /// Assumes the text already has a font
 void set_text_position(sf::Text& text, const screen_rect& screen_rect);
 
-/// Show the pieces
+/// Show the pieces, in two draw calls
 void show_pieces(
   const std::vector<piece>& pieces,
   sf::RenderWindow& window,
@@ -32,11 +80,22 @@ void show_pieces(
   game_resources& resources,
   const bool show_selected
 );
+
+/// Wait for the next event of the window, for at most the timeout.
+/// Unlike sf::Window::waitEvent, which may wait forever,
+/// this lets a view that waits for its user still be animated.
+/// @return if there was an event
+bool wait_for_event(
+  sf::RenderWindow& window,
+  sf::Event& event,
+  const sf::Time& timeout
+);
 #endif
 
-/// Draw the squares of a chessboard at the window target rectangle's location
+/// Draw the squares of a chessboard at the target rectangle's location,
+/// in one draw call per square color
 void show_squares(
-  sf::RenderWindow& window,
+  sf::RenderTarget& target,
   const screen_rect& rect,
   game_resources& resources,
   const bool semi_transparent
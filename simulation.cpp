@@ -0,0 +1,234 @@
+#include "simulation.h"
+
+#include "computer_player.h"
+#include "physical_controllers.h"
+#include "pieces.h"
+#include "user_input.h"
+#include "user_inputs.h"
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <sstream>
+
+simulation::simulation(
+  const starting_position_type t,
+  const int seed,
+  const delta_t& dt
+) : m_dt{dt},
+    m_game{get_game_with_starting_position(t)},
+    m_game_controller{create_two_keyboard_controllers()},
+    m_n_ticks{0},
+    m_rng(seed)
+{
+  assert(delta_t(0.0) < m_dt);
+}
+
+simulation::simulation(
+  const starting_position_type t,
+  const replay& r,
+  const delta_t& dt
+) : simulation(t, 0, dt)
+{
+  m_replayer = replayer(r);
+}
+
+void simulation::add_random_user_inputs(const chess_color color)
+{
+  const side player_side{get_player_side(m_game, color)};
+  auto& planned_action{
+    color == chess_color::white
+    ? m_planned_white_action
+    : m_planned_black_action
+  };
+  if (planned_action)
+  {
+    // The piece has been selected in an earlier tick, do the action
+    const piece_action action{planned_action.value()};
+    planned_action.reset();
+    const square& from{action.get_from()};
+    if (!is_piece_at(m_game, from)) return;
+    const auto& p{get_piece_at(m_game, from)};
+    if (p.get_color() != color || !p.is_selected()) return;
+    add_user_inputs(
+      m_game_controller,
+      get_user_inputs_to_do_piece_action(m_game_controller, action, player_side)
+    );
+    return;
+  }
+
+  // Pick a random action of an idle piece
+  m_piece_actions.clear();
+  collect_candidate_actions(m_game, color, m_piece_actions);
+  if (m_piece_actions.empty()) return;
+
+  std::uniform_int_distribution<int> distribution(
+    0,
+    static_cast<int>(m_piece_actions.size()) - 1
+  );
+  const piece_action& action{m_piece_actions[distribution(m_rng)]};
+  planned_action = action;
+
+  // An already selected piece can do its action in the next tick
+  if (get_piece_at(m_game, action.get_from()).is_selected()) return;
+
+  // Select the piece
+  add_user_inputs(
+    m_game_controller,
+    get_user_inputs_to_select_piece_at(m_game_controller, action.get_from(), player_side)
+  );
+}
+
+void simulation::set_computer_player(const computer_player& p)
+{
+  const auto there{
+    std::find_if(
+      std::begin(m_computer_players),
+      std::end(m_computer_players),
+      [&p](const computer_player& q) { return q.get_color() == p.get_color(); }
+    )
+  };
+  if (there != std::end(m_computer_players))
+  {
+    *there = p;
+    return;
+  }
+  m_computer_players.push_back(p);
+}
+
+void simulation::tick()
+{
+  if (m_replayer)
+  {
+    m_replayer->do_move(m_game_controller, m_game);
+  }
+  else
+  {
+    for (const auto color: { chess_color::white, chess_color::black })
+    {
+      const auto there{
+        std::find_if(
+          std::begin(m_computer_players),
+          std::end(m_computer_players),
+          [color](const computer_player& p) { return p.get_color() == color; }
+        )
+      };
+      if (there == std::end(m_computer_players))
+      {
+        add_random_user_inputs(color);
+      }
+      else
+      {
+        there->do_move(m_game_controller, m_game);
+      }
+    }
+  }
+  m_game_controller.apply_user_inputs_to_game(m_game);
+  m_game.tick(m_dt);
+  ++m_n_ticks;
+}
+
+std::optional<chess_color> get_winner(const simulation& s) noexcept
+{
+  return get_winner(s.get_game());
+}
+
+bool is_done(const simulation& s) noexcept
+{
+  return get_winner(s).has_value();
+}
+
+void run(simulation& s, const int max_n_ticks)
+{
+  while (s.get_n_ticks() < max_n_ticks && !is_done(s))
+  {
+    s.tick();
+  }
+}
+
+void test_simulation()
+{
+#ifndef NDEBUG
+  // simulation::simulation
+  {
+    const simulation s;
+    assert(s.get_n_ticks() == 0);
+    assert(s.get_delta_t() == delta_t(0.1));
+    assert(!is_done(s));
+    assert(!get_winner(s));
+  }
+  // simulation::simulation from a starting position
+  {
+    const simulation s(starting_position_type::kings_only);
+    assert(s.get_game().get_pieces().size() == 2);
+  }
+  // simulation::tick increases the number of ticks and the game time
+  {
+    simulation s;
+    s.tick();
+    assert(s.get_n_ticks() == 1);
+    assert(s.get_game().get_time() == delta_t(0.1));
+  }
+  // simulation::tick with random user inputs moves pieces
+  {
+    simulation s;
+    run(s, 100);
+    assert(s.get_n_ticks() <= 100);
+    assert(collect_action_history(s.get_game()).get_timed_actions().size() > 0);
+  }
+  // simulation::tick with random user inputs is reproducible
+  {
+    simulation a(starting_position_type::standard, 123);
+    simulation b(starting_position_type::standard, 123);
+    run(a, 100);
+    run(b, 100);
+    assert(a.get_game().get_pieces() == b.get_game().get_pieces());
+  }
+  // simulation::tick with a computer player
+  {
+    simulation s(starting_position_type::before_scholars_mate);
+    s.set_computer_player(computer_player(chess_color::white));
+    assert(s.get_computer_players().size() == 1);
+    // Think without a time limit, so that the result does not depend
+    // on the speed of the machine
+    s.set_computer_player(computer_player(chess_color::white, std::chrono::seconds(10)));
+    assert(s.get_computer_players().size() == 1);
+    run(s, 100);
+    int n_kills{0};
+    for (const auto& p: s.get_game().get_pieces())
+    {
+      if (p.get_color() == chess_color::white) n_kills += p.get_kill_count();
+    }
+    assert(n_kills > 0);
+  }
+  // simulation::tick with a replay
+  {
+    simulation s(starting_position_type::standard, replay("1. e4"));
+    run(s, 10);
+    assert(s.get_n_ticks() == 10);
+  }
+  // run zero ticks does nothing
+  {
+    simulation s;
+    run(s, 0);
+    assert(s.get_n_ticks() == 0);
+  }
+  // operator<<
+  {
+    const simulation s;
+    std::stringstream str;
+    str << s;
+    assert(!str.str().empty());
+  }
+#endif // NDEBUG
+}
+
+std::ostream& operator<<(std::ostream& os, const simulation& s) noexcept
+{
+  os
+    << "Number of ticks: " << s.get_n_ticks() << '\n'
+    << "Delta t: " << s.get_delta_t() << '\n'
+    << "Game: " << s.get_game()
+  ;
+  return os;
+}
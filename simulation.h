@@ -0,0 +1,117 @@
+#ifndef SIMULATION_H
+#define SIMULATION_H
+
+#include "ccfwd.h"
+#include "computer_player.h"
+#include "delta_t.h"
+#include "game.h"
+#include "game_controller.h"
+#include "piece_action.h"
+#include "replayer.h"
+#include "starting_position_type.h"
+
+#include <iosfwd>
+#include <optional>
+#include <random>
+#include <vector>
+
+/// A game that is played without a window,
+/// as fast as the CPU allows.
+///
+/// Each tick, user inputs are created,
+/// either by a \link{replayer}, by \link{computer_player}s or randomly,
+/// these are applied to the game,
+/// after which the game is ticked with a fixed \link{delta_t}
+class simulation
+{
+public:
+  /// Simulate a game in which both players do random actions
+  explicit simulation(
+    const starting_position_type t = get_default_starting_position(),
+    const int seed = 42,
+    const delta_t& dt = delta_t(0.1)
+  );
+
+  /// Simulate a game in which the moves of a replay are done
+  simulation(
+    const starting_position_type t,
+    const replay& r,
+    const delta_t& dt = delta_t(0.1)
+  );
+
+  /// Get the time step of each tick
+  const auto& get_delta_t() const noexcept { return m_dt; }
+
+  const auto& get_game() const noexcept { return m_game; }
+
+  const auto& get_game_controller() const noexcept { return m_game_controller; }
+
+  /// Get the computer players
+  const auto& get_computer_players() const noexcept { return m_computer_players; }
+
+  /// Get the number of ticks done
+  int get_n_ticks() const noexcept { return m_n_ticks; }
+
+  /// Let a computer player play its color,
+  /// instead of doing random actions
+  void set_computer_player(const computer_player& p);
+
+  /// Create the user inputs, apply these and tick the game
+  void tick();
+
+private:
+
+  /// The computer players, at most one per color
+  std::vector<computer_player> m_computer_players;
+
+  /// The time step of each tick
+  delta_t m_dt;
+
+  /// The game logic
+  game m_game;
+
+  /// The game controller, interacts with game
+  game_controller m_game_controller;
+
+  /// The number of ticks done
+  int m_n_ticks;
+
+  /// The buffer to collect the piece actions in, reused every tick
+  std::vector<piece_action> m_piece_actions;
+
+  /// The action black will do, after its piece has been selected
+  std::optional<piece_action> m_planned_black_action;
+
+  /// The action white will do, after its piece has been selected
+  std::optional<piece_action> m_planned_white_action;
+
+  /// Does the moves of a replay. If absent, the moves are random
+  std::optional<replayer> m_replayer;
+
+  /// The random number generator for the random actions
+  std::default_random_engine m_rng;
+
+  /// Add the user inputs for a random action of a player.
+  /// This takes two ticks: one to select a piece,
+  /// one to let it do its action
+  void add_random_user_inputs(const chess_color color);
+};
+
+/// Get the winner of a simulated game,
+/// i.e. the color of the only king left.
+/// Returns an empty optional if both (or no) kings are left
+std::optional<chess_color> get_winner(const simulation& s) noexcept;
+
+/// Has the simulated game ended, i.e. has a king been captured?
+bool is_done(const simulation& s) noexcept;
+
+/// Tick the simulation until it is done
+/// or until it has been ticked 'max_n_ticks' times in total
+void run(simulation& s, const int max_n_ticks);
+
+/// Test this class and its free functions
+void test_simulation();
+
+std::ostream& operator<<(std::ostream& os, const simulation& s) noexcept;
+
+#endif // SIMULATION_H
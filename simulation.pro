@@ -0,0 +1,39 @@
+# Project file to simulate games without a window,
+# to soak-test the game logic at high speed.
+#
+# Usage: ./conquer_chess_simulation [n_games] [max_n_ticks] [starting_position] [n_threads]
+
+DEFINES += LOGIC_ONLY
+
+# All files are in here, the rest are just settings
+include(game.pri)
+
+SOURCES += simulation_main.cpp
+
+TARGET = conquer_chess_simulation
+
+CONFIG += console thread
+CONFIG -= app_bundle
+
+# Use the C++ version that all team members can use
+CONFIG += c++17
+QMAKE_CXXFLAGS += -std=c++17
+
+# High warning levels
+QMAKE_CXXFLAGS += -Wall -Wextra -Wshadow -Wnon-virtual-dtor -pedantic
+
+# Debug and release settings
+CONFIG += debug_and_release
+CONFIG(release, debug|release) {
+  DEFINES += NDEBUG
+  QMAKE_CXXFLAGS += -O3
+}
+CONFIG(debug, debug|release) {
+  # A warning is an error
+  QMAKE_CXXFLAGS += -Werror
+}
+
+# Qt5, for the resources
+QT += core
+
+LIBS += -lsfml-graphics -lsfml-window -lsfml-system -lsfml-audio -lsfml-network
@@ -0,0 +1,67 @@
+/// Simulate games without a window, as fast as possible,
+/// to test the game logic at many ticks.
+///
+/// Usage:
+///
+///   conquer_chess_simulation [n_games] [max_n_ticks] [starting_position] [n_threads]
+///
+/// where 'starting_position' is as in 'to_str(starting_position_type)',
+/// e.g. 'standard' or 'kings_only'.
+/// By default, as many threads are used as there are cores
+
+#include "simulation.h"
+#include "simulation_result.h"
+#include "simulations.h"
+#include "starting_position_type.h"
+
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+starting_position_type to_starting_position_type(const std::string& s)
+{
+  for (const auto t: get_all_starting_position_types())
+  {
+    if (to_str(t) == s) return t;
+  }
+  throw std::invalid_argument("Unknown starting position: '" + s + "'");
+}
+
+int main(int argc, char **argv)
+{
+  const std::vector<std::string> args(argv, argv + argc);
+  const int n_games{args.size() > 1 ? std::stoi(args[1]) : 10};
+  const int max_n_ticks{args.size() > 2 ? std::stoi(args[2]) : 10000};
+  const starting_position_type t{
+    args.size() > 3
+    ? to_starting_position_type(args[3])
+    : get_default_starting_position()
+  };
+  const int n_threads{args.size() > 4 ? std::stoi(args[4]) : get_n_threads()};
+
+  auto simulations{create_simulations(t, n_games)};
+  const auto start{std::chrono::steady_clock::now()};
+  const auto results{run_in_parallel(simulations, max_n_ticks, n_threads)};
+  const std::chrono::duration<double> duration{
+    std::chrono::steady_clock::now() - start
+  };
+  const double n_secs{duration.count()};
+  const long long n_ticks{count_ticks(results)};
+
+  std::cout
+    << "Starting position: " << t << '\n'
+    << "Number of games: " << n_games << '\n'
+    << "Number of threads: " << n_threads << '\n'
+    << "Number of ticks: " << n_ticks << '\n'
+    << "White wins: " << count_wins(results, chess_color::white) << '\n'
+    << "Black wins: " << count_wins(results, chess_color::black) << '\n'
+    << "Draws: " << count_draws(results) << '\n'
+    << "Kills by white: " << count_kills(results, chess_color::white) << '\n'
+    << "Kills by black: " << count_kills(results, chess_color::black) << '\n'
+    << "Duration (secs): " << n_secs << '\n'
+    << "Ticks per second: " << (n_ticks / n_secs) << '\n'
+    << "Games per second: " << (n_games / n_secs) << '\n'
+  ;
+}
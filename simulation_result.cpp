@@ -0,0 +1,146 @@
+#include "simulation_result.h"
+
+#include "game.h"
+#include "simulation.h"
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+
+int sum_kill_counts(const game& g, const chess_color color) noexcept
+{
+  int sum{0};
+  for (const auto& p: g.get_pieces())
+  {
+    if (p.get_color() == color) sum += p.get_kill_count();
+  }
+  return sum;
+}
+
+simulation_result::simulation_result(const simulation& s)
+  : m_black_kill_count{sum_kill_counts(s.get_game(), chess_color::black)},
+    m_n_ticks{s.get_n_ticks()},
+    m_white_kill_count{sum_kill_counts(s.get_game(), chess_color::white)},
+    m_winner{::get_winner(s)}
+{
+
+}
+
+int count_draws(const std::vector<simulation_result>& results) noexcept
+{
+  return std::count_if(
+    std::begin(results),
+    std::end(results),
+    [](const simulation_result& r) { return !r.get_winner(); }
+  );
+}
+
+int count_kills(
+  const std::vector<simulation_result>& results,
+  const chess_color color
+) noexcept
+{
+  return std::accumulate(
+    std::begin(results),
+    std::end(results),
+    0,
+    [color](const int sum, const simulation_result& r)
+    {
+      return sum + r.get_kill_count(color);
+    }
+  );
+}
+
+long long count_ticks(const std::vector<simulation_result>& results) noexcept
+{
+  return std::accumulate(
+    std::begin(results),
+    std::end(results),
+    0LL,
+    [](const long long sum, const simulation_result& r)
+    {
+      return sum + r.get_n_ticks();
+    }
+  );
+}
+
+int count_wins(
+  const std::vector<simulation_result>& results,
+  const chess_color color
+) noexcept
+{
+  return std::count_if(
+    std::begin(results),
+    std::end(results),
+    [color](const simulation_result& r) { return r.get_winner() == color; }
+  );
+}
+
+int simulation_result::get_kill_count(const chess_color color) const noexcept
+{
+  if (color == chess_color::white) return m_white_kill_count;
+  assert(color == chess_color::black);
+  return m_black_kill_count;
+}
+
+void test_simulation_result()
+{
+#ifndef NDEBUG
+  // simulation_result::simulation_result
+  {
+    const simulation s;
+    const simulation_result r(s);
+    assert(r.get_n_ticks() == 0);
+    assert(!r.get_winner());
+    assert(r.get_kill_count(chess_color::white) == 0);
+    assert(r.get_kill_count(chess_color::black) == 0);
+  }
+  // count_draws, count_kills, count_ticks and count_wins
+  {
+    simulation s;
+    s.tick();
+    const std::vector<simulation_result> results(3, simulation_result(s));
+    assert(count_draws(results) == 3);
+    assert(count_kills(results, chess_color::white) == 0);
+    assert(count_ticks(results) == 3);
+    assert(count_wins(results, chess_color::white) == 0);
+    assert(count_wins(results, chess_color::black) == 0);
+  }
+  // operator==
+  {
+    const simulation s;
+    const simulation_result a(s);
+    const simulation_result b(s);
+    assert(a == b);
+  }
+  // operator<<
+  {
+    const simulation_result r{simulation()};
+    std::stringstream str;
+    str << r;
+    assert(!str.str().empty());
+  }
+#endif // NDEBUG
+}
+
+bool operator==(const simulation_result& lhs, const simulation_result& rhs) noexcept
+{
+  return lhs.get_kill_count(chess_color::black) == rhs.get_kill_count(chess_color::black)
+    && lhs.get_kill_count(chess_color::white) == rhs.get_kill_count(chess_color::white)
+    && lhs.get_n_ticks() == rhs.get_n_ticks()
+    && lhs.get_winner() == rhs.get_winner()
+  ;
+}
+
+std::ostream& operator<<(std::ostream& os, const simulation_result& r) noexcept
+{
+  os
+    << "Number of ticks: " << r.get_n_ticks() << '\n'
+    << "Winner: " << (r.get_winner() ? to_str(r.get_winner().value()) : "none") << '\n'
+    << "Kills by black: " << r.get_kill_count(chess_color::black) << '\n'
+    << "Kills by white: " << r.get_kill_count(chess_color::white)
+  ;
+  return os;
+}
@@ -0,0 +1,67 @@
+#ifndef SIMULATION_RESULT_H
+#define SIMULATION_RESULT_H
+
+#include "ccfwd.h"
+#include "chess_color.h"
+
+#include <iosfwd>
+#include <optional>
+#include <vector>
+
+/// The result of a \link{simulation}
+class simulation_result
+{
+public:
+  explicit simulation_result(const simulation& s);
+
+  /// Get the number of pieces killed by the pieces of a color
+  /// that are still alive at the end of the simulation
+  int get_kill_count(const chess_color color) const noexcept;
+
+  /// Get the number of ticks the simulation took
+  int get_n_ticks() const noexcept { return m_n_ticks; }
+
+  /// Get the winner, if any
+  const auto& get_winner() const noexcept { return m_winner; }
+
+private:
+
+  /// The number of pieces killed by the remaining black pieces
+  int m_black_kill_count;
+
+  /// The number of ticks the simulation took
+  int m_n_ticks;
+
+  /// The number of pieces killed by the remaining white pieces
+  int m_white_kill_count;
+
+  /// The winner, if any
+  std::optional<chess_color> m_winner;
+};
+
+/// Count the number of simulations without a winner
+int count_draws(const std::vector<simulation_result>& results) noexcept;
+
+/// Count the total number of pieces killed by a color
+int count_kills(
+  const std::vector<simulation_result>& results,
+  const chess_color color
+) noexcept;
+
+/// Count the total number of ticks
+long long count_ticks(const std::vector<simulation_result>& results) noexcept;
+
+/// Count the number of simulations won by a color
+int count_wins(
+  const std::vector<simulation_result>& results,
+  const chess_color color
+) noexcept;
+
+/// Test this class and its free functions
+void test_simulation_result();
+
+bool operator==(const simulation_result& lhs, const simulation_result& rhs) noexcept;
+
+std::ostream& operator<<(std::ostream& os, const simulation_result& r) noexcept;
+
+#endif // SIMULATION_RESULT_H
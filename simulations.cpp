@@ -0,0 +1,121 @@
+#include "simulations.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <thread>
+
+std::vector<simulation> create_simulations(
+  const starting_position_type t,
+  const int n_simulations
+)
+{
+  assert(n_simulations >= 0);
+  std::vector<simulation> simulations;
+  simulations.reserve(n_simulations);
+  for (int i{0}; i != n_simulations; ++i)
+  {
+    simulations.push_back(simulation(t, i));
+  }
+  return simulations;
+}
+
+void do_in_parallel(
+  const int n_jobs,
+  const std::function<void(int)>& job,
+  const int n_threads
+)
+{
+  assert(n_jobs >= 0);
+  assert(n_threads >= 1);
+
+  // The index of the next job to be done
+  std::atomic<int> next_index{0};
+  const auto do_next_jobs = [&]()
+  {
+    for (int i{next_index++}; i < n_jobs; i = next_index++)
+    {
+      job(i);
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(n_threads - 1);
+  for (int i{1}; i < n_threads; ++i)
+  {
+    threads.emplace_back(do_next_jobs);
+  }
+  do_next_jobs();
+  for (auto& t: threads) t.join();
+}
+
+int get_n_threads() noexcept
+{
+  return std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+}
+
+std::vector<simulation_result> run_in_parallel(
+  std::vector<simulation>& simulations,
+  const int max_n_ticks,
+  const int n_threads
+)
+{
+  const int n_simulations{static_cast<int>(simulations.size())};
+  do_in_parallel(
+    n_simulations,
+    [&simulations, max_n_ticks](const int i) { run(simulations[i], max_n_ticks); },
+    n_threads
+  );
+
+  std::vector<simulation_result> results;
+  results.reserve(n_simulations);
+  for (const auto& s: simulations)
+  {
+    results.push_back(simulation_result(s));
+  }
+  return results;
+}
+
+void test_simulations()
+{
+#ifndef NDEBUG
+  // create_simulations
+  {
+    const auto simulations{
+      create_simulations(starting_position_type::kings_only, 3)
+    };
+    assert(simulations.size() == 3);
+  }
+  // do_in_parallel does each job once
+  {
+    std::vector<int> n_done(100, 0);
+    do_in_parallel(100, [&n_done](const int i) { ++n_done[i]; }, 4);
+    assert(std::count(std::begin(n_done), std::end(n_done), 1) == 100);
+  }
+  // do_in_parallel with zero jobs
+  {
+    do_in_parallel(0, [](const int) { assert(!"Should not get here"); });
+  }
+  // get_n_threads
+  {
+    assert(get_n_threads() >= 1);
+  }
+  // run_in_parallel gives the same results as running one by one
+  {
+    auto simulations{create_simulations(starting_position_type::kings_only, 4)};
+    const auto results{run_in_parallel(simulations, 20, 2)};
+    assert(results.size() == 4);
+    for (int i{0}; i != 4; ++i)
+    {
+      simulation s(starting_position_type::kings_only, i);
+      run(s, 20);
+      assert(results[i] == simulation_result(s));
+    }
+  }
+  // run_in_parallel on zero simulations
+  {
+    std::vector<simulation> simulations;
+    assert(run_in_parallel(simulations, 20).empty());
+  }
+#endif // NDEBUG
+}
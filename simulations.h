@@ -0,0 +1,48 @@
+#ifndef SIMULATIONS_H
+#define SIMULATIONS_H
+
+#include "ccfwd.h"
+#include "simulation.h"
+#include "simulation_result.h"
+#include "starting_position_type.h"
+
+#include <functional>
+#include <vector>
+
+/// Create simulations with random user inputs,
+/// where the simulation at index i uses seed i
+std::vector<simulation> create_simulations(
+  const starting_position_type t,
+  const int n_simulations
+);
+
+/// Get the number of threads that can run concurrently,
+/// which is at least one
+int get_n_threads() noexcept;
+
+/// Do 'n_jobs' independent jobs in parallel, by calling 'job' with
+/// each index from zero to 'n_jobs'.
+/// Each thread takes the next job not yet taken,
+/// until all jobs have been done.
+/// The calling thread is one of the 'n_threads' threads
+void do_in_parallel(
+  const int n_jobs,
+  const std::function<void(int)>& job,
+  const int n_threads = get_n_threads()
+);
+
+/// Run all simulations until each is done
+/// or has been ticked 'max_n_ticks' times in total.
+/// The simulations are independent, hence are run in parallel,
+/// see \link{do_in_parallel}.
+/// The result at index i is the result of the simulation at index i
+std::vector<simulation_result> run_in_parallel(
+  std::vector<simulation>& simulations,
+  const int max_n_ticks,
+  const int n_threads = get_n_threads()
+);
+
+/// Test these functions
+void test_simulations();
+
+#endif // SIMULATIONS_H
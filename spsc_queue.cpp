@@ -0,0 +1,77 @@
+#include "spsc_queue.h"
+
+#include <string>
+#include <thread>
+
+void test_spsc_queue()
+{
+#ifndef NDEBUG // no tests in release
+  // A new queue is empty
+  {
+    spsc_queue<int> q(3);
+    assert(q.empty());
+    assert(q.capacity() == 3);
+    int x{42};
+    assert(!q.pop(x));
+    assert(x == 42);
+  }
+  // Values are popped in the order pushed
+  {
+    spsc_queue<std::string> q(3);
+    assert(q.push("a"));
+    assert(q.push("b"));
+    assert(!q.empty());
+    std::string s;
+    assert(q.pop(s));
+    assert(s == "a");
+    assert(q.pop(s));
+    assert(s == "b");
+    assert(q.empty());
+  }
+  // A full queue refuses a value
+  {
+    spsc_queue<int> q(2);
+    assert(q.push(1));
+    assert(q.push(2));
+    assert(!q.push(3));
+    int x{0};
+    assert(q.pop(x));
+    assert(x == 1);
+    assert(q.push(3));
+  }
+  // The ring buffer wraps around
+  {
+    spsc_queue<int> q(2);
+    for (int i{0}; i != 10; ++i)
+    {
+      assert(q.push(i));
+      int x{-1};
+      assert(q.pop(x));
+      assert(x == i);
+    }
+    assert(q.empty());
+  }
+  // One thread pushes while another pops, no value is lost or reordered
+  {
+    spsc_queue<int> q(16);
+    const int n{100000};
+    std::thread producer(
+      [&q, n]()
+      {
+        for (int i{0}; i != n; ++i)
+        {
+          while (!q.push(i)) std::this_thread::yield();
+        }
+      }
+    );
+    for (int i{0}; i != n; ++i)
+    {
+      int x{-1};
+      while (!q.pop(x)) std::this_thread::yield();
+      assert(x == i);
+    }
+    producer.join();
+    assert(q.empty());
+  }
+#endif
+}
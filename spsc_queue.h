@@ -0,0 +1,85 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+/// A lock-free queue of a fixed capacity,
+/// for one thread that pushes and one other thread that pops.
+///
+/// The values are stored in a ring buffer with one unused slot,
+/// so that a full queue can be told apart from an empty one.
+/// Each index is written by one thread only,
+/// so no compare-and-swap is needed
+template <class T>
+class spsc_queue
+{
+public:
+  explicit spsc_queue(const int capacity)
+    : m_buffer(capacity + 1), m_head{0}, m_tail{0}
+  {
+    assert(capacity > 0);
+  };
+
+  /// Get the maximum number of values the queue can hold
+  int capacity() const noexcept { return static_cast<int>(m_buffer.size()) - 1; };
+
+  /// Is the queue empty?
+  /// The answer may be outdated as soon as it is given,
+  /// unless this is called by the thread that pops
+  bool empty() const noexcept
+  {
+    return m_head.load(std::memory_order_acquire)
+      == m_tail.load(std::memory_order_acquire)
+    ;
+  };
+
+  /// Take the value at the front of the queue.
+  /// Must only be called by the thread that pops.
+  /// @return false if the queue is empty, leaving 'value' unchanged
+  bool pop(T& value)
+  {
+    const std::size_t head{m_head.load(std::memory_order_relaxed)};
+    if (head == m_tail.load(std::memory_order_acquire)) return false;
+    value = m_buffer[head];
+    m_head.store(get_next(head), std::memory_order_release);
+    return true;
+  };
+
+  /// Add a value at the back of the queue.
+  /// Must only be called by the thread that pushes.
+  /// @return false if the queue is full, in which case nothing is added
+  bool push(const T& value)
+  {
+    const std::size_t tail{m_tail.load(std::memory_order_relaxed)};
+    const std::size_t next{get_next(tail)};
+    if (next == m_head.load(std::memory_order_acquire)) return false;
+    m_buffer[tail] = value;
+    m_tail.store(next, std::memory_order_release);
+    return true;
+  };
+
+private:
+
+  /// The ring buffer
+  std::vector<T> m_buffer;
+
+  /// The index of the value to pop next, written by the thread that pops
+  std::atomic<std::size_t> m_head;
+
+  /// The index to push the next value to, written by the thread that pushes
+  std::atomic<std::size_t> m_tail;
+
+  /// Get the index after 'i', wrapping around
+  std::size_t get_next(const std::size_t i) const noexcept
+  {
+    return i + 1 == m_buffer.size() ? 0 : i + 1;
+  };
+};
+
+/// Test our spsc_queue class
+void test_spsc_queue();
+
+#endif // SPSC_QUEUE_H
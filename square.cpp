@@ -1,5 +1,6 @@
 #include "square.h"
 
+#include "bitboard.h"
 #include "game_coordinat.h"
 #include "game_rect.h"
 #include "helper.h"
@@ -10,28 +11,29 @@
 #include <iterator>
 #include <regex>
 #include <sstream>
+#include <type_traits>
 
 square::square(const std::string& pos)
+  : m_index{0}
 {
   assert(pos.size() == 2);
   assert(std::regex_match(pos, std::regex("^[a-h][1-8]$")));
-  m_y = pos[0] - 'a';
-  m_x = pos[1] - '1';
-  assert(is_valid_square_xy(m_x, m_y));
+  *this = square(pos.at(1) - '1', pos.at(0) - 'a');
 }
 
 square::square(const game_coordinat& g)
-  : m_x{static_cast<int>(std::trunc(g.get_x()))},
-    m_y{static_cast<int>(std::trunc(g.get_y()))}
+  : square(
+      static_cast<int>(std::trunc(g.get_x())),
+      static_cast<int>(std::trunc(g.get_y()))
+    )
 {
   assert(is_coordinat_on_board(g)); // Test the input
-  assert(is_valid_square_xy(m_x, m_y)); //
 }
 
 square::square(const int x, const int y)
-  : m_x{x}, m_y{y}
+  : m_index{static_cast<std::int8_t>((x * 8) + y)}
 {
-  assert(is_valid_square_xy(m_x, m_y));
+  assert(is_valid_square_xy(x, y));
 }
 
 bool are_adjacent(const square& a, const square& b) noexcept
@@ -101,51 +103,16 @@ std::vector<std::pair<int, int>> collect_all_bishop_delta_pairs() noexcept
 std::vector<std::vector<square>> collect_all_bishop_target_squares(const square& s) noexcept
 {
   std::vector<std::vector<square>> targetses; // Reduplicated plural
-  const auto x{s.get_x()};
-  const auto y{s.get_y()};
-
-  const std::vector<std::pair<int, int>> delta_pairs{
-    collect_all_bishop_delta_pairs()
-  };
-  for (const auto& delta_pair: delta_pairs)
+  for (const auto& delta_pair: collect_all_bishop_delta_pairs())
   {
-    std::vector<square> targets;
-    for (int distance{1}; distance != 8; ++distance)
-    {
-      const int new_x{x + (delta_pair.first * distance)};
-      const int new_y{y + (delta_pair.second * distance)};
-      if (is_valid_square_xy(new_x, new_y))
-      {
-        targets.push_back(square(new_x, new_y));
-      }
-    }
-    targetses.push_back(targets);
+    targetses.push_back(get_ray_squares(s, delta_pair.first, delta_pair.second));
   }
   return targetses;
 }
 
 std::vector<square> collect_all_king_target_squares(const square& s) noexcept
 {
-  std::vector<square> targets;
-  std::vector<std::pair<int, int>> delta_pairs{
-    std::make_pair( 0, -1), // N
-    std::make_pair( 1, -1), // NE
-    std::make_pair( 1,  0), // E
-    std::make_pair( 1,  1), // SE
-    std::make_pair( 0,  1), // S
-    std::make_pair(-1,  1), // SW
-    std::make_pair(-1,  0), // W
-    std::make_pair(-1, -1)  // SE
-  };
-  for (const auto& delta_pair: delta_pairs)
-  {
-    const int x{s.get_x() + delta_pair.first};
-    const int y{s.get_y() + delta_pair.second};
-    if (is_valid_square_xy(x, y))
-    {
-      targets.push_back(square(x, y));
-    }
-  }
+  const std::vector<square> targets{to_squares(get_king_attacks(s))};
   assert(!targets.empty());
   return targets;
 }
@@ -167,19 +134,7 @@ std::vector<std::pair<int, int>> collect_all_knight_delta_pairs() noexcept
 
 std::vector<square> collect_all_knight_target_squares(const square& s) noexcept
 {
-  std::vector<square> targets;
-  const std::vector<std::pair<int, int>> delta_pairs{
-    collect_all_knight_delta_pairs()
-  };
-  for (const auto& delta_pair: delta_pairs)
-  {
-    const int x{s.get_x() + delta_pair.first};
-    const int y{s.get_y() + delta_pair.second};
-    if (is_valid_square_xy(x, y))
-    {
-      targets.push_back(square(x, y));
-    }
-  }
+  const std::vector<square> targets{to_squares(get_knight_attacks(s))};
   assert(!targets.empty());
   return targets;
 }
@@ -201,25 +156,9 @@ std::vector<std::pair<int, int>> collect_all_queen_delta_pairs() noexcept
 std::vector<std::vector<square>> collect_all_queen_target_squares(const square& s) noexcept
 {
   std::vector<std::vector<square>> targetses; // Reduplicated plural
-  const auto x{s.get_x()};
-  const auto y{s.get_y()};
-
-  const std::vector<std::pair<int, int>> delta_pairs{
-    collect_all_queen_delta_pairs()
-  };
-  for (const auto& delta_pair: delta_pairs)
+  for (const auto& delta_pair: collect_all_queen_delta_pairs())
   {
-    std::vector<square> targets;
-    for (int distance{1}; distance != 8; ++distance)
-    {
-      const int new_x{x + (delta_pair.first * distance)};
-      const int new_y{y + (delta_pair.second * distance)};
-      if (is_valid_square_xy(new_x, new_y))
-      {
-        targets.push_back(square(new_x, new_y));
-      }
-    }
-    targetses.push_back(targets);
+    targetses.push_back(get_ray_squares(s, delta_pair.first, delta_pair.second));
   }
   return targetses;
 }
@@ -237,25 +176,9 @@ std::vector<std::pair<int, int>> collect_all_rook_delta_pairs() noexcept
 std::vector<std::vector<square>> collect_all_rook_target_squares(const square& s) noexcept
 {
   std::vector<std::vector<square>> targetses; // Reduplicated plural
-  const auto x{s.get_x()};
-  const auto y{s.get_y()};
-
-  const std::vector<std::pair<int, int>> delta_pairs{
-    collect_all_rook_delta_pairs()
-  };
-  for (const auto& delta_pair: delta_pairs)
+  for (const auto& delta_pair: collect_all_rook_delta_pairs())
   {
-    std::vector<square> targets;
-    for (int distance{1}; distance != 8; ++distance)
-    {
-      const int new_x{x + (delta_pair.first * distance)};
-      const int new_y{y + (delta_pair.second * distance)};
-      if (is_valid_square_xy(new_x, new_y))
-      {
-        targets.push_back(square(new_x, new_y));
-      }
-    }
-    targetses.push_back(targets);
+    targetses.push_back(get_ray_squares(s, delta_pair.first, delta_pair.second));
   }
   return targetses;
 }
@@ -483,6 +406,38 @@ void test_square()
   {
     assert(are_on_same_rank(square("a1"), square("h1")));
   }
+  // collect_all_bishop_target_squares
+  {
+    const auto targetses{collect_all_bishop_target_squares(square("e4"))};
+    assert(targetses.size() == 4);
+    assert(targetses[0].size() == 4); // NE: d5, c6, b7, a8
+    assert(targetses[0][0] == square("d5"));
+  }
+  // collect_all_king_target_squares
+  {
+    assert(collect_all_king_target_squares(square("a1")).size() == 3);
+    assert(collect_all_king_target_squares(square("e4")).size() == 8);
+  }
+  // collect_all_knight_target_squares
+  {
+    assert(collect_all_knight_target_squares(square("b1")).size() == 3);
+  }
+  // collect_all_queen_target_squares
+  {
+    std::size_t n{0};
+    for (const auto& targets: collect_all_queen_target_squares(square("e4")))
+    {
+      n += targets.size();
+    }
+    assert(n == 27);
+  }
+  // collect_all_rook_target_squares
+  {
+    const auto targetses{collect_all_rook_target_squares(square("a1"))};
+    assert(targetses.size() == 4);
+    assert(targetses[1].size() == 7); // E: a2, a3, ..., a8
+    assert(targetses[1][0] == square("a2"));
+  }
   // create_random_square
   {
     const int seed{314};
@@ -601,6 +556,22 @@ void test_square()
     assert(to_coordinat(square("h1")) == game_coordinat(0.5, 7.5));
     assert(to_coordinat(square("h8")) == game_coordinat(7.5, 7.5));
   }
+  // square is a single byte that can be copied with memcpy
+  {
+    static_assert(sizeof(square) == 1);
+    static_assert(std::is_trivially_copyable_v<square>);
+    const square s("c2");
+    assert(s.get_index() == 10);
+    assert(s.get_x() == 1);
+    assert(s.get_y() == 2);
+  }
+  // to_index
+  {
+    assert(to_index(square("a1")) == 0);
+    assert(to_index(square("b1")) == 1);
+    assert(to_index(square("a2")) == 8);
+    assert(to_index(square("h8")) == 63);
+  }
   // to_game_rect
   {
     const auto a1_created{to_game_rect(square("a1"))};
@@ -677,6 +648,11 @@ game_coordinat to_coordinat(const std::string& pos) noexcept
   return to_coordinat(square(pos));
 }
 
+int to_index(const square& s) noexcept
+{
+  return s.get_index();
+}
+
 game_rect to_game_rect(const square& s) noexcept
 {
   const game_coordinat mid{to_coordinat(s)};
@@ -745,9 +721,7 @@ std::string to_str(const std::vector<square>& squares) noexcept
 
 bool operator==(const square& lhs, const square& rhs) noexcept
 {
-  return lhs.get_x() == rhs.get_x()
-    && lhs.get_y() == rhs.get_y()
-  ;
+  return lhs.get_index() == rhs.get_index();
 }
 
 bool operator!=(const square& lhs, const square& rhs) noexcept
@@ -757,9 +731,8 @@ bool operator!=(const square& lhs, const square& rhs) noexcept
 
 bool operator<(const square& lhs, const square& rhs) noexcept
 {
-  if (lhs.get_x() < rhs.get_x()) return true;
-  if (lhs.get_x() > rhs.get_x()) return false;
-  return lhs.get_y() < rhs.get_y();
+  // The index sorts by x first, then by y
+  return lhs.get_index() < rhs.get_index();
 }
 
 std::ostream& operator<<(std::ostream& os, const square& s) noexcept
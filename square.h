@@ -1,6 +1,7 @@
 #ifndef SQUARE_H
 #define SQUARE_H
 
+#include <cstdint>
 #include <iosfwd>
 #include <random>
 #include <string>
@@ -10,6 +11,9 @@
 #include "castling_type.h"
 
 /// A chess square, e.g. e4
+///
+/// A square is stored as its index in a single byte,
+/// so that it is cheap to copy and to store in bulk
 class square
 {
 public:
@@ -21,18 +25,22 @@ public:
   /// As the board goes from a1 at top-left,
   /// to a8 at top-right,
   /// the x coordinat is the rank
-  int get_x() const noexcept { return m_x; }
+  constexpr int get_x() const noexcept { return m_index / 8; }
 
   /// Get the y coordinat, starting from 0 for a1/a2/a3/etc.
   /// As the board goes from a1 at top-left,
   /// to a8 at top-right,
   /// the y coordinat is the file
-  int get_y() const noexcept { return m_y; }
+  constexpr int get_y() const noexcept { return m_index % 8; }
+
+  /// Get the index, from 0 (for a1) to 63 (for h8),
+  /// which is 'get_x() * 8 + get_y()'
+  constexpr int get_index() const noexcept { return m_index; }
 
 private:
 
-  int m_x;
-  int m_y;
+  /// The index, from 0 (for a1) to 63 (for h8)
+  std::int8_t m_index;
 };
 
 /// Are the squares adjacent (i.e. for a king, not a knight)
@@ -174,6 +182,10 @@ game_coordinat to_coordinat(const square& s) noexcept;
 game_coordinat to_coordinat(const std::string& notation) noexcept;
 
 
+/// Convert a square to an index, from 0 (for a1) to 63 (for h8),
+/// to be used to look up a square in an array of 64 elements
+int to_index(const square& s) noexcept;
+
 /// Convert a square to a rectangle
 /// For example, a1 == ((0,0)-(1,1)) (notation is top-left, then bottom-left)
 /// For example, b1 == ((0,1)-(1,2)) (notation is top-left, then bottom-left)
@@ -22,6 +22,40 @@ void test_game_class()
   // Constructor
   {
 
+  }
+  // Copy constructor shares the game options, piece IDs and piece histories
+  {
+    game g;
+    get_piece_at(g, "e2").add_action(
+      piece_action(chess_color::white, piece_type::pawn, piece_action_type::move, "e2", "e4")
+    );
+    tick_until_idle(g);
+    const game copy{g};
+    assert(&copy.get_game_options() == &g.get_game_options());
+    assert(&copy.get_piece_ids() == &g.get_piece_ids());
+    const auto& history{get_piece_at(g, "e4").get_action_history()};
+    const auto& copy_history{get_piece_at(copy, "e4").get_action_history()};
+    assert(&history.get_timed_actions() == &copy_history.get_timed_actions());
+  }
+  // Copy assignment, e.g. to keep the previous state of a game
+  {
+    game g;
+    game previous{get_kings_only_game()};
+    previous = g;
+    assert(previous.get_pieces() == g.get_pieces());
+    assert(get_hash(previous) == get_hash(g));
+  }
+  // Copy constructor, then both games play on independently
+  {
+    game g;
+    game branch{g};
+    get_piece_at(branch, "d2").add_action(
+      piece_action(chess_color::white, piece_type::pawn, piece_action_type::move, "d2", "d3")
+    );
+    tick_until_idle(branch);
+    assert(is_piece_at(branch, "d3"));
+    assert(is_piece_at(g, "d2"));
+    assert(!has_actions(get_piece_at(g, "d2").get_action_history()));
   }
   ////////////////////////////////////////////////////////////////////////////
   // Member functions
@@ -36,6 +70,16 @@ void test_game_class()
     const game g;
     assert(g.get_time() == delta_t(0.0));
   }
+  // game::remove_piece_at
+  {
+    game g;
+    g.remove_piece_at(square("e1"));
+    assert(g.get_pieces().size() == 31);
+    assert(!is_piece_at(g, square("e1")));
+    assert(get_piece_at(g, square("d1")).get_type() == piece_type::queen);
+    assert(get_piece_at(g, square("f1")).get_type() == piece_type::bishop);
+    g.tick(delta_t(0.1)); // Checks the board and IDs are in sync
+  }
   // game::tick
   {
     // #27: a2-a4 takes as long as b2-b3
@@ -775,6 +819,38 @@ void test_game_functions()
     assert(!"Progress #21");
     #endif // FIX_ISSUE_21
   }
+  // collect_all_piece_actions, into a buffer
+  {
+    // Same actions as when returned
+    {
+      const game g;
+      std::vector<piece_action> actions;
+      collect_all_piece_actions(g, actions);
+      assert(actions == collect_all_piece_actions(g));
+    }
+    // Actions are appended, existing ones are kept
+    {
+      const game g;
+      std::vector<piece_action> actions;
+      collect_all_piece_actions(g, chess_color::white, actions);
+      const auto n_white{actions.size()};
+      collect_all_piece_actions(g, chess_color::black, actions);
+      assert(actions.size() > n_white);
+      assert(actions.size() == collect_all_piece_actions(g).size());
+    }
+    // Reusing the buffer does not allocate
+    {
+      const game g;
+      std::vector<piece_action> actions;
+      collect_all_piece_actions(g, actions);
+      const auto capacity{actions.capacity()};
+      const auto* const data{actions.data()};
+      actions.clear();
+      collect_all_piece_actions(g, actions);
+      assert(actions.capacity() == capacity);
+      assert(actions.data() == data);
+    }
+  }
   // collect_all_user_inputses
   {
     //#define FIX_ISSUE_34
@@ -852,6 +928,57 @@ void test_game_functions()
     assert(piece.get_type() == piece_type::king);
     piece.set_selected(true); // Just needs to compile
   }
+  // get_piece_with_id
+  {
+    const game g;
+    const id i{get_piece_at(g, square("e1")).get_id()};
+    assert(has_piece_with_id(g, i));
+    assert(get_piece_with_id(g, i).get_type() == piece_type::king);
+    assert(piece_with_id_is_at(g, i, square("e1")));
+    assert(!piece_with_id_is_at(g, i, square("e2")));
+    assert(!has_piece_with_id(g, create_new_id()));
+  }
+  // get_piece_with_id, after a piece is killed
+  {
+    game_options options{create_default_game_options()};
+    options.set_starting_position(starting_position_type::before_scholars_mate);
+    game g(options);
+    const id queen_id{get_piece_at(g, square("h5")).get_id()};
+    const id pawn_id{get_piece_at(g, square("f7")).get_id()};
+    const id king_id{get_piece_at(g, square("e8")).get_id()};
+    get_piece_with_id(g, queen_id).add_action(
+      piece_action(
+        chess_color::white,
+        piece_type::queen,
+        piece_action_type::attack,
+        square("h5"),
+        square("f7")
+      )
+    );
+    int cnt{0};
+    while (has_piece_with_id(g, pawn_id))
+    {
+      g.tick(delta_t(0.1));
+      ++cnt;
+      assert(cnt < 1000);
+    }
+    assert(piece_with_id_is_at(g, queen_id, square("f7")));
+    assert(piece_with_id_is_at(g, king_id, square("e8")));
+  }
+  // get_piece_with_id, after a piece is removed
+  {
+    game g;
+    const id removed_id{get_piece_at(g, square("e1")).get_id()};
+    const id queen_id{get_piece_at(g, square("d1")).get_id()};
+    const game copy{g};
+    g.remove_piece_at(square("e1"));
+    assert(!has_piece_with_id(g, removed_id));
+    assert(!g.get_piece_ids().has_id(removed_id));
+    // The copy keeps its own IDs
+    assert(has_piece_with_id(copy, removed_id));
+    assert(piece_with_id_is_at(g, queen_id, square("d1")));
+    assert(get_piece_with_id(g, queen_id).get_type() == piece_type::queen);
+  }
   // get_player_side
   {
     const game_options go{create_default_game_options()};
@@ -909,6 +1036,61 @@ void test_game_functions()
     game g;
     assert(is_idle(g));
   }
+  // get_hash
+  {
+    const game a;
+    const game b;
+    assert(get_hash(a) == get_hash(b));
+    assert(get_hash(a) != get_hash(get_kings_only_game()));
+    game c{a};
+    assert(get_hash(c) == get_hash(a));
+    get_piece_at(c, "e2").add_action(
+      piece_action(chess_color::white, piece_type::pawn, piece_action_type::move, "e2", "e4")
+    );
+    assert(get_hash(c) != get_hash(a));
+  }
+  // get_hash is kept up to date by game::tick
+  {
+    game g;
+    get_piece_at(g, "e2").add_action(
+      piece_action(chess_color::white, piece_type::pawn, piece_action_type::move, "e2", "e4")
+    );
+    std::vector<std::uint64_t> hashes;
+    for (int i{0}; i != 30; ++i)
+    {
+      g.tick(delta_t(0.1));
+      hashes.push_back(get_hash(g));
+      for (const auto& p: g.get_pieces())
+      {
+        assert(p.get_hash() == calc_hash(p));
+      }
+    }
+    assert(is_piece_at(g, "e4"));
+    // The hash changes while moving, then stays the same
+    assert(hashes.front() != hashes.back());
+    assert(hashes[hashes.size() - 2] == hashes.back());
+    assert(get_hash(g) != get_hash(game()));
+  }
+  // get_winner
+  {
+    assert(!get_winner(game()));
+    game g{get_game_with_starting_position(starting_position_type::kings_only)};
+    g.remove_piece_at(square("e1"));
+    const auto winner{get_winner(g)};
+    assert(winner);
+    assert(*winner == chess_color::black);
+  }
+  // is_idle_piece_at
+  {
+    game g;
+    assert(is_idle_piece_at(g, chess_color::white, square("e2")));
+    assert(!is_idle_piece_at(g, chess_color::black, square("e2")));
+    assert(!is_idle_piece_at(g, chess_color::white, square("e4")));
+    get_piece_at(g, "e2").add_action(
+      piece_action(chess_color::white, piece_type::pawn, piece_action_type::move, "e2", "e4")
+    );
+    assert(!is_idle_piece_at(g, chess_color::white, square("e2")));
+  }
   // is_piece_at
   {
     const game g;
@@ -0,0 +1,66 @@
+#include "texture_atlas.h"
+
+#ifndef LOGIC_ONLY
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <stdexcept>
+
+texture_atlas::texture_atlas(
+  const std::vector<const sf::Texture *>& textures,
+  const int cell_size
+)
+  : m_cell_size{cell_size},
+    m_n_columns{1},
+    m_n_textures{static_cast<int>(textures.size())}
+{
+  assert(cell_size > 0);
+  assert(!textures.empty());
+  // As square as possible
+  m_n_columns = static_cast<int>(std::ceil(std::sqrt(m_n_textures)));
+  const int n_rows{(m_n_textures + m_n_columns - 1) / m_n_columns};
+  const int max_size{static_cast<int>(sf::Texture::getMaximumSize())};
+  m_cell_size = std::min(m_cell_size, max_size / m_n_columns);
+
+  sf::RenderTexture canvas;
+  if (!canvas.create(m_n_columns * m_cell_size, n_rows * m_cell_size))
+  {
+    throw std::runtime_error("Cannot create a texture atlas");
+  }
+  canvas.clear(sf::Color::Transparent);
+  for (int i{0}; i != m_n_textures; ++i)
+  {
+    const sf::Texture& t{*textures[i]};
+    sf::Sprite sprite(t);
+    sprite.setScale(
+      static_cast<float>(m_cell_size) / t.getSize().x,
+      static_cast<float>(m_cell_size) / t.getSize().y
+    );
+    sprite.setPosition(
+      (i % m_n_columns) * m_cell_size,
+      (i / m_n_columns) * m_cell_size
+    );
+    // Copy the transparency as is, instead of blending it
+    canvas.draw(sprite, sf::RenderStates(sf::BlendNone));
+  }
+  canvas.display();
+  m_texture = canvas.getTexture();
+  m_texture.setSmooth(true);
+}
+
+sf::FloatRect texture_atlas::get_rect(const int index) const noexcept
+{
+  assert(index >= 0);
+  assert(index < m_n_textures);
+  // Half a pixel inwards, so that smoothing
+  // does not mix in the pixels of a neighbouring cell
+  return sf::FloatRect(
+    (index % m_n_columns) * m_cell_size + 0.5f,
+    (index / m_n_columns) * m_cell_size + 0.5f,
+    m_cell_size - 1.0f,
+    m_cell_size - 1.0f
+  );
+}
+
+#endif // LOGIC_ONLY
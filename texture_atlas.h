@@ -0,0 +1,57 @@
+#ifndef TEXTURE_ATLAS_H
+#define TEXTURE_ATLAS_H
+
+#ifndef LOGIC_ONLY
+
+#include <SFML/Graphics.hpp>
+
+#include <vector>
+
+/// Textures copied into one texture, in a grid of square cells,
+/// so that the sprites of all these textures
+/// can be drawn with one draw call, using an sf::VertexArray.
+///
+/// Each texture is scaled to fit its cell,
+/// so the textures should have the same aspect ratio
+class texture_atlas
+{
+public:
+  /// The cell size, in pixels, is reduced if the atlas
+  /// would not fit the maximum texture size of the graphics card.
+  /// Throws a std::runtime_error if the atlas cannot be created
+  texture_atlas(
+    const std::vector<const sf::Texture *>& textures,
+    const int cell_size
+  );
+
+  /// Get the size of a cell, in pixels
+  int get_cell_size() const noexcept { return m_cell_size; }
+
+  /// Get the number of textures in the atlas
+  int get_n_textures() const noexcept { return m_n_textures; }
+
+  /// Get the part of the atlas of the texture at the index,
+  /// in pixels, as used for the texture coordinates of an sf::Vertex
+  sf::FloatRect get_rect(const int index) const noexcept;
+
+  /// Get the texture all textures are copied into
+  const sf::Texture& get_texture() const noexcept { return m_texture; }
+
+private:
+
+  /// The width and height of each cell, in pixels
+  int m_cell_size;
+
+  /// The number of cells per row
+  int m_n_columns;
+
+  /// The number of textures in the atlas
+  int m_n_textures;
+
+  /// The texture all textures are copied into
+  sf::Texture m_texture;
+};
+
+#endif // LOGIC_ONLY
+
+#endif // TEXTURE_ATLAS_H
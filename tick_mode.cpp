@@ -0,0 +1,50 @@
+#include "tick_mode.h"
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <sstream>
+
+#include "../magic_enum/include/magic_enum/magic_enum.hpp" // https://github.com/Neargye/magic_enum
+
+std::vector<tick_mode> get_all_tick_modes() noexcept
+{
+  const auto a{magic_enum::enum_values<tick_mode>()};
+  std::vector<tick_mode> v;
+  v.reserve(a.size());
+  std::copy(std::begin(a), std::end(a), std::back_inserter(v));
+  assert(a.size() == v.size());
+  return v;
+}
+
+void test_tick_mode()
+{
+#ifndef NDEBUG
+  // get_all_tick_modes
+  {
+    assert(get_all_tick_modes().size() == 2);
+  }
+  // to_str
+  {
+    assert(to_str(tick_mode::fixed) == "fixed");
+    assert(to_str(tick_mode::variable) == "variable");
+  }
+  // operator<<
+  {
+    std::stringstream s;
+    s << tick_mode::fixed;
+    assert(s.str() == "fixed");
+  }
+#endif // NDEBUG
+}
+
+std::string to_str(const tick_mode mode) noexcept
+{
+  return std::string(magic_enum::enum_name(mode));
+}
+
+std::ostream& operator<<(std::ostream& os, const tick_mode mode) noexcept
+{
+  os << to_str(mode);
+  return os;
+}
@@ -0,0 +1,33 @@
+#ifndef TICK_MODE_H
+#define TICK_MODE_H
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+/// How the game is ticked when played in a window
+enum class tick_mode
+{
+  /// Tick in fixed steps, independent of the frame rate,
+  /// so that the same user inputs give the same game,
+  /// see \link{fixed_timestep}
+  fixed,
+
+  /// Tick once per frame, by the duration of that frame
+  variable
+};
+
+/// Get all the tick modes
+std::vector<tick_mode> get_all_tick_modes() noexcept;
+
+/// Get the default tick mode
+constexpr tick_mode get_default_tick_mode() { return tick_mode::variable; }
+
+/// Test this class and its free functions
+void test_tick_mode();
+
+std::string to_str(const tick_mode mode) noexcept;
+
+std::ostream& operator<<(std::ostream& os, const tick_mode mode) noexcept;
+
+#endif // TICK_MODE_H
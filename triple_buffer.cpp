@@ -0,0 +1,77 @@
+#include "triple_buffer.h"
+
+#include <cassert>
+#include <string>
+#include <thread>
+
+void test_triple_buffer()
+{
+#ifndef NDEBUG // no tests in release
+  // All values start equal
+  {
+    const triple_buffer<std::string> b("pi");
+    assert(b.get_front() == "pi");
+  }
+  // Nothing is taken before something is published
+  {
+    triple_buffer<int> b(1);
+    assert(!b.take());
+    assert(b.get_front() == 1);
+  }
+  // The published value is taken
+  {
+    triple_buffer<int> b(1);
+    b.get_back() = 2;
+    b.publish();
+    assert(b.get_front() == 1);
+    assert(b.take());
+    assert(b.get_front() == 2);
+    assert(!b.take());
+    assert(b.get_front() == 2);
+  }
+  // Only the latest published value is taken
+  {
+    triple_buffer<int> b(0);
+    for (int i{1}; i != 4; ++i)
+    {
+      b.get_back() = i;
+      b.publish();
+    }
+    assert(b.take());
+    assert(b.get_front() == 3);
+  }
+  // The value being written is never the value being read
+  {
+    triple_buffer<int> b(0);
+    b.get_back() = 1;
+    b.publish();
+    assert(b.take());
+    b.get_back() = 2;
+    assert(b.get_front() == 1);
+  }
+  // One thread publishes while another takes, the values only go up
+  {
+    triple_buffer<std::string> b("0");
+    const int n{10000};
+    std::thread writer(
+      [&b, n]()
+      {
+        for (int i{1}; i <= n; ++i)
+        {
+          b.get_back() = std::to_string(i);
+          b.publish();
+        }
+      }
+    );
+    int last{0};
+    while (last != n)
+    {
+      if (!b.take()) continue;
+      const int value{std::stoi(b.get_front())};
+      assert(value > last);
+      last = value;
+    }
+    writer.join();
+  }
+#endif
+}
@@ -0,0 +1,82 @@
+#ifndef TRIPLE_BUFFER_H
+#define TRIPLE_BUFFER_H
+
+#include <array>
+#include <atomic>
+
+/// Three values, to hand over the latest version of a value
+/// from one thread that writes it to one other thread that reads it,
+/// without locking and without either thread waiting for the other.
+///
+/// The writer modifies the back value and then publishes it,
+/// the reader takes the latest published value as its front value.
+/// The third value is the one published last and not yet taken.
+/// If the writer publishes faster than the reader takes,
+/// the reader skips the values in between
+template <class T>
+class triple_buffer
+{
+public:
+  explicit triple_buffer(const T& value = T())
+    : m_values{value, value, value},
+      m_back{0},
+      m_front{1},
+      m_middle{2}
+  {
+
+  };
+
+  /// Get the value to modify and then publish.
+  /// Must only be called by the thread that writes
+  T& get_back() noexcept { return m_values[m_back]; };
+
+  /// Get the value last taken.
+  /// Must only be called by the thread that reads
+  const T& get_front() const noexcept { return m_values[m_front]; };
+
+  /// Publish the back value, after which the back value
+  /// is the one least recently published or taken.
+  /// Must only be called by the thread that writes
+  void publish() noexcept
+  {
+    m_back = m_middle.exchange(m_back | sm_is_new, std::memory_order_acq_rel)
+      & sm_index_mask
+    ;
+  };
+
+  /// Take the latest published value as the front value, if there is one.
+  /// Must only be called by the thread that reads.
+  /// @return true if a new value was taken
+  bool take() noexcept
+  {
+    if (!(m_middle.load(std::memory_order_acquire) & sm_is_new)) return false;
+    m_front = m_middle.exchange(m_front, std::memory_order_acq_rel)
+      & sm_index_mask
+    ;
+    return true;
+  };
+
+private:
+
+  /// The bit set in 'm_middle' if the middle value is not taken yet
+  static constexpr int sm_is_new{4};
+
+  /// The bits of 'm_middle' that are the index
+  static constexpr int sm_index_mask{3};
+
+  std::array<T, 3> m_values;
+
+  /// The index of the value the writer modifies
+  int m_back;
+
+  /// The index of the value the reader reads
+  int m_front;
+
+  /// The index of the value published last, and if it is new
+  std::atomic<int> m_middle;
+};
+
+/// Test our triple_buffer class
+void test_triple_buffer();
+
+#endif // TRIPLE_BUFFER_H
@@ -0,0 +1,112 @@
+#include "unit_paths_overlay.h"
+
+#ifndef LOGIC_ONLY
+
+#include "game_view_layout.h"
+#include "piece.h"
+#include "sfml_helper.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+unit_paths_overlay::unit_paths_overlay()
+  : m_is_built{false},
+    m_n_builds{0},
+    m_vertices(sf::Triangles)
+{
+
+}
+
+void unit_paths_overlay::build(
+  const std::vector<piece>& pieces,
+  const game_view_layout& layout
+)
+{
+  m_vertices.clear();
+  m_actions.clear();
+  m_current_squares.clear();
+  const auto to_pixel{
+    [&layout](const square& s)
+    {
+      const screen_coordinat c{
+        convert_to_screen_coordinat(to_coordinat(s), layout)
+      };
+      return sf::Vector2f(c.get_x(), c.get_y());
+    }
+  };
+  const float square_width{static_cast<float>(get_square_width(layout))};
+  const float line_width{std::max(2.0f, square_width * 0.05f)};
+  const float outline_thickness{2.0f};
+  const float radius{0.125f * square_width};
+  for (const auto& piece: pieces)
+  {
+    m_actions.push_back(piece.get_actions());
+    m_current_squares.push_back(piece.get_current_square());
+    if (is_idle(piece)) continue;
+    const sf::Color color{to_sfml_color(piece.get_color())};
+    const sf::Color outline_color{
+      to_sfml_color(get_other_color(piece.get_color()))
+    };
+    // A line per action, on top of a wider and longer one as its outline
+    for (const auto& action: piece.get_actions())
+    {
+      const sf::Vector2f from{to_pixel(action.get_from())};
+      const sf::Vector2f to{to_pixel(action.get_to())};
+      const sf::Vector2f delta{to - from};
+      const float length{std::hypot(delta.x, delta.y)};
+      if (length == 0.0f) continue;
+      const sf::Vector2f extension{delta * (outline_thickness / length)};
+      add_line(
+        m_vertices,
+        from - extension,
+        to + extension,
+        line_width + (2.0f * outline_thickness),
+        outline_color
+      );
+      add_line(m_vertices, from, to, line_width, color);
+    }
+    // A circle at the current square and at each subgoal
+    add_circle(m_vertices, to_pixel(piece.get_current_square()), radius, color);
+    for (const auto& action: piece.get_actions())
+    {
+      add_circle(m_vertices, to_pixel(action.get_to()), radius, color);
+    }
+  }
+  m_window_size = layout.get_window_size();
+  m_is_built = true;
+  ++m_n_builds;
+}
+
+void unit_paths_overlay::draw(
+  sf::RenderTarget& target,
+  const std::vector<piece>& pieces,
+  const game_view_layout& layout
+)
+{
+  if (is_outdated(pieces, layout))
+  {
+    build(pieces, layout);
+  }
+  target.draw(m_vertices);
+}
+
+bool unit_paths_overlay::is_outdated(
+  const std::vector<piece>& pieces,
+  const game_view_layout& layout
+) const noexcept
+{
+  if (!m_is_built) return true;
+  if (!(m_window_size == layout.get_window_size())) return true;
+  if (pieces.size() != m_actions.size()) return true;
+  assert(m_actions.size() == m_current_squares.size());
+  const int n_pieces{static_cast<int>(pieces.size())};
+  for (int i{0}; i != n_pieces; ++i)
+  {
+    if (pieces[i].get_current_square() != m_current_squares[i]) return true;
+    if (pieces[i].get_actions() != m_actions[i]) return true;
+  }
+  return false;
+}
+
+#endif // LOGIC_ONLY
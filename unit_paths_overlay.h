@@ -0,0 +1,72 @@
+#ifndef UNIT_PATHS_OVERLAY_H
+#define UNIT_PATHS_OVERLAY_H
+
+#ifndef LOGIC_ONLY
+
+#include "ccfwd.h"
+#include "piece_action_queue.h"
+#include "screen_coordinat.h"
+#include "square.h"
+
+#include <SFML/Graphics.hpp>
+
+#include <vector>
+
+/// The planned paths of the pieces, as drawn on the board:
+/// a line per action and a circle at each subgoal.
+///
+/// The vertices of all paths are kept in one sf::VertexArray,
+/// which is only rebuilt when an action queue, a piece's square
+/// or the window size changes, so that drawing the paths
+/// is a single draw call
+class unit_paths_overlay
+{
+public:
+  unit_paths_overlay();
+
+  /// Draw the paths of the pieces, rebuilding the vertices first if needed
+  void draw(
+    sf::RenderTarget& target,
+    const std::vector<piece>& pieces,
+    const game_view_layout& layout
+  );
+
+  /// Get the number of times the vertices have been built
+  int get_n_builds() const noexcept { return m_n_builds; }
+
+private:
+
+  /// The action queue of each piece the vertices were built for
+  std::vector<piece_action_queue> m_actions;
+
+  /// The square of each piece the vertices were built for
+  std::vector<square> m_current_squares;
+
+  /// Have the vertices been built yet?
+  bool m_is_built;
+
+  /// The number of times the vertices have been built
+  int m_n_builds;
+
+  /// The lines and circles of all paths
+  sf::VertexArray m_vertices;
+
+  /// The size of the window the vertices were built for
+  screen_coordinat m_window_size;
+
+  /// Build the vertices of all paths
+  void build(
+    const std::vector<piece>& pieces,
+    const game_view_layout& layout
+  );
+
+  /// Have the paths changed since the vertices were built?
+  bool is_outdated(
+    const std::vector<piece>& pieces,
+    const game_view_layout& layout
+  ) const noexcept;
+};
+
+#endif // LOGIC_ONLY
+
+#endif // UNIT_PATHS_OVERLAY_H
@@ -286,6 +286,8 @@ void process_press_action_1_or_lmb_down(
     && get_piece_at(g, king_square).get_color() == player_color
     && get_piece_at(g, king_square).is_selected()
     && can_castle_kingside(get_piece_at(g, king_square), g)
+    && cursor == square(king_square.get_x(), king_square.get_y() + 2)
+    && is_piece_at(g, get_default_rook_square(player_color, castling_type::king_side))
   };
   if (is_castle_kingside)
   {
@@ -0,0 +1,40 @@
+# Project file to replay all games of a PGN database without a window,
+# to find the chess games the game logic cannot reproduce.
+# Use the release build, as a debug build stops at the first failed assert.
+#
+# Usage: ./conquer_chess_validation [pgn_filename] [n_threads] [timings_filename]
+
+DEFINES += LOGIC_ONLY
+
+# All files are in here, the rest are just settings
+include(game.pri)
+
+SOURCES += validation_main.cpp
+
+TARGET = conquer_chess_validation
+
+CONFIG += console thread
+CONFIG -= app_bundle
+
+# Use the C++ version that all team members can use
+CONFIG += c++17
+QMAKE_CXXFLAGS += -std=c++17
+
+# High warning levels
+QMAKE_CXXFLAGS += -Wall -Wextra -Wshadow -Wnon-virtual-dtor -pedantic
+
+# Debug and release settings
+CONFIG += debug_and_release
+CONFIG(release, debug|release) {
+  DEFINES += NDEBUG
+  QMAKE_CXXFLAGS += -O3
+}
+CONFIG(debug, debug|release) {
+  # A warning is an error
+  QMAKE_CXXFLAGS += -Werror
+}
+
+# Qt5, for the resources
+QT += core
+
+LIBS += -lsfml-graphics -lsfml-window -lsfml-system -lsfml-audio -lsfml-network
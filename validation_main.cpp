@@ -0,0 +1,114 @@
+/// Replay all games of a PGN database in the game, as fast as possible,
+/// to find the chess games the game logic cannot reproduce.
+///
+/// Usage:
+///
+///   conquer_chess_validation [pgn_filename] [n_threads] [timings_filename]
+///
+/// Each game that is not reproduced is shown with the move that failed.
+/// If 'timings_filename' is given, the timing of each game is written to it,
+/// as comma-separated values.
+/// By default, as many threads are used as there are cores
+
+#include "mapped_file.h"
+#include "pgn_reader.h"
+#include "replay_validation.h"
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+int main(int argc, char **argv)
+{
+  const std::vector<std::string> args(argv, argv + argc);
+  if (args.size() < 2)
+  {
+    std::cerr << "Usage: " << args[0] << " [pgn_filename] [n_threads] [timings_filename]\n";
+    return 1;
+  }
+  const int n_threads{args.size() > 2 ? std::stoi(args[2]) : get_n_threads()};
+  std::ofstream timings_file;
+  if (args.size() > 3)
+  {
+    timings_file.open(args[3]);
+    timings_file << "game,n_moves,n_ticks,secs,is_reproduced\n";
+  }
+
+  const mapped_file f(args[1]);
+  pgn_reader r(f.get_text());
+
+  // The games are validated in batches,
+  // so that a database of millions of games needs not fit into memory
+  const int batch_size{1000};
+  std::vector<std::vector<chess_move>> games;
+  games.reserve(batch_size);
+  int n_games{0};
+  int n_reproduced{0};
+  long long n_moves{0};
+  long long n_ticks{0};
+  double max_n_secs{0.0};
+  int slowest_game{0};
+  const auto start{std::chrono::steady_clock::now()};
+  bool is_done{false};
+  while (!is_done)
+  {
+    games.clear();
+    while (static_cast<int>(games.size()) != batch_size)
+    {
+      if (!r.read_game())
+      {
+        is_done = true;
+        break;
+      }
+      games.push_back(r.get_moves());
+    }
+    const auto validations{validate_in_parallel(games, n_threads)};
+    for (std::size_t i{0}; i != validations.size(); ++i)
+    {
+      const auto& v{validations[i]};
+      const int game_index{n_games + static_cast<int>(i)};
+      if (!is_reproduced(v))
+      {
+        std::cout
+          << "Game " << (game_index + 1) << ", move " << (v.get_n_moves() + 1)
+          << " '" << v.get_failed_move() << "': " << v.get_error() << '\n'
+        ;
+      }
+      if (v.get_n_secs() > max_n_secs)
+      {
+        max_n_secs = v.get_n_secs();
+        slowest_game = game_index;
+      }
+      if (timings_file)
+      {
+        timings_file
+          << (game_index + 1) << ',' << v.get_n_moves() << ',' << v.get_n_ticks()
+          << ',' << v.get_n_secs() << ',' << is_reproduced(v) << '\n'
+        ;
+      }
+    }
+    n_games += static_cast<int>(validations.size());
+    n_reproduced += count_reproduced(validations);
+    n_moves += count_moves(validations);
+    n_ticks += count_ticks(validations);
+  }
+  const std::chrono::duration<double> duration{
+    std::chrono::steady_clock::now() - start
+  };
+  const double n_secs{duration.count()};
+
+  std::cout
+    << "Number of games: " << n_games << '\n'
+    << "Number of games reproduced: " << n_reproduced << '\n'
+    << "Number of games not reproduced: " << (n_games - n_reproduced) << '\n'
+    << "Number of moves reproduced: " << n_moves << '\n'
+    << "Number of ticks: " << n_ticks << '\n'
+    << "Number of threads: " << n_threads << '\n'
+    << "Slowest game: " << (slowest_game + 1) << ", " << max_n_secs << " secs\n"
+    << "Duration (secs): " << n_secs << '\n'
+    << "Games per second: " << (n_games / n_secs) << '\n'
+    << "Moves per second: " << (n_moves / n_secs) << '\n'
+  ;
+}
@@ -0,0 +1,150 @@
+#include "zobrist.h"
+
+#include "piece_action.h"
+#include "square.h"
+
+#include <algorithm>
+#include <cassert>
+#include <set>
+
+std::uint64_t get_zobrist_key(const std::uint64_t feature) noexcept
+{
+  // SplitMix64, see https://prng.di.unimi.it/splitmix64.c
+  std::uint64_t z{feature + 0x9e3779b97f4a7c15ull};
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+  return z ^ (z >> 31);
+}
+
+std::uint64_t get_zobrist_key(
+  const chess_color color,
+  const piece_type type,
+  const square& s
+) noexcept
+{
+  return get_zobrist_key(
+    (std::uint64_t{1} << 32)
+    | (static_cast<std::uint64_t>(color) << 16)
+    | (static_cast<std::uint64_t>(type) << 8)
+    | static_cast<std::uint64_t>(s.get_index())
+  );
+}
+
+std::uint64_t get_zobrist_action_key(
+  const piece_action& action,
+  const int progress_bucket
+) noexcept
+{
+  assert(progress_bucket >= 0);
+  assert(progress_bucket < get_n_zobrist_progress_buckets());
+  return get_zobrist_key(
+    (std::uint64_t{2} << 32)
+    | (static_cast<std::uint64_t>(action.get_action_type()) << 24)
+    | (static_cast<std::uint64_t>(action.get_from().get_index()) << 16)
+    | (static_cast<std::uint64_t>(action.get_to().get_index()) << 8)
+    | static_cast<std::uint64_t>(progress_bucket)
+  );
+}
+
+std::uint64_t get_zobrist_health_key(
+  const square& s,
+  const int health_bucket
+) noexcept
+{
+  assert(health_bucket >= 0);
+  assert(health_bucket < get_n_zobrist_health_buckets());
+  return get_zobrist_key(
+    (std::uint64_t{3} << 32)
+    | (static_cast<std::uint64_t>(s.get_index()) << 8)
+    | static_cast<std::uint64_t>(health_bucket)
+  );
+}
+
+int get_zobrist_health_bucket(const double f_health) noexcept
+{
+  const int n{get_n_zobrist_health_buckets()};
+  if (f_health <= 0.0) return 0;
+  if (f_health >= 1.0) return n - 1;
+  // Bucket zero is for the dead only
+  return std::clamp(1 + static_cast<int>(f_health * (n - 1)), 1, n - 1);
+}
+
+int get_zobrist_progress_bucket(const delta_t& t) noexcept
+{
+  const int n{get_n_zobrist_progress_buckets()};
+  return std::clamp(static_cast<int>(t.get() * n), 0, n - 1);
+}
+
+std::uint64_t get_zobrist_selected_key(const square& s) noexcept
+{
+  return get_zobrist_key(
+    (std::uint64_t{4} << 32)
+    | static_cast<std::uint64_t>(s.get_index())
+  );
+}
+
+void test_zobrist()
+{
+#ifndef NDEBUG
+  // get_zobrist_key is deterministic
+  {
+    assert(get_zobrist_key(123) == get_zobrist_key(123));
+    assert(get_zobrist_key(123) != get_zobrist_key(124));
+  }
+  // get_zobrist_key of pieces are unique
+  {
+    std::set<std::uint64_t> keys;
+    int n{0};
+    for (const auto color: get_all_chess_colors())
+    {
+      for (const auto type: get_all_piece_types())
+      {
+        for (int x{0}; x != 8; ++x)
+        {
+          for (int y{0}; y != 8; ++y)
+          {
+            keys.insert(get_zobrist_key(color, type, square(x, y)));
+            ++n;
+          }
+        }
+      }
+    }
+    assert(static_cast<int>(keys.size()) == n);
+  }
+  // get_zobrist_key of different features differ
+  {
+    const square s("e4");
+    const std::set<std::uint64_t> keys{
+      get_zobrist_key(chess_color::white, piece_type::king, s),
+      get_zobrist_health_key(s, 0),
+      get_zobrist_selected_key(s),
+      get_zobrist_action_key(get_test_piece_action(), 0)
+    };
+    assert(keys.size() == 4);
+  }
+  // get_zobrist_action_key depends on the progress
+  {
+    const auto a{get_test_piece_action()};
+    assert(get_zobrist_action_key(a, 0) != get_zobrist_action_key(a, 1));
+  }
+  // get_zobrist_health_bucket
+  {
+    const int n{get_n_zobrist_health_buckets()};
+    assert(get_zobrist_health_bucket(-0.5) == 0);
+    assert(get_zobrist_health_bucket(0.0) == 0);
+    assert(get_zobrist_health_bucket(0.001) == 1);
+    assert(get_zobrist_health_bucket(0.5) > 1);
+    assert(get_zobrist_health_bucket(0.5) < n - 1);
+    assert(get_zobrist_health_bucket(0.999) == n - 1);
+    assert(get_zobrist_health_bucket(1.0) == n - 1);
+  }
+  // get_zobrist_progress_bucket
+  {
+    const int n{get_n_zobrist_progress_buckets()};
+    assert(get_zobrist_progress_bucket(delta_t(0.0)) == 0);
+    assert(get_zobrist_progress_bucket(delta_t(0.5)) == n / 2);
+    assert(get_zobrist_progress_bucket(delta_t(1.0)) == n - 1);
+    assert(get_zobrist_progress_bucket(delta_t(2.0)) == n - 1);
+  }
+#endif // NDEBUG
+}
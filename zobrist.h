@@ -0,0 +1,66 @@
+#ifndef ZOBRIST_H
+#define ZOBRIST_H
+
+#include "ccfwd.h"
+#include "chess_color.h"
+#include "delta_t.h"
+#include "piece_type.h"
+
+#include <cstdint>
+
+/// Zobrist hashing: each feature of a game state has a random 64-bit key,
+/// and the hash of a state is the XOR of the keys of its features.
+/// Adding or removing a feature is then one XOR,
+/// so a hash can be kept up to date incrementally.
+///
+/// The keys are not stored in a table, but generated from the feature
+/// by SplitMix64, so that there is no table to initialize or look up
+
+/// The number of buckets the fraction of health is put into
+constexpr int get_n_zobrist_health_buckets() noexcept { return 8; }
+
+/// The number of buckets the progress of an action is put into
+constexpr int get_n_zobrist_progress_buckets() noexcept { return 4; }
+
+/// Get the Zobrist key of a feature,
+/// where each feature must have its own value
+std::uint64_t get_zobrist_key(const std::uint64_t feature) noexcept;
+
+/// Get the Zobrist key of a piece of a color and type at a square
+std::uint64_t get_zobrist_key(
+  const chess_color color,
+  const piece_type type,
+  const square& s
+) noexcept;
+
+/// Get the Zobrist key of the front action of a piece,
+/// which has progressed to the bucket,
+/// see \link{get_zobrist_progress_bucket}
+std::uint64_t get_zobrist_action_key(
+  const piece_action& action,
+  const int progress_bucket
+) noexcept;
+
+/// Get the Zobrist key of the health of the piece at a square,
+/// see \link{get_zobrist_health_bucket}
+std::uint64_t get_zobrist_health_key(
+  const square& s,
+  const int health_bucket
+) noexcept;
+
+/// Get the bucket of a fraction of health,
+/// so that the hash only changes when the health changes noticeably.
+/// A dead piece is in bucket zero, a piece at full health in the last one
+int get_zobrist_health_bucket(const double f_health) noexcept;
+
+/// Get the bucket of the time the current action has taken,
+/// where 1.0 is a full action
+int get_zobrist_progress_bucket(const delta_t& t) noexcept;
+
+/// Get the Zobrist key of the piece at a square being selected
+std::uint64_t get_zobrist_selected_key(const square& s) noexcept;
+
+/// Test these functions
+void test_zobrist();
+
+#endif // ZOBRIST_H